@@ -0,0 +1,100 @@
+/**
+ * @file   bench_dense_read_3d_small_tiles.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark dense 3D read performance in column-major layout over many
+ * small row-major tiles, which transposes every tile into the results.
+ */
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_DENSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d1", {{1, array_dim}}, tile_dim));
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d2", {{1, array_dim}}, tile_dim));
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d3", {{1, array_dim}}, tile_dim));
+    schema.set_domain(domain);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    Array::create(array_uri_, schema);
+
+    data_.resize(array_dim * array_dim * array_dim);
+    for (uint64_t i = 0; i < data_.size(); i++) {
+      data_[i] = i;
+    }
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_subarray({1u, array_dim, 1u, array_dim, 1u, array_dim})
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_buffer("a", data_);
+    query.submit();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    data_.resize(array_dim * array_dim * array_dim);
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+    Query query(ctx_, array);
+    query.set_subarray({1u, array_dim, 1u, array_dim, 1u, array_dim})
+        .set_layout(TILEDB_COL_MAJOR)
+        .set_buffer("a", data_);
+    query.submit();
+    array.close();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const unsigned array_dim = 256;
+  const unsigned tile_dim = 16;
+
+  Context ctx_;
+  std::vector<int> data_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file   bench_sparse_read_boxes.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark sparse 2D reads of many small random boxes over uniformly
+ * scattered cells. The cell order determines how compact the MBRs of the
+ * data tiles are, and hence how many tiles each box touches. The source is
+ * built once per cell order (`CELL_ORDER`), as
+ * `bench_sparse_read_boxes_hilbert` and `bench_sparse_read_boxes_row_major`.
+ */
+
+#include <tiledb/tiledb>
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#include "benchmark.h"
+
+#ifndef CELL_ORDER
+#define CELL_ORDER TILEDB_HILBERT
+#endif
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    // A single space tile, so that the data tiles follow the cell order
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d1", {{1, max_row}}, max_row));
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d2", {{1, max_col}}, max_col));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    schema.set_cell_order(CELL_ORDER);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    Array::create(array_uri_, schema);
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint32_t> row(1, max_row);
+    std::uniform_int_distribution<uint32_t> col(1, max_col);
+    for (uint64_t i = 0; i < num_cells; i++) {
+      coords_.push_back(row(gen));
+      coords_.push_back(col(gen));
+    }
+
+    data_.resize(num_cells);
+    for (uint64_t i = 0; i < data_.size(); i++)
+      data_[i] = i;
+
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_buffer("a", data_)
+        .set_coordinates(coords_);
+    query.submit();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+    std::mt19937 gen(seed + 1);
+    std::uniform_int_distribution<uint32_t> row(1, max_row - box_rows + 1);
+    std::uniform_int_distribution<uint32_t> col(1, max_col - box_cols + 1);
+    uint64_t max_data = 0, max_coords = 0;
+    for (unsigned i = 0; i < num_boxes; i++) {
+      uint32_t r = row(gen), c = col(gen);
+      std::vector<uint32_t> subarray = {
+          r, r + box_rows - 1, c, c + box_cols - 1};
+      auto max_elements = array.max_buffer_elements(subarray);
+      max_data = std::max(max_data, max_elements["a"].second);
+      max_coords = std::max(max_coords, max_elements[TILEDB_COORDS].second);
+      subarrays_.push_back(subarray);
+    }
+
+    data_.resize(max_data);
+    coords_.resize(max_coords);
+
+    Stats::enable();
+    Stats::reset();
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+    for (const auto& subarray : subarrays_) {
+      Query query(ctx_, array);
+      query.set_subarray(subarray)
+          .set_layout(TILEDB_GLOBAL_ORDER)
+          .set_buffer("a", data_)
+          .set_coordinates(coords_);
+      query.submit();
+    }
+    array.close();
+
+    // Report the tiles touched (`reader_num_attr_tiles_touched`) on stderr,
+    // keeping stdout for the timings
+    Stats::dump(stderr);
+    Stats::disable();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const unsigned capacity = 1000;
+  const uint32_t max_row = 10000, max_col = 10000;
+  const uint64_t num_cells = 1000000;
+  const unsigned num_boxes = 200;
+  const uint32_t box_rows = 200, box_cols = 200;
+  const unsigned seed = 0;
+
+  Context ctx_;
+  std::vector<int> data_;
+  std::vector<uint32_t> coords_;
+  std::vector<std::vector<uint32_t>> subarrays_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
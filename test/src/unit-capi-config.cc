@@ -196,11 +196,23 @@ void check_save_to_file() {
   ss << "sm.dedup_coords false\n";
   ss << "sm.enable_signal_handlers true\n";
   ss << "sm.fragment_metadata_cache_size 10000000\n";
+  ss << "sm.memory_budget 5368709120\n";
+  ss << "sm.memory_budget_var 10737418240\n";
   ss << "sm.num_async_threads 1\n";
   ss << "sm.num_reader_threads 1\n";
   ss << "sm.num_tbb_threads -1\n";
   ss << "sm.num_writer_threads 1\n";
+  ss << "sm.read_coalesce_gap 65536\n";
+  ss << "sm.read_coalesce_max_size 10485760\n";
+  ss << "sm.read_inflight_size 100000000\n";
+  ss << "sm.read_prefetch_memory_budget 1000000000\n";
+  ss << "sm.read_prefetch_partitions 0\n";
   ss << "sm.tile_cache_size 10000000\n";
+  ss << "sm.var_offsets.bitsize 64\n";
+  ss << "sm.var_offsets.extra_element false\n";
+  ss << "sm.write_batch_size 10000000\n";
+  ss << "sm.write_staging_buffers 0\n";
+  ss << "vfs.file.max_open_files 256\n";
   ss << "vfs.file.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
   ss << "vfs.min_parallel_size 10485760\n";
@@ -366,6 +378,17 @@ TEST_CASE("C API: Test config iter", "[capi], [config]") {
   all_param_values["sm.check_coord_oob"] = "true";
   all_param_values["sm.check_global_order"] = "true";
   all_param_values["sm.tile_cache_size"] = "100";
+  all_param_values["sm.read_inflight_size"] = "100000000";
+  all_param_values["sm.read_coalesce_gap"] = "65536";
+  all_param_values["sm.read_coalesce_max_size"] = "10485760";
+  all_param_values["sm.read_prefetch_partitions"] = "0";
+  all_param_values["sm.read_prefetch_memory_budget"] = "1000000000";
+  all_param_values["sm.memory_budget"] = "5368709120";
+  all_param_values["sm.memory_budget_var"] = "10737418240";
+  all_param_values["sm.write_batch_size"] = "10000000";
+  all_param_values["sm.write_staging_buffers"] = "0";
+  all_param_values["sm.var_offsets.bitsize"] = "64";
+  all_param_values["sm.var_offsets.extra_element"] = "false";
   all_param_values["sm.array_schema_cache_size"] = "1000";
   all_param_values["sm.fragment_metadata_cache_size"] = "10000000";
   all_param_values["sm.enable_signal_handlers"] = "true";
@@ -378,6 +401,7 @@ TEST_CASE("C API: Test config iter", "[capi], [config]") {
   all_param_values["vfs.min_parallel_size"] = "10485760";
   all_param_values["vfs.file.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
+  all_param_values["vfs.file.max_open_files"] = "256";
   all_param_values["vfs.s3.scheme"] = "https";
   all_param_values["vfs.s3.region"] = "us-east-1";
   all_param_values["vfs.s3.aws_access_key_id"] = "";
@@ -406,6 +430,7 @@ TEST_CASE("C API: Test config iter", "[capi], [config]") {
   vfs_param_values["min_parallel_size"] = "10485760";
   vfs_param_values["file.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
+  vfs_param_values["file.max_open_files"] = "256";
   vfs_param_values["s3.scheme"] = "https";
   vfs_param_values["s3.region"] = "us-east-1";
   vfs_param_values["s3.aws_access_key_id"] = "";
@@ -3759,4 +3759,71 @@ TEST_CASE_METHOD(
     check_sorted_reads(FILE_URI_PREFIX + FILE_TEMP_DIR);
     remove_temp_dir(FILE_URI_PREFIX + FILE_TEMP_DIR);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(
+    DenseArrayFx,
+    "C API: Test dense array, overlapping fragments",
+    "[capi], [dense], [dense-overlapping-fragments]") {
+  std::string temp_dir = FILE_URI_PREFIX + FILE_TEMP_DIR;
+  std::string array_name = temp_dir + "dense_overlapping_fragments/";
+  create_temp_dir(temp_dir);
+  create_dense_array_2D(
+      array_name, 3, 3, 1, 10, 1, 10, 9, TILEDB_ROW_MAJOR, TILEDB_ROW_MAJOR);
+
+  // Write overlapping fragments, from the oldest to the most recent,
+  // leaving some cells empty
+  std::vector<std::array<int64_t, 4>> fragments = {
+      {{2, 7, 3, 9}}, {{5, 10, 1, 4}}, {{1, 3, 1, 10}}, {{6, 6, 5, 6}}};
+  std::vector<int> expected(100, std::numeric_limits<int>::min());
+  for (size_t f = 0; f < fragments.size(); ++f) {
+    auto& subarray = fragments[f];
+    std::vector<int> buffer;
+    for (auto r = subarray[0]; r <= subarray[1]; ++r) {
+      for (auto c = subarray[2]; c <= subarray[3]; ++c) {
+        auto value = (int)((f + 1) * 10000 + r * 100 + c);
+        buffer.push_back(value);
+        expected[(r - 1) * 10 + (c - 1)] = value;
+      }
+    }
+    uint64_t buffer_sizes[] = {buffer.size() * sizeof(int)};
+    write_dense_subarray_2D(
+        array_name,
+        &subarray[0],
+        TILEDB_WRITE,
+        TILEDB_ROW_MAJOR,
+        &buffer[0],
+        buffer_sizes);
+  }
+
+  // Read subarrays in both the cell order and the other layout
+  std::vector<std::array<int64_t, 4>> subarrays = {{{1, 10, 1, 10}},
+                                                   {{2, 9, 2, 8}}};
+  for (const auto& subarray : subarrays) {
+    for (auto layout : {TILEDB_ROW_MAJOR, TILEDB_COL_MAJOR}) {
+      auto buffer = read_dense_array_2D(
+          array_name,
+          subarray[0],
+          subarray[1],
+          subarray[2],
+          subarray[3],
+          TILEDB_READ,
+          layout);
+      REQUIRE(buffer != nullptr);
+      int i = 0;
+      bool match = true;
+      auto rows = subarray[1] - subarray[0] + 1;
+      auto cols = subarray[3] - subarray[2] + 1;
+      for (int64_t j = 0; j < rows * cols; ++j) {
+        auto r = (layout == TILEDB_ROW_MAJOR) ? j / cols : j % rows;
+        auto c = (layout == TILEDB_ROW_MAJOR) ? j % cols : j / rows;
+        auto e = expected[(subarray[0] + r - 1) * 10 + (subarray[2] + c - 1)];
+        match = match && (buffer[i++] == e);
+      }
+      CHECK(match);
+      delete[] buffer;
+    }
+  }
+
+  remove_temp_dir(temp_dir);
+}
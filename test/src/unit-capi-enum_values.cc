@@ -89,6 +89,7 @@ TEST_CASE("C API: Test enum values", "[capi], [enums]") {
   REQUIRE(TILEDB_COL_MAJOR == 1);
   REQUIRE(TILEDB_GLOBAL_ORDER == 2);
   REQUIRE(TILEDB_UNORDERED == 3);
+  REQUIRE(TILEDB_HILBERT == 4);
 
   /** Compressor type */
   REQUIRE(TILEDB_NO_COMPRESSION == 0);
@@ -133,6 +134,25 @@ TEST_CASE("C API: Test enum values", "[capi], [enums]") {
   REQUIRE(TILEDB_PREORDER == 0);
   REQUIRE(TILEDB_POSTORDER == 1);
 
+  /** Query condition op */
+  REQUIRE(TILEDB_LT == 0);
+  REQUIRE(TILEDB_LE == 1);
+  REQUIRE(TILEDB_GT == 2);
+  REQUIRE(TILEDB_GE == 3);
+  REQUIRE(TILEDB_EQ == 4);
+  REQUIRE(TILEDB_NE == 5);
+
+  /** Query condition combination op */
+  REQUIRE(TILEDB_AND == 0);
+  REQUIRE(TILEDB_OR == 1);
+
+  /** Aggregate op */
+  REQUIRE(TILEDB_AGGREGATE_COUNT == 0);
+  REQUIRE(TILEDB_AGGREGATE_SUM == 1);
+  REQUIRE(TILEDB_AGGREGATE_MIN == 2);
+  REQUIRE(TILEDB_AGGREGATE_MAX == 3);
+  REQUIRE(TILEDB_AGGREGATE_MEAN == 4);
+
   /** VFS mode */
   REQUIRE(TILEDB_VFS_READ == 0);
   REQUIRE(TILEDB_VFS_WRITE == 1);
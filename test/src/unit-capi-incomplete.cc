@@ -46,6 +46,8 @@ struct IncompleteFx {
   // Constants
   const char* DENSE_ARRAY_NAME = "test_async_dense";
   const char* SPARSE_ARRAY_NAME = "test_async_sparse";
+  const char* DENSE_SKEWED_ARRAY_NAME = "test_async_dense_skewed";
+  const char* SPARSE_SKEWED_ARRAY_NAME = "test_async_sparse_skewed";
 
   // TileDB context
   tiledb_ctx_t* ctx_;
@@ -69,6 +71,11 @@ struct IncompleteFx {
   void check_sparse_until_complete();
   void check_sparse_unsplittable_overflow();
   void check_sparse_unsplittable_complete();
+  void create_skewed_array(const char* array_name, tiledb_array_type_t type);
+  void write_dense_skewed();
+  void write_sparse_skewed();
+  void check_dense_resume_overflow();
+  void check_sparse_resume_overflow();
   void remove_dense_array();
   void remove_sparse_array();
   void remove_array(const std::string& array_name);
@@ -1089,6 +1096,338 @@ void IncompleteFx::check_sparse_unsplittable_complete() {
   tiledb_query_free(&query);
 }
 
+void IncompleteFx::create_skewed_array(
+    const char* array_name, tiledb_array_type_t type) {
+  // Create dimension
+  uint64_t dim_domain[] = {1, 100};
+  uint64_t tile_extent = 100;
+  tiledb_dimension_t* d;
+  int rc = tiledb_dimension_alloc(
+      ctx_, "d", TILEDB_UINT64, &dim_domain[0], &tile_extent, &d);
+  CHECK(rc == TILEDB_OK);
+
+  // Create domain
+  tiledb_domain_t* domain;
+  rc = tiledb_domain_alloc(ctx_, &domain);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_domain_add_dimension(ctx_, domain, d);
+  CHECK(rc == TILEDB_OK);
+
+  // Create attributes
+  tiledb_attribute_t* a1;
+  rc = tiledb_attribute_alloc(ctx_, "a1", TILEDB_INT32, &a1);
+  CHECK(rc == TILEDB_OK);
+  tiledb_attribute_t* a2;
+  rc = tiledb_attribute_alloc(ctx_, "a2", TILEDB_CHAR, &a2);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_attribute_set_cell_val_num(ctx_, a2, TILEDB_VAR_NUM);
+  CHECK(rc == TILEDB_OK);
+
+  // Create array schema
+  tiledb_array_schema_t* array_schema;
+  rc = tiledb_array_schema_alloc(ctx_, type, &array_schema);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_schema_set_capacity(ctx_, array_schema, 10);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_schema_set_domain(ctx_, array_schema, domain);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_schema_add_attribute(ctx_, array_schema, a1);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_schema_add_attribute(ctx_, array_schema, a2);
+  CHECK(rc == TILEDB_OK);
+
+  // Create array
+  rc = tiledb_array_create(ctx_, array_name, array_schema);
+  CHECK(rc == TILEDB_OK);
+
+  // Clean up
+  tiledb_attribute_free(&a1);
+  tiledb_attribute_free(&a2);
+  tiledb_dimension_free(&d);
+  tiledb_domain_free(&domain);
+  tiledb_array_schema_free(&array_schema);
+}
+
+void IncompleteFx::write_dense_skewed() {
+  // Prepare cell buffers - the var-sized values are much larger at the
+  // end of the domain, so that the estimated result sizes are too small
+  std::vector<int> buffer_a1(100);
+  std::vector<uint64_t> buffer_a2(100);
+  std::string buffer_var_a2;
+  for (int i = 0; i < 100; ++i) {
+    buffer_a1[i] = i + 1;
+    buffer_a2[i] = buffer_var_a2.size();
+    buffer_var_a2 += std::string(i < 95 ? 1 : 20, 'a' + (i % 26));
+  }
+  uint64_t buffer_sizes[] = {buffer_a1.size() * sizeof(int),
+                             buffer_a2.size() * sizeof(uint64_t),
+                             buffer_var_a2.size()};
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, DENSE_SKEWED_ARRAY_NAME, &array);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_WRITE);
+  CHECK(rc == TILEDB_OK);
+
+  // Create and submit query
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(
+      ctx_, query, "a1", &buffer_a1[0], &buffer_sizes[0]);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer_var(
+      ctx_,
+      query,
+      "a2",
+      &buffer_a2[0],
+      &buffer_sizes[1],
+      &buffer_var_a2[0],
+      &buffer_sizes[2]);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_finalize(ctx_, query);
+  CHECK(rc == TILEDB_OK);
+
+  // Close array
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+
+  // Clean up
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+}
+
+void IncompleteFx::write_sparse_skewed() {
+  // Prepare cell buffers - the cells are clustered at the beginning
+  // of the domain, so that the estimated result sizes are too small
+  int buffer_a1[] = {1, 2, 3, 4, 5, 6};
+  uint64_t buffer_a2[] = {0, 1, 3, 6, 10, 15};
+  char buffer_var_a2[] = "abbcccddddeeeeef";
+  uint64_t buffer_coords[] = {1, 2, 3, 4, 5, 100};
+  uint64_t buffer_sizes[] = {sizeof(buffer_a1),
+                             sizeof(buffer_a2),
+                             sizeof(buffer_var_a2) - 1,
+                             sizeof(buffer_coords)};
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, SPARSE_SKEWED_ARRAY_NAME, &array);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_WRITE);
+  CHECK(rc == TILEDB_OK);
+
+  // Create and submit query
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_layout(ctx_, query, TILEDB_UNORDERED);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(ctx_, query, "a1", buffer_a1, &buffer_sizes[0]);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer_var(
+      ctx_,
+      query,
+      "a2",
+      buffer_a2,
+      &buffer_sizes[1],
+      buffer_var_a2,
+      &buffer_sizes[2]);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(
+      ctx_, query, TILEDB_COORDS, buffer_coords, &buffer_sizes[3]);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_finalize(ctx_, query);
+  CHECK(rc == TILEDB_OK);
+
+  // Close array
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+
+  // Clean up
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+}
+
+void IncompleteFx::check_dense_resume_overflow() {
+  // Initialize a subarray
+  const uint64_t subarray[] = {93, 97};
+
+  // Prepare the buffers that will store the result
+  uint64_t buffer_a2[5];
+  char buffer_a2_var[24];
+  uint64_t buffer_coords[5];
+  uint64_t buffer_sizes[] = {
+      sizeof(buffer_a2), sizeof(buffer_a2_var), sizeof(buffer_coords)};
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, DENSE_SKEWED_ARRAY_NAME, &array);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  CHECK(rc == TILEDB_OK);
+
+  // Create query
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer_var(
+      ctx_,
+      query,
+      "a2",
+      buffer_a2,
+      &buffer_sizes[0],
+      buffer_a2_var,
+      &buffer_sizes[1]);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(
+      ctx_, query, TILEDB_COORDS, buffer_coords, &buffer_sizes[2]);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_subarray(ctx_, query, subarray);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Submit query - only the first 4 cells fit in the buffers
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_status_t status;
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  CHECK(rc == TILEDB_OK);
+  CHECK(status == TILEDB_INCOMPLETE);
+  uint64_t c_buffer_a2[] = {0, 1, 2, 3};
+  uint64_t c_buffer_coords[] = {93, 94, 95, 96};
+  CHECK(buffer_sizes[0] == sizeof(c_buffer_a2));
+  CHECK(buffer_sizes[1] == 23);
+  CHECK(buffer_sizes[2] == sizeof(c_buffer_coords));
+  CHECK(!memcmp(buffer_a2, c_buffer_a2, sizeof(c_buffer_a2)));
+  CHECK(!memcmp(buffer_coords, c_buffer_coords, sizeof(c_buffer_coords)));
+  CHECK(std::string(buffer_a2_var, 23) == "opq" + std::string(20, 'r'));
+
+  // Resubmit - the last cell is retrieved
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  CHECK(rc == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(buffer_sizes[0] == sizeof(uint64_t));
+  CHECK(buffer_sizes[1] == 20);
+  CHECK(buffer_sizes[2] == sizeof(uint64_t));
+  CHECK(buffer_a2[0] == 0);
+  CHECK(buffer_coords[0] == 97);
+  CHECK(std::string(buffer_a2_var, 20) == std::string(20, 's'));
+
+  // Finalize query
+  rc = tiledb_query_finalize(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Close array
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+
+  // Clean up
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+}
+
+void IncompleteFx::check_sparse_resume_overflow() {
+  // Initialize a subarray
+  const uint64_t subarray[] = {1, 10};
+
+  // Prepare the buffers that will store the result
+  int buffer_a1[4];
+  uint64_t buffer_a2[4];
+  char buffer_a2_var[8];
+  uint64_t buffer_sizes[] = {
+      sizeof(buffer_a1), sizeof(buffer_a2), sizeof(buffer_a2_var)};
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, SPARSE_SKEWED_ARRAY_NAME, &array);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  CHECK(rc == TILEDB_OK);
+
+  // Create query
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(ctx_, query, "a1", buffer_a1, &buffer_sizes[0]);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer_var(
+      ctx_,
+      query,
+      "a2",
+      buffer_a2,
+      &buffer_sizes[1],
+      buffer_a2_var,
+      &buffer_sizes[2]);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_subarray(ctx_, query, subarray);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_layout(ctx_, query, TILEDB_GLOBAL_ORDER);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Submit query - the var-sized values of the first 3 cells fit
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_status_t status;
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  CHECK(rc == TILEDB_OK);
+  CHECK(status == TILEDB_INCOMPLETE);
+  int c_buffer_a1[] = {1, 2, 3};
+  uint64_t c_buffer_a2[] = {0, 1, 3};
+  CHECK(buffer_sizes[0] == sizeof(c_buffer_a1));
+  CHECK(buffer_sizes[1] == sizeof(c_buffer_a2));
+  CHECK(buffer_sizes[2] == 6);
+  CHECK(!memcmp(buffer_a1, c_buffer_a1, sizeof(c_buffer_a1)));
+  CHECK(!memcmp(buffer_a2, c_buffer_a2, sizeof(c_buffer_a2)));
+  CHECK(!memcmp(buffer_a2_var, "abbccc", 6));
+
+  // Resubmit - the next cell fits
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  CHECK(rc == TILEDB_OK);
+  CHECK(status == TILEDB_INCOMPLETE);
+  CHECK(buffer_sizes[0] == sizeof(int));
+  CHECK(buffer_sizes[1] == sizeof(uint64_t));
+  CHECK(buffer_sizes[2] == 4);
+  CHECK(buffer_a1[0] == 4);
+  CHECK(buffer_a2[0] == 0);
+  CHECK(!memcmp(buffer_a2_var, "dddd", 4));
+
+  // Resubmit - the last cell is retrieved
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  CHECK(rc == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(buffer_sizes[0] == sizeof(int));
+  CHECK(buffer_sizes[1] == sizeof(uint64_t));
+  CHECK(buffer_sizes[2] == 5);
+  CHECK(buffer_a1[0] == 5);
+  CHECK(!memcmp(buffer_a2_var, "eeeee", 5));
+
+  // Finalize query
+  rc = tiledb_query_finalize(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Close array
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+
+  // Clean up
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+}
+
 TEST_CASE_METHOD(
     IncompleteFx,
     "C API: Test incomplete read queries, dense",
@@ -1118,3 +1457,20 @@ TEST_CASE_METHOD(
   check_sparse_unsplittable_complete();
   remove_sparse_array();
 }
+
+TEST_CASE_METHOD(
+    IncompleteFx,
+    "C API: Test incomplete read queries, resume on overflow",
+    "[capi], [incomplete], [incomplete-resume]") {
+  remove_array(DENSE_SKEWED_ARRAY_NAME);
+  create_skewed_array(DENSE_SKEWED_ARRAY_NAME, TILEDB_DENSE);
+  write_dense_skewed();
+  check_dense_resume_overflow();
+  remove_array(DENSE_SKEWED_ARRAY_NAME);
+
+  remove_array(SPARSE_SKEWED_ARRAY_NAME);
+  create_skewed_array(SPARSE_SKEWED_ARRAY_NAME, TILEDB_SPARSE);
+  write_sparse_skewed();
+  check_sparse_resume_overflow();
+  remove_array(SPARSE_SKEWED_ARRAY_NAME);
+}
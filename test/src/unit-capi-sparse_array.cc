@@ -38,17 +38,23 @@
 #include "tiledb/sm/filesystem/posix.h"
 #endif
 #include "tiledb/sm/c_api/tiledb.h"
+#include "tiledb/sm/misc/hilbert.h"
+#include "tiledb/sm/misc/stats.h"
 #include "tiledb/sm/misc/utils.h"
 
 #include "test/src/helpers.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstring>
 #include <ctime>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <thread>
+#include <tuple>
 
 struct SparseArrayFx {
   // Constant parameters
@@ -190,6 +196,100 @@ struct SparseArrayFx {
       const int64_t domain_size_0,
       const int64_t domain_size_1);
 
+  /**
+   * Writes cells with the input "a1" values and coordinates to the array
+   * created by `create_sparse_array`, in a new unordered fragment. Every
+   * cell gets "z" for "a2" and {0.1, 0.2} for "a3".
+   *
+   * @param array_name The array name.
+   * @param a1 The "a1" values.
+   * @param coords The coordinates.
+   */
+  void write_sparse_cells(
+      const std::string& array_name,
+      const std::vector<int>& a1,
+      const std::vector<uint64_t>& coords);
+
+  /**
+   * Reads "a1" and the coordinates of the array created by
+   * `create_sparse_array` with a single submission, which must complete.
+   *
+   * @param array_name The array name.
+   * @param layout The read layout.
+   * @param subarray The subarray, or `nullptr` for the whole domain.
+   * @param cond The query condition, or `nullptr` for no condition.
+   * @param a1 The "a1" values to be retrieved.
+   * @param coords The coordinates to be retrieved.
+   */
+  void read_sparse_cells(
+      const std::string& array_name,
+      tiledb_layout_t layout,
+      const uint64_t* subarray,
+      tiledb_query_condition_t* cond,
+      std::vector<int>* a1,
+      std::vector<uint64_t>* coords);
+
+  /**
+   * Generates cells for the array created by `create_sparse_array_2D`,
+   * one every 10 coordinates of the first dimension, with values
+   * 0, 1, 2, ... in that order.
+   *
+   * @param cell_num The number of cells.
+   * @param a The attribute values to be generated.
+   * @param coords The coordinates to be generated.
+   */
+  void generate_strided_cells_2D(
+      uint64_t cell_num, std::vector<int>* a, std::vector<int64_t>* coords);
+
+  /**
+   * Writes cells to the array created by `create_sparse_array_2D` with a
+   * single submission. Global order writes are finalized.
+   *
+   * @param ctx The context.
+   * @param array_name The array name.
+   * @param layout The write layout.
+   * @param a The attribute values.
+   * @param coords The coordinates.
+   */
+  void write_sparse_cells_2D(
+      tiledb_ctx_t* ctx,
+      const std::string& array_name,
+      tiledb_layout_t layout,
+      const std::vector<int>& a,
+      const std::vector<int64_t>& coords);
+
+  /**
+   * Reads all the cells of the array created by `create_sparse_array_2D`,
+   * submitting the query with buffers of the input number of cells until
+   * it completes.
+   *
+   * @param ctx The context.
+   * @param array_name The array name.
+   * @param layout The read layout.
+   * @param buffer_cell_num The number of cells that the buffers fit.
+   * @param a The attribute values to be retrieved.
+   * @param coords The coordinates to be retrieved.
+   * @param result_nums If not `nullptr`, the number of results of every
+   *     submission is retrieved here.
+   */
+  void read_sparse_cells_2D(
+      tiledb_ctx_t* ctx,
+      const std::string& array_name,
+      tiledb_layout_t layout,
+      uint64_t buffer_cell_num,
+      std::vector<int>* a,
+      std::vector<int64_t>* coords,
+      std::vector<uint64_t>* result_nums = nullptr);
+
+  /**
+   * Allocates a context with the input config parameters.
+   *
+   * @param params The config parameters, as (name, value) pairs.
+   * @return The context, which the caller must free.
+   */
+  tiledb_ctx_t* alloc_ctx(
+      const std::vector<std::pair<std::string, std::string>>& params);
+
   void test_random_subarrays(
       const std::string& array_name,
       int64_t domain_size_0,
@@ -553,6 +653,92 @@ void SparseArrayFx::write_sparse_array(const std::string& array_name) {
   tiledb_query_free(&query);
 }
 
+void SparseArrayFx::write_sparse_cells(
+    const std::string& array_name,
+    const std::vector<int>& a1,
+    const std::vector<uint64_t>& coords) {
+  std::vector<uint64_t> a2_off;
+  std::vector<float> a3;
+  for (size_t i = 0; i < a1.size(); ++i) {
+    a2_off.push_back(i);
+    a3.push_back(0.1f);
+    a3.push_back(0.2f);
+  }
+  std::string a2(a1.size(), 'z');
+  uint64_t a1_size = a1.size() * sizeof(int);
+  uint64_t a2_off_size = a2_off.size() * sizeof(uint64_t);
+  uint64_t a2_size = a2.size();
+  uint64_t a3_size = a3.size() * sizeof(float);
+  uint64_t coords_size = coords.size() * sizeof(uint64_t);
+
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_WRITE) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_UNORDERED) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx_, query, "a1", (void*)&a1[0], &a1_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer_var(
+          ctx_, query, "a2", &a2_off[0], &a2_off_size, &a2[0], &a2_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx_, query, "a3", &a3[0], &a3_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, TILEDB_COORDS, (void*)&coords[0], &coords_size) ==
+      TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
+void SparseArrayFx::read_sparse_cells(
+    const std::string& array_name,
+    tiledb_layout_t layout,
+    const uint64_t* subarray,
+    tiledb_query_condition_t* cond,
+    std::vector<int>* a1,
+    std::vector<uint64_t>* coords) {
+  // The array has at most 16 cells
+  a1->resize(16);
+  coords->resize(32);
+  uint64_t a1_size = a1->size() * sizeof(int);
+  uint64_t coords_size = coords->size() * sizeof(uint64_t);
+
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, layout) == TILEDB_OK);
+  if (subarray != nullptr)
+    CHECK(tiledb_query_set_subarray(ctx_, query, subarray) == TILEDB_OK);
+  if (cond != nullptr)
+    CHECK(tiledb_query_set_condition(ctx_, query, cond) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx_, query, "a1", &(*a1)[0], &a1_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, TILEDB_COORDS, &(*coords)[0], &coords_size) ==
+      TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  tiledb_query_status_t status;
+  CHECK(tiledb_query_get_status(ctx_, query, &status) == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  a1->resize(a1_size / sizeof(int));
+  coords->resize(coords_size / sizeof(uint64_t));
+}
+
 void SparseArrayFx::write_sparse_array_unsorted_2D(
     const std::string& array_name,
     const int64_t domain_size_0,
@@ -632,6 +818,112 @@ void SparseArrayFx::write_sparse_array_unsorted_2D(
   delete[] buffer_coords;
 }
 
+void SparseArrayFx::generate_strided_cells_2D(
+    uint64_t cell_num, std::vector<int>* a, std::vector<int64_t>* coords) {
+  a->clear();
+  coords->clear();
+  for (uint64_t i = 0; i < cell_num; ++i) {
+    a->push_back((int)i);
+    coords->push_back(10 * (int64_t)i + 1);
+    coords->push_back(1);
+  }
+}
+
+void SparseArrayFx::write_sparse_cells_2D(
+    tiledb_ctx_t* ctx,
+    const std::string& array_name,
+    tiledb_layout_t layout,
+    const std::vector<int>& a,
+    const std::vector<int64_t>& coords) {
+  uint64_t a_size = a.size() * sizeof(int);
+  uint64_t coords_size = coords.size() * sizeof(int64_t);
+
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx, array, TILEDB_WRITE) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx, query, layout) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, ATTR_NAME.c_str(), (void*)&a[0], &a_size) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, TILEDB_COORDS, (void*)&coords[0], &coords_size) ==
+      TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx, query) == TILEDB_OK);
+  if (layout == TILEDB_GLOBAL_ORDER)
+    CHECK(tiledb_query_finalize(ctx, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
+void SparseArrayFx::read_sparse_cells_2D(
+    tiledb_ctx_t* ctx,
+    const std::string& array_name,
+    tiledb_layout_t layout,
+    uint64_t buffer_cell_num,
+    std::vector<int>* a,
+    std::vector<int64_t>* coords,
+    std::vector<uint64_t>* result_nums) {
+  a->clear();
+  coords->clear();
+
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx, query, layout) == TILEDB_OK);
+  std::vector<int> r_a(buffer_cell_num);
+  std::vector<int64_t> r_coords(2 * buffer_cell_num);
+  tiledb_query_status_t status;
+  do {
+    uint64_t r_a_size = r_a.size() * sizeof(int);
+    uint64_t r_coords_size = r_coords.size() * sizeof(int64_t);
+    CHECK(
+        tiledb_query_set_buffer(
+            ctx, query, ATTR_NAME.c_str(), &r_a[0], &r_a_size) == TILEDB_OK);
+    CHECK(
+        tiledb_query_set_buffer(
+            ctx, query, TILEDB_COORDS, &r_coords[0], &r_coords_size) ==
+        TILEDB_OK);
+    REQUIRE(tiledb_query_submit(ctx, query) == TILEDB_OK);
+    REQUIRE(tiledb_query_get_status(ctx, query, &status) == TILEDB_OK);
+    auto result_num = r_a_size / sizeof(int);
+    CHECK(r_coords_size == result_num * 2 * sizeof(int64_t));
+    a->insert(a->end(), r_a.begin(), r_a.begin() + result_num);
+    coords->insert(
+        coords->end(), r_coords.begin(), r_coords.begin() + 2 * result_num);
+    if (result_nums != nullptr)
+      result_nums->push_back(result_num);
+  } while (status == TILEDB_INCOMPLETE);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
+tiledb_ctx_t* SparseArrayFx::alloc_ctx(
+    const std::vector<std::pair<std::string, std::string>>& params) {
+  tiledb_config_t* config = nullptr;
+  tiledb_error_t* error = nullptr;
+  REQUIRE(tiledb_config_alloc(&config, &error) == TILEDB_OK);
+  REQUIRE(error == nullptr);
+  for (const auto& param : params) {
+    REQUIRE(
+        tiledb_config_set(
+            config, param.first.c_str(), param.second.c_str(), &error) ==
+        TILEDB_OK);
+    REQUIRE(error == nullptr);
+  }
+  tiledb_ctx_t* ctx = nullptr;
+  REQUIRE(tiledb_ctx_alloc(config, &ctx) == TILEDB_OK);
+  tiledb_config_free(&config);
+  return ctx;
+}
+
 void SparseArrayFx::test_random_subarrays(
     const std::string& array_name,
     int64_t domain_size_0,
@@ -2770,4 +3062,1421 @@ TEST_CASE_METHOD(
     check_sorted_reads(
         array_name, TILEDB_FILTER_BZIP2, TILEDB_ROW_MAJOR, TILEDB_COL_MAJOR);
   }
-}
\ No newline at end of file
+}
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, read with a small in-flight tile budget",
+    "[capi], [sparse], [sparse-read-inflight]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_read_inflight";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Create a context that streams a single tile at a time
+  tiledb_ctx_t* ctx = alloc_ctx(
+      {{"sm.read_inflight_size", "1"}, {"sm.num_reader_threads", "2"}});
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx, array_name.c_str(), &array);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx, array, TILEDB_READ);
+  CHECK(rc == TILEDB_OK);
+
+  // Create query
+  int a1[8];
+  uint64_t a1_size = sizeof(a1);
+  uint64_t a2_off[8];
+  uint64_t a2_off_size = sizeof(a2_off);
+  char a2[20];
+  uint64_t a2_size = sizeof(a2);
+  float a3[16];
+  uint64_t a3_size = sizeof(a3);
+  uint64_t coords[16];
+  uint64_t coords_size = sizeof(coords);
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx, array, TILEDB_READ, &query);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_layout(ctx, query, TILEDB_ROW_MAJOR);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(ctx, query, "a1", a1, &a1_size);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer_var(
+      ctx, query, "a2", a2_off, &a2_off_size, a2, &a2_size);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(ctx, query, "a3", a3, &a3_size);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_buffer(ctx, query, TILEDB_COORDS, coords, &coords_size);
+  CHECK(rc == TILEDB_OK);
+
+  // Submit query
+  rc = tiledb_query_submit(ctx, query);
+  CHECK(rc == TILEDB_OK);
+  tiledb_query_status_t status;
+  rc = tiledb_query_get_status(ctx, query, &status);
+  CHECK(rc == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+
+  // Check results
+  int c_a1[] = {0, 1, 2, 3, 4, 6, 7, 5};
+  uint64_t c_a2_off[] = {0, 1, 3, 6, 10, 11, 14, 18};
+  char c_a2[] = "abbcccddddeggghhhhff";
+  float c_a3[] = {0.1f,
+                  0.2f,
+                  1.1f,
+                  1.2f,
+                  2.1f,
+                  2.2f,
+                  3.1f,
+                  3.2f,
+                  4.1f,
+                  4.2f,
+                  6.1f,
+                  6.2f,
+                  7.1f,
+                  7.2f,
+                  5.1f,
+                  5.2f};
+  uint64_t c_coords[] = {1, 1, 1, 2, 1, 4, 2, 3, 3, 1, 3, 3, 3, 4, 4, 2};
+  CHECK(a1_size == sizeof(c_a1));
+  CHECK(!memcmp(a1, c_a1, sizeof(c_a1)));
+  CHECK(a2_off_size == sizeof(c_a2_off));
+  CHECK(!memcmp(a2_off, c_a2_off, sizeof(c_a2_off)));
+  CHECK(a2_size == sizeof(c_a2) - 1);
+  CHECK(!memcmp(a2, c_a2, sizeof(c_a2) - 1));
+  CHECK(a3_size == sizeof(c_a3));
+  CHECK(!memcmp(a3, c_a3, sizeof(c_a3)));
+  CHECK(coords_size == sizeof(c_coords));
+  CHECK(!memcmp(coords, c_coords, sizeof(c_coords)));
+
+  // Close array
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+
+  // Clean up
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+  tiledb_ctx_free(&ctx);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, global order read over several fragments",
+    "[capi], [sparse], [sparse-merge-fragments]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_merge_fragments";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Write two more fragments, partially overwriting the cells of the older
+  // fragments
+  write_sparse_cells(array_name, {100, 101, 102}, {3, 4, 1, 2, 2, 2});
+  write_sparse_cells(array_name, {201}, {1, 2});
+
+  // The most recent fragment wins for the duplicate coordinates
+  std::vector<int> a1;
+  std::vector<uint64_t> coords;
+  read_sparse_cells(
+      array_name, TILEDB_GLOBAL_ORDER, nullptr, nullptr, &a1, &coords);
+  CHECK(a1 == std::vector<int>({0, 201, 102, 2, 3, 4, 5, 6, 100}));
+  CHECK(
+      coords == std::vector<uint64_t>(
+                    {1, 1, 1, 2, 2, 2, 1, 4, 2, 3, 3, 1, 4, 2, 3, 3, 3, 4}));
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, global order read of a single fragment",
+    "[capi], [sparse], [sparse-single-fragment-global]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_single_fragment_global";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Read a subarray that fully overlaps some tiles, partially overlaps
+  // others and has no results in one of them
+  uint64_t subarray[] = {1, 3, 2, 4};
+  std::vector<int> a1;
+  std::vector<uint64_t> coords;
+  read_sparse_cells(
+      array_name, TILEDB_GLOBAL_ORDER, subarray, nullptr, &a1, &coords);
+  CHECK(a1 == std::vector<int>({1, 2, 3, 6, 7}));
+  CHECK(coords == std::vector<uint64_t>({1, 2, 1, 4, 2, 3, 3, 3, 3, 4}));
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, row-major read within a single space tile",
+    "[capi], [sparse], [sparse-single-fragment-row-major]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_single_fragment_row_major";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Read a subarray in the last space tile, which partially overlaps a
+  // data tile. The row-major layout is the global order in the space tile,
+  // so no coordinates are sorted.
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+  uint64_t subarray[] = {3, 4, 3, 3};
+  std::vector<int> a1;
+  std::vector<uint64_t> coords;
+  read_sparse_cells(
+      array_name, TILEDB_ROW_MAJOR, subarray, nullptr, &a1, &coords);
+  const auto& stats = tiledb::sm::stats::all_stats;
+  CHECK(stats.reader_compute_overlapping_coords_call_count == 0);
+  tiledb_stats_disable();
+
+  CHECK(a1 == std::vector<int>({6}));
+  CHECK(coords == std::vector<uint64_t>({3, 3}));
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, read with query condition",
+    "[capi], [sparse], [sparse-query-condition]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_query_condition";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Create condition "a1 > 2 AND a1 < 7"
+  int32_t low = 2, high = 7;
+  tiledb_query_condition_t *low_cond, *high_cond, *and_cond;
+  int rc = tiledb_query_condition_alloc(ctx_, &low_cond);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_init(
+      ctx_, low_cond, "a1", &low, sizeof(low), TILEDB_GT);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_alloc(ctx_, &high_cond);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_init(
+      ctx_, high_cond, "a1", &high, sizeof(high), TILEDB_LT);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_combine(
+      ctx_, low_cond, high_cond, TILEDB_AND, &and_cond);
+  CHECK(rc == TILEDB_OK);
+
+  // Create condition "a1 <= 0 OR a1 == 7"
+  int32_t zero = 0, seven = 7;
+  tiledb_query_condition_t *zero_cond, *seven_cond, *or_cond;
+  rc = tiledb_query_condition_alloc(ctx_, &zero_cond);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_init(
+      ctx_, zero_cond, "a1", &zero, sizeof(zero), TILEDB_LE);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_alloc(ctx_, &seven_cond);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_init(
+      ctx_, seven_cond, "a1", &seven, sizeof(seven), TILEDB_EQ);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_condition_combine(
+      ctx_, zero_cond, seven_cond, TILEDB_OR, &or_cond);
+  CHECK(rc == TILEDB_OK);
+
+  // Invalid conditions: wrong value size, uninitialized operand
+  tiledb_query_condition_t* invalid_cond;
+  rc = tiledb_query_condition_alloc(ctx_, &invalid_cond);
+  CHECK(rc == TILEDB_OK);
+  tiledb_query_condition_t* combined_cond = nullptr;
+  rc = tiledb_query_condition_combine(
+      ctx_, low_cond, invalid_cond, TILEDB_AND, &combined_cond);
+  CHECK(rc == TILEDB_ERR);
+  CHECK(combined_cond == nullptr);
+  rc = tiledb_query_condition_init(
+      ctx_, invalid_cond, "a1", &low, sizeof(uint64_t), TILEDB_GT);
+  CHECK(rc == TILEDB_OK);
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_condition(ctx_, query, invalid_cond) == TILEDB_ERR);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // Check the condition on a row-major and a global order read
+  uint64_t subarray[] = {1, 4, 1, 4};
+  std::vector<int> a1;
+  std::vector<uint64_t> coords;
+  read_sparse_cells(
+      array_name, TILEDB_ROW_MAJOR, subarray, and_cond, &a1, &coords);
+  CHECK(a1 == std::vector<int>({3, 4, 6, 5}));
+  CHECK(coords == std::vector<uint64_t>({2, 3, 3, 1, 3, 3, 4, 2}));
+  read_sparse_cells(
+      array_name, TILEDB_GLOBAL_ORDER, subarray, or_cond, &a1, &coords);
+  CHECK(a1 == std::vector<int>({0, 7}));
+  CHECK(coords == std::vector<uint64_t>({1, 1, 3, 4}));
+
+  // Clean up
+  tiledb_query_condition_free(&low_cond);
+  tiledb_query_condition_free(&high_cond);
+  tiledb_query_condition_free(&and_cond);
+  tiledb_query_condition_free(&zero_cond);
+  tiledb_query_condition_free(&seven_cond);
+  tiledb_query_condition_free(&or_cond);
+  tiledb_query_condition_free(&invalid_cond);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, read with multiple ranges",
+    "[capi], [sparse], [sparse-multi-range]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_multi_range";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Open array
+  tiledb_array_t* array;
+  int rc = tiledb_array_alloc(ctx_, array_name.c_str(), &array);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  CHECK(rc == TILEDB_OK);
+
+  // Check the row-major and the global order layouts
+  tiledb_layout_t layouts[] = {TILEDB_ROW_MAJOR, TILEDB_GLOBAL_ORDER};
+  for (auto layout : layouts) {
+    int a1[8];
+    uint64_t a1_size = sizeof(a1);
+    uint64_t coords[16];
+    uint64_t coords_size = sizeof(coords);
+    tiledb_query_t* query;
+    rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &query);
+    CHECK(rc == TILEDB_OK);
+    rc = tiledb_query_set_layout(ctx_, query, layout);
+    CHECK(rc == TILEDB_OK);
+    rc = tiledb_query_set_buffer(ctx_, query, "a1", a1, &a1_size);
+    CHECK(rc == TILEDB_OK);
+    rc = tiledb_query_set_buffer(
+        ctx_, query, TILEDB_COORDS, coords, &coords_size);
+    CHECK(rc == TILEDB_OK);
+
+    // Invalid ranges
+    uint64_t invalid[] = {3, 2, 0, 5};
+    rc = tiledb_query_add_range(ctx_, query, 0, &invalid[0], &invalid[1]);
+    CHECK(rc == TILEDB_ERR);
+    rc = tiledb_query_add_range(ctx_, query, 1, &invalid[2], &invalid[1]);
+    CHECK(rc == TILEDB_ERR);
+    rc = tiledb_query_add_range(ctx_, query, 0, &invalid[1], &invalid[3]);
+    CHECK(rc == TILEDB_ERR);
+    rc = tiledb_query_add_range(ctx_, query, 2, &invalid[1], &invalid[0]);
+    CHECK(rc == TILEDB_ERR);
+
+    // Ranges [1,1], [3,4] along both dimensions
+    uint64_t ranges[] = {1, 1, 3, 4};
+    for (uint32_t d = 0; d < 2; ++d) {
+      rc = tiledb_query_add_range(ctx_, query, d, &ranges[0], &ranges[1]);
+      CHECK(rc == TILEDB_OK);
+      rc = tiledb_query_add_range(ctx_, query, d, &ranges[2], &ranges[3]);
+      CHECK(rc == TILEDB_OK);
+    }
+
+    rc = tiledb_query_submit(ctx_, query);
+    CHECK(rc == TILEDB_OK);
+    tiledb_query_status_t status;
+    rc = tiledb_query_get_status(ctx_, query, &status);
+    CHECK(rc == TILEDB_OK);
+    CHECK(status == TILEDB_COMPLETED);
+
+    // Check results
+    int c_a1[] = {0, 2, 4, 6, 7};
+    uint64_t c_coords[] = {1, 1, 1, 4, 3, 1, 3, 3, 3, 4};
+    CHECK(a1_size == sizeof(c_a1));
+    CHECK(!memcmp(a1, c_a1, sizeof(c_a1)));
+    CHECK(coords_size == sizeof(c_coords));
+    CHECK(!memcmp(coords, c_coords, sizeof(c_coords)));
+
+    tiledb_query_free(&query);
+  }
+
+  // Clean up
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_array_free(&array);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, aggregates",
+    "[capi], [sparse], [sparse-aggregate]") {
+  std::string array_name = FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_aggregate";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+
+  // Runs an aggregate query on "a1" and checks the results
+  auto check_aggregates = [&](const uint64_t* subarray,
+                              tiledb_query_condition_t* cond,
+                              uint64_t c_count,
+                              int64_t c_sum,
+                              int c_min,
+                              int c_max) {
+    tiledb_array_t* array;
+    REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+    REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+    tiledb_query_t* query;
+    REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+    if (subarray != nullptr)
+      CHECK(tiledb_query_set_subarray(ctx_, query, subarray) == TILEDB_OK);
+    if (cond != nullptr)
+      CHECK(tiledb_query_set_condition(ctx_, query, cond) == TILEDB_OK);
+    tiledb_aggregate_op_t ops[] = {TILEDB_AGGREGATE_COUNT,
+                                   TILEDB_AGGREGATE_SUM,
+                                   TILEDB_AGGREGATE_MIN,
+                                   TILEDB_AGGREGATE_MAX,
+                                   TILEDB_AGGREGATE_MEAN};
+    for (auto op : ops)
+      CHECK(tiledb_query_add_aggregate(ctx_, query, "a1", op) == TILEDB_OK);
+    CHECK(
+        tiledb_query_add_aggregate(
+            ctx_, query, TILEDB_COORDS, TILEDB_AGGREGATE_COUNT) == TILEDB_OK);
+    CHECK(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+    tiledb_query_status_t status;
+    CHECK(tiledb_query_get_status(ctx_, query, &status) == TILEDB_OK);
+    CHECK(status == TILEDB_COMPLETED);
+
+    uint64_t count = 0, coords_count = 0;
+    int64_t sum = 0;
+    int min = 0, max = 0;
+    double mean = 0;
+    CHECK(
+        tiledb_query_get_aggregate(
+            ctx_, query, "a1", TILEDB_AGGREGATE_COUNT, &count) == TILEDB_OK);
+    CHECK(
+        tiledb_query_get_aggregate(
+            ctx_,
+            query,
+            TILEDB_COORDS,
+            TILEDB_AGGREGATE_COUNT,
+            &coords_count) == TILEDB_OK);
+    CHECK(
+        tiledb_query_get_aggregate(
+            ctx_, query, "a1", TILEDB_AGGREGATE_SUM, &sum) == TILEDB_OK);
+    CHECK(
+        tiledb_query_get_aggregate(
+            ctx_, query, "a1", TILEDB_AGGREGATE_MIN, &min) == TILEDB_OK);
+    CHECK(
+        tiledb_query_get_aggregate(
+            ctx_, query, "a1", TILEDB_AGGREGATE_MAX, &max) == TILEDB_OK);
+    CHECK(
+        tiledb_query_get_aggregate(
+            ctx_, query, "a1", TILEDB_AGGREGATE_MEAN, &mean) == TILEDB_OK);
+    CHECK(count == c_count);
+    CHECK(coords_count == c_count);
+    CHECK(sum == c_sum);
+    CHECK(min == c_min);
+    CHECK(max == c_max);
+    CHECK(mean == (double)c_sum / c_count);
+
+    CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+    tiledb_query_free(&query);
+    tiledb_array_free(&array);
+  };
+
+  // Whole domain
+  check_aggregates(nullptr, nullptr, 8, 28, 0, 7);
+
+  // Subarray and condition "a1 > 4"
+  uint64_t subarray[] = {3, 4, 1, 4};
+  int32_t four = 4;
+  tiledb_query_condition_t* cond;
+  REQUIRE(tiledb_query_condition_alloc(ctx_, &cond) == TILEDB_OK);
+  CHECK(
+      tiledb_query_condition_init(
+          ctx_, cond, "a1", &four, sizeof(four), TILEDB_GT) == TILEDB_OK);
+  check_aggregates(subarray, cond, 3, 18, 5, 7);
+  tiledb_query_condition_free(&cond);
+
+  // Errors
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(
+      tiledb_query_add_aggregate(ctx_, query, "a2", TILEDB_AGGREGATE_SUM) ==
+      TILEDB_ERR);
+  CHECK(
+      tiledb_query_add_aggregate(ctx_, query, "foo", TILEDB_AGGREGATE_COUNT) ==
+      TILEDB_ERR);
+  CHECK(
+      tiledb_query_add_aggregate(
+          ctx_, query, TILEDB_COORDS, TILEDB_AGGREGATE_MIN) == TILEDB_ERR);
+  CHECK(
+      tiledb_query_add_aggregate(ctx_, query, "a2", TILEDB_AGGREGATE_COUNT) ==
+      TILEDB_OK);
+  uint64_t a2_count;
+  CHECK(
+      tiledb_query_get_aggregate(
+          ctx_, query, "a1", TILEDB_AGGREGATE_COUNT, &a2_count) == TILEDB_ERR);
+  int a1[8];
+  uint64_t a1_size = sizeof(a1);
+  CHECK(tiledb_query_set_buffer(ctx_, query, "a1", a1, &a1_size) == TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx_, query) == TILEDB_ERR);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // Overwrite cell (1, 1) and add cell (2, 2) in a new fragment; the
+  // duplicate coordinates are counted once
+  write_sparse_cells(array_name, {10, 20}, {1, 1, 2, 2});
+  check_aggregates(nullptr, nullptr, 9, 58, 1, 20);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, tile statistics",
+    "[capi], [sparse], [sparse-tile-stats]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_tile_stats";
+  create_sparse_array(array_name);
+  write_sparse_array(array_name);
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+
+  // Reads "a1" in row-major order with condition "a1 <op> value"
+  auto read_a1 = [&](int32_t value, tiledb_query_condition_op_t op) {
+    tiledb_query_condition_t* cond;
+    REQUIRE(tiledb_query_condition_alloc(ctx_, &cond) == TILEDB_OK);
+    CHECK(
+        tiledb_query_condition_init(
+            ctx_, cond, "a1", &value, sizeof(value), op) == TILEDB_OK);
+    std::vector<int> a1;
+    std::vector<uint64_t> coords;
+    read_sparse_cells(
+        array_name, TILEDB_ROW_MAJOR, nullptr, cond, &a1, &coords);
+    tiledb_query_condition_free(&cond);
+    return a1;
+  };
+
+  // The four tiles hold a1 values {0, 1}, {2, 3}, {4, 5} and {6, 7}, thus
+  // only the last tile may satisfy "a1 >= 6"
+  CHECK(read_a1(6, TILEDB_GE) == std::vector<int>({6, 7}));
+  CHECK(
+      tiledb::sm::stats::all_stats
+          .counter_reader_num_tiles_skipped_by_condition == 3);
+
+  // The aggregates of the fully overlapping tiles come from the metadata
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(
+      tiledb_query_add_aggregate(ctx_, query, "a1", TILEDB_AGGREGATE_SUM) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_add_aggregate(ctx_, query, "a1", TILEDB_AGGREGATE_MIN) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_add_aggregate(ctx_, query, "a3", TILEDB_AGGREGATE_COUNT) ==
+      TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  int64_t sum = 0;
+  int min = -1;
+  uint64_t count = 0;
+  CHECK(
+      tiledb_query_get_aggregate(
+          ctx_, query, "a1", TILEDB_AGGREGATE_SUM, &sum) == TILEDB_OK);
+  CHECK(
+      tiledb_query_get_aggregate(
+          ctx_, query, "a1", TILEDB_AGGREGATE_MIN, &min) == TILEDB_OK);
+  CHECK(
+      tiledb_query_get_aggregate(
+          ctx_, query, "a3", TILEDB_AGGREGATE_COUNT, &count) == TILEDB_OK);
+  CHECK(sum == 28);
+  CHECK(min == 0);
+  CHECK(count == 8);
+  CHECK(
+      tiledb::sm::stats::all_stats
+          .counter_reader_num_tiles_aggregated_from_metadata == 4);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // Overwrite cell (1, 1) with a1 = 100 in a new fragment
+  write_sparse_cells(array_name, {100}, {1, 1});
+
+  // The new tile cannot satisfy "a1 <= 0", but it must not be skipped,
+  // since it overwrites the only older cell that does
+  CHECK(read_a1(0, TILEDB_LE).empty());
+  CHECK(read_a1(100, TILEDB_EQ) == std::vector<int>({100}));
+
+  tiledb_stats_disable();
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, tile statistics with NaN values",
+    "[capi], [sparse], [sparse-tile-stats]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_tile_stats_nan";
+
+  // Create a 1D array with a float attribute and two cells per tile
+  int64_t dim_domain[] = {1, 4};
+  int64_t tile_extent = 2;
+  tiledb_dimension_t* d;
+  REQUIRE(
+      tiledb_dimension_alloc(
+          ctx_, "d", TILEDB_INT64, dim_domain, &tile_extent, &d) == TILEDB_OK);
+  tiledb_domain_t* domain;
+  REQUIRE(tiledb_domain_alloc(ctx_, &domain) == TILEDB_OK);
+  REQUIRE(tiledb_domain_add_dimension(ctx_, domain, d) == TILEDB_OK);
+  tiledb_attribute_t* f;
+  REQUIRE(tiledb_attribute_alloc(ctx_, "f", TILEDB_FLOAT32, &f) == TILEDB_OK);
+  tiledb_array_schema_t* array_schema;
+  REQUIRE(
+      tiledb_array_schema_alloc(ctx_, TILEDB_SPARSE, &array_schema) ==
+      TILEDB_OK);
+  REQUIRE(tiledb_array_schema_set_capacity(ctx_, array_schema, 2) == TILEDB_OK);
+  REQUIRE(
+      tiledb_array_schema_set_domain(ctx_, array_schema, domain) == TILEDB_OK);
+  REQUIRE(
+      tiledb_array_schema_add_attribute(ctx_, array_schema, f) == TILEDB_OK);
+  REQUIRE(
+      tiledb_array_create(ctx_, array_name.c_str(), array_schema) ==
+      TILEDB_OK);
+  tiledb_attribute_free(&f);
+  tiledb_dimension_free(&d);
+  tiledb_domain_free(&domain);
+  tiledb_array_schema_free(&array_schema);
+
+  // The first tile holds {5, NaN}, whose minimum and maximum are both 5,
+  // and the second tile holds {5, 5}
+  float nan = std::numeric_limits<float>::quiet_NaN();
+  float w_f[] = {5.0f, nan, 5.0f, 5.0f};
+  uint64_t w_f_size = sizeof(w_f);
+  int64_t w_coords[] = {1, 2, 3, 4};
+  uint64_t w_coords_size = sizeof(w_coords);
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_WRITE) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_GLOBAL_ORDER) == TILEDB_OK);
+  CHECK(tiledb_query_set_buffer(ctx_, query, "f", w_f, &w_f_size) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, TILEDB_COORDS, w_coords, &w_coords_size) == TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  CHECK(tiledb_query_finalize(ctx_, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // Read with condition "f != 5", which only the NaN cell satisfies, thus
+  // only the second tile is skipped
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+  float value = 5.0f;
+  std::vector<float> r_f(4);
+  uint64_t r_f_size = r_f.size() * sizeof(float);
+  std::vector<int64_t> r_coords(4);
+  uint64_t r_coords_size = r_coords.size() * sizeof(int64_t);
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx_, query, "f", &r_f[0], &r_f_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, TILEDB_COORDS, &r_coords[0], &r_coords_size) ==
+      TILEDB_OK);
+  tiledb_query_condition_t* cond;
+  REQUIRE(tiledb_query_condition_alloc(ctx_, &cond) == TILEDB_OK);
+  CHECK(
+      tiledb_query_condition_init(
+          ctx_, cond, "f", &value, sizeof(value), TILEDB_NE) == TILEDB_OK);
+  CHECK(tiledb_query_set_condition(ctx_, query, cond) == TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_condition_free(&cond);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  REQUIRE(r_f_size == sizeof(float));
+  CHECK(std::isnan(r_f[0]));
+  REQUIRE(r_coords_size == sizeof(int64_t));
+  CHECK(r_coords[0] == 2);
+  CHECK(
+      tiledb::sm::stats::all_stats
+          .counter_reader_num_tiles_skipped_by_condition == 1);
+  tiledb_stats_disable();
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, partitions balanced on skewed data",
+    "[capi], [sparse], [sparse-partitioner]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_partitioner";
+  create_sparse_array_2D(
+      array_name,
+      1000,
+      1,
+      1,
+      1000000,
+      1,
+      1,
+      1,
+      TILEDB_FILTER_NONE,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Write five cells at the start of the domain and one at the end
+  std::vector<int> a = {1, 2, 3, 4, 5, 6};
+  std::vector<int64_t> coords = {1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 1000000, 1};
+  write_sparse_cells_2D(ctx_, array_name, TILEDB_GLOBAL_ORDER, a, coords);
+
+  // Read with a buffer that fits four cells. Splitting at the middle of the
+  // domain would create partitions with 4, 1 and 1 cells, whereas balancing
+  // the estimated results creates two partitions with 3 cells each.
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  std::vector<uint64_t> result_nums;
+  read_sparse_cells_2D(
+      ctx_, array_name, TILEDB_ROW_MAJOR, 4, &r_a, &r_coords, &result_nums);
+  CHECK(r_a == a);
+  CHECK(r_coords == coords);
+  CHECK(result_nums == std::vector<uint64_t>({3, 3}));
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, prefetched partitions",
+    "[capi], [sparse], [sparse-prefetch]") {
+  std::string array_name = FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_prefetch";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      1,
+      1,
+      1000,
+      1,
+      1,
+      2,
+      TILEDB_FILTER_NONE,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Write 100 cells, one every 10 coordinates of the first dimension
+  std::vector<int> a;
+  std::vector<int64_t> coords;
+  generate_strided_cells_2D(100, &a, &coords);
+  write_sparse_cells_2D(ctx_, array_name, TILEDB_GLOBAL_ORDER, a, coords);
+
+  // Read with small buffers, prefetching a varying number of partitions.
+  // The last budget fits a single partition.
+  std::vector<std::pair<std::string, std::string>> params = {
+      {"0", "1000000000"}, {"1", "1000000000"}, {"4", "1000000000"},
+      {"4", "160"}};
+  for (const auto& param : params) {
+    tiledb_ctx_t* ctx = alloc_ctx(
+        {{"sm.read_prefetch_partitions", param.first},
+         {"sm.read_prefetch_memory_budget", param.second}});
+    std::vector<int> r_a;
+    std::vector<int64_t> r_coords;
+    read_sparse_cells_2D(
+        ctx, array_name, TILEDB_ROW_MAJOR, 8, &r_a, &r_coords);
+    CHECK(r_a == a);
+    CHECK(r_coords == coords);
+    tiledb_ctx_free(&ctx);
+  }
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, result views",
+    "[capi], [sparse], [sparse-views]") {
+  std::string array_name = FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_views";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      1,
+      1,
+      1000,
+      1,
+      1,
+      10,
+      TILEDB_FILTER_NONE,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Write 100 cells, one every 10 coordinates of the first dimension
+  std::vector<int> a;
+  std::vector<int64_t> coords;
+  generate_strided_cells_2D(100, &a, &coords);
+  write_sparse_cells_2D(ctx_, array_name, TILEDB_GLOBAL_ORDER, a, coords);
+
+  // Read with result views and buffers that fit 25 cells. The buffer
+  // sizes do not bound the viewed results, only the memory budget does.
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR) == TILEDB_OK);
+  CHECK(tiledb_query_set_result_views(ctx_, query, 1) == TILEDB_OK);
+  std::vector<int> r_a(25, -1);
+  std::vector<int64_t> r_coords(50, -1);
+  std::vector<int> all_a;
+  std::vector<int64_t> all_coords;
+  tiledb_result_view_t* held_view = nullptr;
+  std::vector<int> held_a;
+  uint64_t max_a_size = 0;
+  tiledb_query_status_t status;
+  do {
+    uint64_t r_a_size = r_a.size() * sizeof(int);
+    uint64_t r_coords_size = r_coords.size() * sizeof(int64_t);
+    CHECK(
+        tiledb_query_set_buffer(
+            ctx_, query, ATTR_NAME.c_str(), &r_a[0], &r_a_size) == TILEDB_OK);
+    CHECK(
+        tiledb_query_set_buffer(
+            ctx_, query, TILEDB_COORDS, &r_coords[0], &r_coords_size) ==
+        TILEDB_OK);
+    REQUIRE(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+    REQUIRE(tiledb_query_get_status(ctx_, query, &status) == TILEDB_OK);
+
+    // The views cover exactly the results reported by the buffer sizes,
+    // and each view spans a whole tile at most
+    uint64_t view_num, views_size = 0;
+    REQUIRE(
+        tiledb_query_get_result_view_num(
+            ctx_, query, ATTR_NAME.c_str(), &view_num) == TILEDB_OK);
+    for (uint64_t i = 0; i < view_num; ++i) {
+      const void* data;
+      uint64_t size;
+      REQUIRE(
+          tiledb_query_get_result_view(
+              ctx_, query, ATTR_NAME.c_str(), i, &data, &size) == TILEDB_OK);
+      CHECK(size <= 10 * sizeof(int));
+      all_a.insert(
+          all_a.end(), (const int*)data, (const int*)data + size / sizeof(int));
+      views_size += size;
+
+      // Hold the first view beyond the query
+      if (held_view == nullptr) {
+        REQUIRE(
+            tiledb_query_get_result_view_handle(
+                ctx_, query, ATTR_NAME.c_str(), i, &held_view) == TILEDB_OK);
+        held_a.assign((const int*)data, (const int*)data + size / sizeof(int));
+      }
+    }
+    CHECK(views_size == r_a_size);
+    max_a_size = std::max(max_a_size, views_size);
+    REQUIRE(
+        tiledb_query_get_result_view_num(
+            ctx_, query, TILEDB_COORDS, &view_num) == TILEDB_OK);
+    views_size = 0;
+    for (uint64_t i = 0; i < view_num; ++i) {
+      const void* data;
+      uint64_t size;
+      REQUIRE(
+          tiledb_query_get_result_view(
+              ctx_, query, TILEDB_COORDS, i, &data, &size) == TILEDB_OK);
+      all_coords.insert(
+          all_coords.end(),
+          (const int64_t*)data,
+          (const int64_t*)data + size / sizeof(int64_t));
+      views_size += size;
+    }
+    CHECK(views_size == r_coords_size);
+    CHECK(
+        tiledb_query_get_result_view(
+            ctx_, query, TILEDB_COORDS, view_num, nullptr, nullptr) ==
+        TILEDB_ERR);
+  } while (status == TILEDB_INCOMPLETE);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(all_a == a);
+  CHECK(all_coords == coords);
+  CHECK(max_a_size > r_a.size() * sizeof(int));
+
+  // The buffers are never written
+  CHECK(r_a == std::vector<int>(25, -1));
+  CHECK(r_coords == std::vector<int64_t>(50, -1));
+
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // The held view outlives the query
+  const void* held_data;
+  uint64_t held_size;
+  REQUIRE(
+      tiledb_result_view_get_data(ctx_, held_view, &held_data, &held_size) ==
+      TILEDB_OK);
+  CHECK(
+      std::vector<int>(
+          (const int*)held_data,
+          (const int*)held_data + held_size / sizeof(int)) == held_a);
+  tiledb_result_view_free(&held_view);
+  CHECK(held_view == nullptr);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, tiles without results in the subarray",
+    "[capi], [sparse], [sparse-late-materialization]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_late_materialization";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      10,
+      1,
+      10,
+      1,
+      10,
+      2,
+      TILEDB_FILTER_NONE,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // The MBR of the first tile spans columns 1-10 of row 1, but it has
+  // cells only in columns 1 and 10
+  std::vector<int> a = {1, 2, 3, 4};
+  std::vector<int64_t> coords = {1, 1, 1, 10, 2, 5, 2, 6};
+  write_sparse_cells_2D(ctx_, array_name, TILEDB_GLOBAL_ORDER, a, coords);
+
+  // The subarray overlaps the MBRs of both tiles, but only the second
+  // tile has results
+  int64_t subarray[] = {1, 2, 4, 7};
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR) == TILEDB_OK);
+  CHECK(tiledb_query_set_subarray(ctx_, query, subarray) == TILEDB_OK);
+  std::vector<int> r_a(4);
+  uint64_t r_a_size = r_a.size() * sizeof(int);
+  std::vector<int64_t> r_coords(8);
+  uint64_t r_coords_size = r_coords.size() * sizeof(int64_t);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, ATTR_NAME.c_str(), &r_a[0], &r_a_size) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, TILEDB_COORDS, &r_coords[0], &r_coords_size) ==
+      TILEDB_OK);
+  REQUIRE(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  tiledb_query_status_t status;
+  REQUIRE(tiledb_query_get_status(ctx_, query, &status) == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+  REQUIRE(r_a_size == 2 * sizeof(int));
+  CHECK(r_a[0] == 3);
+  CHECK(r_a[1] == 4);
+  REQUIRE(r_coords_size == 4 * sizeof(int64_t));
+  r_coords.resize(r_coords_size / sizeof(int64_t));
+  CHECK(r_coords == std::vector<int64_t>({2, 5, 2, 6}));
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, memory budget",
+    "[capi], [sparse], [sparse-memory-budget]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_memory_budget";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      1,
+      1,
+      1000,
+      1,
+      1,
+      2,
+      TILEDB_FILTER_NONE,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // A budget that fits neither the tiles of an attribute nor the radix sort
+  // buffers on writes, and the tiles of a few cells on reads
+  tiledb_ctx_t* ctx = alloc_ctx(
+      {{"sm.memory_budget", "1600"}, {"sm.memory_budget_var", "1600"}});
+
+  // Write 100 cells in unordered layout, one every 10 coordinates of the
+  // first dimension. The attributes are written in ranges of tiles that fit
+  // in the budget, along with the sorted positions.
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+  std::vector<int> a;
+  std::vector<int64_t> coords;
+  generate_strided_cells_2D(100, &a, &coords);
+  write_sparse_cells_2D(ctx, array_name, TILEDB_UNORDERED, a, coords);
+  CHECK(tiledb::sm::stats::all_stats.counter_writer_num_radix_sorts == 0);
+  CHECK(
+      tiledb::sm::stats::all_stats.counter_writer_tile_bytes_peak <=
+      1600 - 100 * sizeof(uint64_t));
+  tiledb_stats_disable();
+
+  // Read with buffers that fit all results, which are still returned in
+  // partitions whose tiles fit in the budget
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  read_sparse_cells_2D(
+      ctx, array_name, TILEDB_ROW_MAJOR, 100, &r_a, &r_coords);
+  CHECK(r_a == a);
+  CHECK(r_coords == coords);
+  tiledb_ctx_free(&ctx);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, memory budget with attribute groups",
+    "[capi], [sparse], [sparse-memory-budget-groups]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_memory_budget_groups";
+  create_sparse_array(array_name);
+
+  // A budget that fits "a1" and "a2" together, but not along with "a3" or
+  // the coordinates, so that the attributes are written in several groups
+  tiledb_ctx_t* ctx = alloc_ctx({{"sm.memory_budget", "100"}});
+  tiledb_layout_t layout = TILEDB_GLOBAL_ORDER;
+  SECTION("- global order") {
+    layout = TILEDB_GLOBAL_ORDER;
+  }
+  SECTION("- unordered") {
+    layout = TILEDB_UNORDERED;
+  }
+
+  std::vector<int> a1 = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<uint64_t> a2_off = {0, 1, 3, 6, 10, 11, 13, 16};
+  std::string a2 = "abbcccddddeffggghhhh";
+  std::vector<float> a3 = {0.1f, 0.2f, 1.1f, 1.2f, 2.1f, 2.2f, 3.1f, 3.2f,
+                           4.1f, 4.2f, 5.1f, 5.2f, 6.1f, 6.2f, 7.1f, 7.2f};
+  std::vector<uint64_t> coords = {
+      1, 1, 1, 2, 1, 4, 2, 3, 3, 1, 4, 2, 3, 3, 3, 4};
+  uint64_t a1_size = a1.size() * sizeof(int);
+  uint64_t a2_off_size = a2_off.size() * sizeof(uint64_t);
+  uint64_t a2_size = a2.size();
+  uint64_t a3_size = a3.size() * sizeof(float);
+  uint64_t coords_size = coords.size() * sizeof(uint64_t);
+  uint64_t total_size =
+      a1_size + a2_off_size + a2_size + a3_size + coords_size;
+
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx, array, TILEDB_WRITE) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx, query, layout) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx, query, "a1", &a1[0], &a1_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer_var(
+          ctx, query, "a2", &a2_off[0], &a2_off_size, &a2[0], &a2_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx, query, "a3", &a3[0], &a3_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, TILEDB_COORDS, &coords[0], &coords_size) == TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx, query) == TILEDB_OK);
+  CHECK(tiledb_query_finalize(ctx, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // The tiles of all attributes are never held at the same time
+  CHECK(
+      tiledb::sm::stats::all_stats.counter_writer_tile_bytes_peak <
+      total_size);
+  tiledb_stats_disable();
+
+  // Read all attributes back
+  std::vector<int> r_a1(16);
+  std::vector<uint64_t> r_a2_off(16);
+  std::string r_a2(64, 0);
+  std::vector<float> r_a3(32);
+  std::vector<uint64_t> r_coords(32);
+  uint64_t r_a1_size = r_a1.size() * sizeof(int);
+  uint64_t r_a2_off_size = r_a2_off.size() * sizeof(uint64_t);
+  uint64_t r_a2_size = r_a2.size();
+  uint64_t r_a3_size = r_a3.size() * sizeof(float);
+  uint64_t r_coords_size = r_coords.size() * sizeof(uint64_t);
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_READ) == TILEDB_OK);
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_READ, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_GLOBAL_ORDER) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx_, query, "a1", &r_a1[0], &r_a1_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer_var(
+          ctx_,
+          query,
+          "a2",
+          &r_a2_off[0],
+          &r_a2_off_size,
+          &r_a2[0],
+          &r_a2_size) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(ctx_, query, "a3", &r_a3[0], &r_a3_size) ==
+      TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx_, query, TILEDB_COORDS, &r_coords[0], &r_coords_size) ==
+      TILEDB_OK);
+  REQUIRE(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+  tiledb_query_status_t status;
+  REQUIRE(tiledb_query_get_status(ctx_, query, &status) == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  r_a1.resize(r_a1_size / sizeof(int));
+  r_a2_off.resize(r_a2_off_size / sizeof(uint64_t));
+  r_a2.resize(r_a2_size);
+  r_a3.resize(r_a3_size / sizeof(float));
+  r_coords.resize(r_coords_size / sizeof(uint64_t));
+  CHECK(r_a1 == a1);
+  CHECK(r_a2_off == a2_off);
+  CHECK(r_a2 == a2);
+  CHECK(r_a3 == a3);
+  CHECK(r_coords == coords);
+  tiledb_ctx_free(&ctx);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, global order write batches",
+    "[capi], [sparse], [sparse-write-batches]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_write_batches";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      1,
+      1,
+      1000,
+      1,
+      1,
+      2,
+      TILEDB_FILTER_GZIP,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Filter and write every tile in a separate batch
+  tiledb_ctx_t* ctx = alloc_ctx({{"sm.write_batch_size", "1"}});
+
+  // Write 100 cells in two global order submits, the first of which leaves
+  // a partially filled last tile
+  std::vector<int> a;
+  std::vector<int64_t> coords;
+  generate_strided_cells_2D(100, &a, &coords);
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx, array, TILEDB_WRITE) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx, query, TILEDB_GLOBAL_ORDER) == TILEDB_OK);
+  for (uint64_t begin : {0, 51}) {
+    uint64_t end = (begin == 0) ? 51 : 100;
+    uint64_t a_size = (end - begin) * sizeof(int);
+    uint64_t coords_size = 2 * (end - begin) * sizeof(int64_t);
+    CHECK(
+        tiledb_query_set_buffer(
+            ctx, query, ATTR_NAME.c_str(), &a[begin], &a_size) == TILEDB_OK);
+    CHECK(
+        tiledb_query_set_buffer(
+            ctx, query, TILEDB_COORDS, &coords[2 * begin], &coords_size) ==
+        TILEDB_OK);
+    CHECK(tiledb_query_submit(ctx, query) == TILEDB_OK);
+  }
+  CHECK(tiledb_query_finalize(ctx, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  // Read all cells back
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  read_sparse_cells_2D(
+      ctx, array_name, TILEDB_GLOBAL_ORDER, 100, &r_a, &r_coords);
+  CHECK(r_a == a);
+  CHECK(r_coords == coords);
+  tiledb_ctx_free(&ctx);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, vectored tile writes",
+    "[capi], [sparse], [sparse-vectored-writes]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_vectored_writes";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      1,
+      1,
+      1000,
+      1,
+      1,
+      2,
+      TILEDB_FILTER_NONE,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+
+  // Write 100 cells, which form 50 tiles per attribute file
+  std::vector<int> a;
+  std::vector<int64_t> coords;
+  generate_strided_cells_2D(100, &a, &coords);
+  write_sparse_cells_2D(ctx_, array_name, TILEDB_UNORDERED, a, coords);
+
+#ifndef _WIN32
+  // The tiles of each file are gathered into a few vectored writes
+  uint64_t num_vectored =
+      tiledb::sm::stats::all_stats.counter_vfs_posix_write_num_vectored;
+  CHECK(num_vectored > 0);
+  CHECK(num_vectored < 50);
+#endif
+  tiledb_stats_disable();
+
+  // Read all cells back
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  read_sparse_cells_2D(
+      ctx_, array_name, TILEDB_GLOBAL_ORDER, 100, &r_a, &r_coords);
+  CHECK(r_a == a);
+  CHECK(r_coords == coords);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, unordered write radix sort",
+    "[capi], [sparse], [sparse-radix-sort]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_radix_sort";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      10,
+      -50,
+      49,
+      -50,
+      49,
+      10,
+      TILEDB_FILTER_NONE,
+      TILEDB_COL_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Scatter 200 distinct cells over the domain, in no particular order
+  std::vector<int64_t> coords;
+  for (int64_t i = 0; i < 200; ++i) {
+    int64_t pos = (i * 3637) % 10000;
+    coords.push_back(pos / 100 - 50);
+    coords.push_back(pos % 100 - 50);
+  }
+  std::vector<int> a(200);
+  for (int i = 0; i < 200; ++i)
+    a[i] = i;
+
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+  write_sparse_cells_2D(ctx_, array_name, TILEDB_UNORDERED, a, coords);
+  CHECK(tiledb::sm::stats::all_stats.counter_writer_num_radix_sorts == 1);
+  tiledb_stats_disable();
+
+  // Row-major tiles of 10x10 cells, column-major cells within each tile
+  std::vector<int> c_a(a);
+  std::sort(c_a.begin(), c_a.end(), [&coords](int x, int y) {
+    int64_t rx = coords[2 * x] + 50, cx = coords[2 * x + 1] + 50;
+    int64_t ry = coords[2 * y] + 50, cy = coords[2 * y + 1] + 50;
+    return std::make_tuple(rx / 10, cx / 10, cx % 10, rx % 10) <
+           std::make_tuple(ry / 10, cy / 10, cy % 10, ry % 10);
+  });
+
+  // Read all cells back in global order
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  read_sparse_cells_2D(
+      ctx_, array_name, TILEDB_GLOBAL_ORDER, 200, &r_a, &r_coords);
+  CHECK(r_a == c_a);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, Hilbert cell order",
+    "[capi], [sparse], [sparse-hilbert]") {
+  std::string array_name = FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_hilbert";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      10,
+      -50,
+      49,
+      -50,
+      49,
+      10,
+      TILEDB_FILTER_NONE,
+      TILEDB_HILBERT,
+      TILEDB_ROW_MAJOR);
+
+  // Scatter 200 distinct cells over the domain, in no particular order
+  std::vector<int64_t> coords;
+  for (int64_t i = 0; i < 200; ++i) {
+    int64_t pos = (i * 3637) % 10000;
+    coords.push_back(pos / 100 - 50);
+    coords.push_back(pos % 100 - 50);
+  }
+  std::vector<int> a(200);
+  for (int i = 0; i < 200; ++i)
+    a[i] = i;
+
+  // The Hilbert order is not a query layout
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, array_name.c_str(), &array) == TILEDB_OK);
+  tiledb_query_type_t query_types[] = {TILEDB_WRITE, TILEDB_READ};
+  for (auto query_type : query_types) {
+    REQUIRE(tiledb_array_open(ctx_, array, query_type) == TILEDB_OK);
+    tiledb_query_t* query;
+    REQUIRE(tiledb_query_alloc(ctx_, array, query_type, &query) == TILEDB_OK);
+    CHECK(tiledb_query_set_layout(ctx_, query, TILEDB_HILBERT) == TILEDB_ERR);
+    CHECK(tiledb_array_close(ctx_, array) == TILEDB_OK);
+    tiledb_query_free(&query);
+  }
+  tiledb_array_free(&array);
+
+  // Write the cells in two fragments, so that reads merge them
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+  write_sparse_cells_2D(
+      ctx_,
+      array_name,
+      TILEDB_UNORDERED,
+      std::vector<int>(a.begin(), a.begin() + 120),
+      std::vector<int64_t>(coords.begin(), coords.begin() + 240));
+  write_sparse_cells_2D(
+      ctx_,
+      array_name,
+      TILEDB_UNORDERED,
+      std::vector<int>(a.begin() + 120, a.end()),
+      std::vector<int64_t>(coords.begin() + 240, coords.end()));
+  CHECK(tiledb::sm::stats::all_stats.counter_writer_num_radix_sorts == 2);
+  tiledb_stats_disable();
+
+  // Row-major tiles of 10x10 cells, Hilbert order of cells within each
+  // tile. The 100x100 domain takes 7 bits per dimension.
+  tiledb::sm::Hilbert hilbert(2, 7);
+  auto key = [&](int x) {
+    uint64_t c[] = {uint64_t(coords[2 * x] + 50),
+                    uint64_t(coords[2 * x + 1] + 50)};
+    auto tile_row = c[0] / 10, tile_col = c[1] / 10;
+    return std::make_tuple(tile_row, tile_col, hilbert.key(c));
+  };
+  std::vector<int> c_a(a);
+  std::sort(c_a.begin(), c_a.end(), [&key](int x, int y) {
+    return key(x) < key(y);
+  });
+
+  // Read all cells back in global order
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  read_sparse_cells_2D(
+      ctx_, array_name, TILEDB_GLOBAL_ORDER, 200, &r_a, &r_coords);
+  CHECK(r_a == c_a);
+}
+
+TEST_CASE_METHOD(
+    SparseArrayFx,
+    "C API: Test sparse array, asynchronous writes",
+    "[capi], [sparse], [sparse-async-writes]") {
+  std::string array_name =
+      FILE_URI_PREFIX + FILE_TEMP_DIR + "sparse_async_writes";
+  create_sparse_array_2D(
+      array_name,
+      10,
+      1,
+      1,
+      1000,
+      1,
+      1,
+      4,
+      TILEDB_FILTER_GZIP,
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR);
+
+  // Stage up to two batches at once
+  tiledb_ctx_t* ctx = alloc_ctx({{"sm.write_staging_buffers", "2"}});
+
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+
+  // Write 100 cells in five global order batches of 20 cells, refilling
+  // the same buffers right after each submission
+  std::vector<int> a(20);
+  std::vector<int64_t> coords(40);
+  uint64_t a_size = a.size() * sizeof(int);
+  uint64_t coords_size = coords.size() * sizeof(int64_t);
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx, array, TILEDB_WRITE) == TILEDB_OK);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx, query, TILEDB_GLOBAL_ORDER) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, ATTR_NAME.c_str(), &a[0], &a_size) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, TILEDB_COORDS, &coords[0], &coords_size) == TILEDB_OK);
+  for (int batch = 0; batch < 5; ++batch) {
+    for (int i = 0; i < 20; ++i) {
+      a[i] = 20 * batch + i;
+      coords[2 * i] = 10 * a[i] + 1;
+      coords[2 * i + 1] = 1;
+    }
+    CHECK(tiledb_query_submit(ctx, query) == TILEDB_OK);
+  }
+  CHECK(tiledb_query_finalize(ctx, query) == TILEDB_OK);
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+
+  CHECK(tiledb::sm::stats::all_stats.counter_writer_num_staged_batches == 5);
+  tiledb_stats_disable();
+
+  // Read all cells back
+  std::vector<int> c_a;
+  std::vector<int64_t> c_coords;
+  generate_strided_cells_2D(100, &c_a, &c_coords);
+  std::vector<int> r_a;
+  std::vector<int64_t> r_coords;
+  read_sparse_cells_2D(
+      ctx, array_name, TILEDB_GLOBAL_ORDER, 100, &r_a, &r_coords);
+  CHECK(r_a == c_a);
+  CHECK(r_coords == c_coords);
+
+  // A batch that fails in the background fails the finalization
+  REQUIRE(tiledb_array_alloc(ctx, array_name.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx, array, TILEDB_WRITE) == TILEDB_OK);
+  REQUIRE(tiledb_query_alloc(ctx, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  CHECK(tiledb_query_set_layout(ctx, query, TILEDB_GLOBAL_ORDER) == TILEDB_OK);
+  std::swap(coords[0], coords[2]);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, ATTR_NAME.c_str(), &a[0], &a_size) == TILEDB_OK);
+  CHECK(
+      tiledb_query_set_buffer(
+          ctx, query, TILEDB_COORDS, &coords[0], &coords_size) == TILEDB_OK);
+  CHECK(tiledb_query_submit(ctx, query) == TILEDB_OK);
+  CHECK(tiledb_query_finalize(ctx, query) == TILEDB_ERR);
+  CHECK(tiledb_array_close(ctx, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+  tiledb_ctx_free(&ctx);
+}
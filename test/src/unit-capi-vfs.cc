@@ -41,6 +41,7 @@
 #endif
 
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <thread>
 
@@ -718,3 +719,121 @@ TEST_CASE_METHOD(VFSFx, "C API: Test VFS parallel I/O", "[capi], [vfs]") {
 #endif
   }
 }
+
+#ifndef _WIN32
+TEST_CASE_METHOD(
+    VFSFx, "C API: Test VFS POSIX file descriptor cache", "[capi], [vfs]") {
+  tiledb_stats_enable();
+  tiledb_stats_reset();
+
+  // Keep at most two files open
+  tiledb_error_t* error = nullptr;
+  tiledb_config_t* config;
+  REQUIRE(tiledb_config_alloc(&config, &error) == TILEDB_OK);
+  REQUIRE(
+      tiledb_config_set(config, "vfs.file.max_open_files", "2", &error) ==
+      TILEDB_OK);
+  REQUIRE(error == nullptr);
+  tiledb_vfs_t* vfs;
+  REQUIRE(tiledb_vfs_alloc(ctx_, config, &vfs) == TILEDB_OK);
+  tiledb_config_free(&config);
+
+  std::string dir = FILE_TEMP_DIR + "fd_cache/";
+  int is_dir = 0;
+  REQUIRE(
+      tiledb_vfs_is_dir(ctx_, vfs, FILE_TEMP_DIR.c_str(), &is_dir) ==
+      TILEDB_OK);
+  if (!is_dir)
+    REQUIRE(
+        tiledb_vfs_create_dir(ctx_, vfs, FILE_TEMP_DIR.c_str()) == TILEDB_OK);
+  REQUIRE(tiledb_vfs_is_dir(ctx_, vfs, dir.c_str(), &is_dir) == TILEDB_OK);
+  if (is_dir)
+    REQUIRE(tiledb_vfs_remove_dir(ctx_, vfs, dir.c_str()) == TILEDB_OK);
+  REQUIRE(tiledb_vfs_create_dir(ctx_, vfs, dir.c_str()) == TILEDB_OK);
+
+  // Append to three files in turns, evicting their descriptors
+  std::vector<std::string> files = {dir + "a", dir + "b", dir + "c"};
+  std::map<std::string, std::string> contents;
+  for (int i = 0; i < 4; ++i) {
+    for (const auto& file : files) {
+      auto data = file.substr(file.size() - 1) + std::to_string(i);
+      tiledb_vfs_fh_t* fh;
+      REQUIRE(
+          tiledb_vfs_open(ctx_, vfs, file.c_str(), TILEDB_VFS_APPEND, &fh) ==
+          TILEDB_OK);
+      REQUIRE(
+          tiledb_vfs_write(ctx_, fh, data.c_str(), data.size()) == TILEDB_OK);
+      REQUIRE(tiledb_vfs_close(ctx_, fh) == TILEDB_OK);
+      contents[file] += data;
+    }
+  }
+
+  // Read the files back in two parts, twice, and replace one of them
+  for (int i = 0; i < 2; ++i) {
+    for (const auto& file : files) {
+      const auto& expected = contents[file];
+      std::string data(expected.size(), '\0');
+      tiledb_vfs_fh_t* fh;
+      REQUIRE(
+          tiledb_vfs_open(ctx_, vfs, file.c_str(), TILEDB_VFS_READ, &fh) ==
+          TILEDB_OK);
+      REQUIRE(tiledb_vfs_read(ctx_, fh, 0, &data[0], 1) == TILEDB_OK);
+      REQUIRE(
+          tiledb_vfs_read(ctx_, fh, 1, &data[1], data.size() - 1) ==
+          TILEDB_OK);
+      REQUIRE(tiledb_vfs_close(ctx_, fh) == TILEDB_OK);
+      CHECK(data == expected);
+    }
+    REQUIRE(tiledb_vfs_remove_file(ctx_, vfs, files[0].c_str()) == TILEDB_OK);
+    tiledb_vfs_fh_t* fh;
+    REQUIRE(
+        tiledb_vfs_open(ctx_, vfs, files[0].c_str(), TILEDB_VFS_WRITE, &fh) ==
+        TILEDB_OK);
+    REQUIRE(tiledb_vfs_write(ctx_, fh, "new", 3) == TILEDB_OK);
+    REQUIRE(tiledb_vfs_close(ctx_, fh) == TILEDB_OK);
+    contents[files[0]] = "new";
+  }
+
+  // Moving a file must not leave a stale descriptor behind
+  REQUIRE(
+      tiledb_vfs_move_file(ctx_, vfs, files[1].c_str(), files[0].c_str()) ==
+      TILEDB_OK);
+  uint64_t size = 0;
+  REQUIRE(
+      tiledb_vfs_file_size(ctx_, vfs, files[0].c_str(), &size) == TILEDB_OK);
+  CHECK(size == contents[files[1]].size());
+  std::string data(size, '\0');
+  tiledb_vfs_fh_t* fh;
+  REQUIRE(
+      tiledb_vfs_open(ctx_, vfs, files[0].c_str(), TILEDB_VFS_READ, &fh) ==
+      TILEDB_OK);
+  REQUIRE(tiledb_vfs_read(ctx_, fh, 0, &data[0], size) == TILEDB_OK);
+  REQUIRE(tiledb_vfs_close(ctx_, fh) == TILEDB_OK);
+  CHECK(data == contents[files[1]]);
+
+  // A file replaced through another VFS instance is reopened once a read
+  // exceeds the size of its still cached old descriptor
+  std::string other = "replaced through another VFS";
+  REQUIRE(other.size() > size);
+  REQUIRE(tiledb_vfs_remove_file(ctx_, vfs_, files[0].c_str()) == TILEDB_OK);
+  REQUIRE(
+      tiledb_vfs_open(ctx_, vfs_, files[0].c_str(), TILEDB_VFS_WRITE, &fh) ==
+      TILEDB_OK);
+  REQUIRE(
+      tiledb_vfs_write(ctx_, fh, other.c_str(), other.size()) == TILEDB_OK);
+  REQUIRE(tiledb_vfs_close(ctx_, fh) == TILEDB_OK);
+  data.assign(other.size(), '\0');
+  REQUIRE(
+      tiledb_vfs_open(ctx_, vfs, files[0].c_str(), TILEDB_VFS_READ, &fh) ==
+      TILEDB_OK);
+  REQUIRE(tiledb_vfs_read(ctx_, fh, 0, &data[0], data.size()) == TILEDB_OK);
+  REQUIRE(tiledb_vfs_close(ctx_, fh) == TILEDB_OK);
+  CHECK(data == other);
+
+  CHECK(tiledb::sm::stats::all_stats.counter_vfs_posix_fd_cache_hits > 0);
+  CHECK(tiledb::sm::stats::all_stats.counter_vfs_posix_fd_cache_misses > 0);
+
+  REQUIRE(tiledb_vfs_remove_dir(ctx_, vfs, dir.c_str()) == TILEDB_OK);
+  tiledb_vfs_free(&vfs);
+}
+#endif
@@ -0,0 +1,131 @@
+/**
+ * @file unit-copy_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file unit-tests the copy kernels.
+ */
+
+
+#include "catch.hpp"
+#include "tiledb/sm/misc/constants.h"
+#include "tiledb/sm/misc/copy_kernels.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace tiledb::sm;
+
+/**
+ * Fills `num` values of `value_size` bytes at byte `shift` of a buffer and
+ * checks the result, as well as that the bytes around it are intact.
+ */
+void check_fill(uint64_t value_size, uint64_t num, uint64_t shift) {
+  std::vector<unsigned char> value(value_size);
+  for (uint64_t i = 0; i < value_size; ++i)
+    value[i] = (unsigned char)(i + 1);
+
+  uint64_t size = num * value_size;
+  std::vector<unsigned char> buffer(size + shift + 1, 0);
+  copy_kernels::fill(&buffer[shift], size, &value[0], value_size);
+
+  std::vector<unsigned char> expected(size + shift + 1, 0);
+  for (uint64_t i = 0; i < size; ++i)
+    expected[shift + i] = value[i % value_size];
+  CHECK(buffer == expected);
+}
+
+TEST_CASE("Copy kernels: Test fill", "[copy-kernels]") {
+  for (uint64_t value_size : {1, 2, 3, 4, 8, 12, 16}) {
+    for (uint64_t shift : {0, 1, 3, 8}) {
+      for (uint64_t num : {0, 1, 2, 5, 31, 100, 1000, 4097})
+        check_fill(value_size, num, shift);
+    }
+  }
+}
+
+TEST_CASE("Copy kernels: Test large fill", "[copy-kernels]") {
+  // Large enough for the non-temporal path, with an unaligned end
+  for (uint64_t value_size : {1, 4, 8, 12}) {
+    auto num = constants::copy_nontemporal_min_size / value_size + 3;
+    for (uint64_t shift : {0, 5})
+      check_fill(value_size, num, shift);
+  }
+}
+
+TEST_CASE("Copy kernels: Test copy box", "[copy-kernels]") {
+  // A 3D box of 5x6x7 cells, stored in row-major order
+  const std::vector<uint64_t> extents = {5, 6, 7};
+  const std::vector<uint64_t> row_strides = {42, 7, 1};
+  const std::vector<uint64_t> col_strides = {1, 5, 30};
+  for (uint64_t cell_size : {1, 2, 3, 4, 8}) {
+    std::vector<unsigned char> src(210 * cell_size);
+    for (uint64_t i = 0; i < src.size(); ++i)
+      src[i] = (unsigned char)i;
+
+    // Transposing to col-major and back restores the box
+    std::vector<unsigned char> col(src.size()), row(src.size());
+    copy_kernels::copy_box(
+        &src[0], row_strides, &col[0], col_strides, extents, cell_size);
+    copy_kernels::copy_box(
+        &col[0], col_strides, &row[0], row_strides, extents, cell_size);
+    CHECK(row == src);
+    for (uint64_t i = 0; i < 5; ++i) {
+      for (uint64_t j = 0; j < 6; ++j) {
+        for (uint64_t k = 0; k < 7; ++k) {
+          auto s = (i * 42 + j * 7 + k) * cell_size;
+          auto d = (i + j * 5 + k * 30) * cell_size;
+          CHECK(std::equal(&src[s], &src[s] + cell_size, &col[d]));
+        }
+      }
+    }
+
+    // Copy a sub-box into a larger destination, leaving the rest intact
+    const std::vector<uint64_t> sub_extents = {2, 3, 4};
+    std::vector<unsigned char> dst(2 * src.size(), 0), expected(dst);
+    const std::vector<uint64_t> dst_strides = {84, 14, 1};
+    auto src_offset = (1 * 42 + 2 * 7 + 3) * cell_size;
+    auto dst_offset = 5 * cell_size;
+    copy_kernels::copy_box(
+        &src[src_offset],
+        row_strides,
+        &dst[dst_offset],
+        dst_strides,
+        sub_extents,
+        cell_size);
+    for (uint64_t i = 0; i < 2; ++i) {
+      for (uint64_t j = 0; j < 3; ++j) {
+        for (uint64_t k = 0; k < 4; ++k) {
+          auto s = src_offset + (i * 42 + j * 7 + k) * cell_size;
+          auto d = dst_offset + (i * 84 + j * 14 + k) * cell_size;
+          std::copy(&src[s], &src[s] + cell_size, &expected[d]);
+        }
+      }
+    }
+    CHECK(dst == expected);
+  }
+}
@@ -451,6 +451,142 @@ TEST_CASE("C++ API: Read subarray with expanded domain", "[cppapi], [dense]") {
   }
 }
 
+TEST_CASE("C++ API: Dense reads across tiles", "[cppapi], [dense]") {
+  const std::string array_name = "cpp_unit_array";
+  // Each dimension is given as {low, high, tile extent}
+  const std::vector<std::vector<std::array<int, 3>>> domains = {
+      {{{0, 9, 4}}, {{0, 6, 3}}}, {{{0, 5, 2}}, {{0, 6, 3}}, {{0, 4, 4}}}};
+  const std::vector<tiledb_layout_t> layouts = {TILEDB_ROW_MAJOR,
+                                                TILEDB_COL_MAJOR};
+
+  for (const auto& dims : domains) {
+    for (auto tile_order : layouts) {
+      for (auto cell_order : layouts) {
+        Context ctx;
+        VFS vfs(ctx);
+        if (vfs.is_dir(array_name))
+          vfs.remove_dir(array_name);
+
+        // Create
+        auto dim_num = dims.size();
+        Domain domain(ctx);
+        for (size_t d = 0; d < dim_num; ++d) {
+          domain.add_dimension(Dimension::create<int>(
+              ctx,
+              "d" + std::to_string(d),
+              {{dims[d][0], dims[d][1]}},
+              dims[d][2]));
+        }
+        ArraySchema schema(ctx, TILEDB_DENSE);
+        schema.set_domain(domain).set_order({{tile_order, cell_order}});
+        schema.add_attribute(Attribute::create<int>(ctx, "a"));
+        auto b = Attribute::create<char>(ctx, "b").set_cell_val_num(3);
+        schema.add_attribute(b);
+        Array::create(array_name, schema);
+
+        // The value of a cell encodes its coordinates
+        auto value = [&](const std::vector<int>& coords) {
+          int v = 0;
+          for (auto c : coords)
+            v = v * 10 + c;
+          return v;
+        };
+
+        // Returns the coordinates of the cells of a subarray in a layout
+        auto cells = [&](const std::vector<int>& subarray,
+                         tiledb_layout_t layout) {
+          std::vector<std::vector<int>> result;
+          std::vector<int> coords(dim_num);
+          for (size_t d = 0; d < dim_num; ++d)
+            coords[d] = subarray[2 * d];
+          while (true) {
+            result.push_back(coords);
+            size_t i = 0;
+            for (; i < dim_num; ++i) {
+              auto d = (layout == TILEDB_ROW_MAJOR) ? dim_num - i - 1 : i;
+              if (++coords[d] <= subarray[2 * d + 1])
+                break;
+              coords[d] = subarray[2 * d];
+            }
+            if (i == dim_num)
+              break;
+          }
+          return result;
+        };
+
+        // Write
+        std::vector<int> full, a_w;
+        std::vector<char> b_w;
+        for (const auto& dim : dims) {
+          full.push_back(dim[0]);
+          full.push_back(dim[1]);
+        }
+        for (const auto& coords : cells(full, TILEDB_ROW_MAJOR)) {
+          auto v = value(coords);
+          a_w.push_back(v);
+          for (int k = 0; k < 3; ++k)
+            b_w.push_back((char)(v + k));
+        }
+        Array array_w(ctx, array_name, TILEDB_WRITE);
+        Query query_w(ctx, array_w);
+        query_w.set_subarray(full)
+            .set_layout(TILEDB_ROW_MAJOR)
+            .set_buffer("a", a_w)
+            .set_buffer("b", b_w);
+        query_w.submit();
+        array_w.close();
+
+        // Read the whole domain and a subarray cutting through tiles
+        std::vector<int> partial;
+        for (const auto& dim : dims) {
+          partial.push_back(dim[0] + 1);
+          partial.push_back(dim[1] - 1);
+        }
+        Array array(ctx, array_name, TILEDB_READ);
+        for (const auto& subarray : {full, partial}) {
+          for (auto layout : layouts) {
+            auto expected_cells = cells(subarray, layout);
+            auto cell_num = expected_cells.size();
+            std::vector<int> a(cell_num), coords(cell_num * dim_num);
+            std::vector<char> b(3 * cell_num);
+            Query query(ctx, array);
+            query.set_subarray(subarray)
+                .set_layout(layout)
+                .set_buffer("a", a)
+                .set_buffer("b", b)
+                .set_coordinates(coords);
+            query.submit();
+            REQUIRE(query.query_status() == Query::Status::COMPLETE);
+
+            std::vector<int> expected_a, expected_coords;
+            std::vector<char> expected_b;
+            for (const auto& cell : expected_cells) {
+              auto v = value(cell);
+              expected_a.push_back(v);
+              for (int k = 0; k < 3; ++k)
+                expected_b.push_back((char)(v + k));
+              expected_coords.insert(
+                  expected_coords.end(), cell.begin(), cell.end());
+            }
+            INFO(
+                dim_num << "D, tile order "
+                        << ArraySchema::to_str(tile_order) << ", cell order "
+                        << ArraySchema::to_str(cell_order) << ", layout "
+                        << ArraySchema::to_str(layout));
+            CHECK(a == expected_a);
+            CHECK(b == expected_b);
+            CHECK(coords == expected_coords);
+          }
+        }
+        array.close();
+
+        if (vfs.is_dir(array_name))
+          vfs.remove_dir(array_name);
+      }
+    }
+  }
+}
+
 TEST_CASE(
     "C++ API: Consolidation of empty arrays", "[cppapi], [consolidation]") {
   Context ctx;
@@ -748,3 +884,155 @@ TEST_CASE(
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
 }
+
+TEST_CASE(
+    "C++ API: Var-sized offsets format", "[cppapi], [cppapi-var-offsets]") {
+  const std::string array_name = "cppapi_var_offsets";
+  Context ctx;
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create array
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "d", {{1, 4}}, 2));
+  ArraySchema schema(ctx, TILEDB_DENSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<std::string>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  std::string data = "abbcccdddd";
+  std::vector<int> subarray = {1, 4};
+
+  SECTION("32-bit offsets") {
+    Config config;
+    config["sm.var_offsets.bitsize"] = "32";
+    Context ctx_32(config);
+
+    // Write
+    std::vector<uint32_t> offsets = {0, 1, 3, 6};
+    Array array_w(ctx_32, array_name, TILEDB_WRITE);
+    Query query_w(ctx_32, array_w);
+    query_w.set_layout(TILEDB_ROW_MAJOR).set_buffer("a", offsets, data);
+    query_w.submit();
+    array_w.close();
+
+    // Read
+    Array array_r(ctx_32, array_name, TILEDB_READ);
+    auto max_elements = array_r.max_buffer_elements(subarray);
+    CHECK(max_elements["a"].first == 4);
+    std::vector<uint32_t> offsets_r(max_elements["a"].first);
+    std::string data_r;
+    data_r.resize(max_elements["a"].second);
+    Query query_r(ctx_32, array_r);
+    query_r.set_subarray(subarray)
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_buffer("a", offsets_r, data_r);
+    query_r.submit();
+    array_r.close();
+    auto result = query_r.result_buffer_elements();
+    CHECK(result["a"].first == 4);
+    CHECK(result["a"].second == 10);
+    CHECK(offsets_r == offsets);
+    CHECK(data_r == data);
+  }
+
+  SECTION("32-bit offsets with an extra element") {
+    Config config;
+    config["sm.var_offsets.bitsize"] = "32";
+    config["sm.var_offsets.extra_element"] = "true";
+    Context ctx_32(config);
+
+    // The extra offset must match the size of the values
+    std::vector<uint32_t> offsets = {0, 1, 3, 6, 9};
+    Array array_w(ctx_32, array_name, TILEDB_WRITE);
+    Query query_bad(ctx_32, array_w);
+    query_bad.set_layout(TILEDB_ROW_MAJOR).set_buffer("a", offsets, data);
+    CHECK_THROWS(query_bad.submit());
+
+    // Write
+    offsets.back() = 10;
+    Query query_w(ctx_32, array_w);
+    query_w.set_layout(TILEDB_ROW_MAJOR).set_buffer("a", offsets, data);
+    query_w.submit();
+    array_w.close();
+
+    // Read
+    Array array_r(ctx_32, array_name, TILEDB_READ);
+    auto max_elements = array_r.max_buffer_elements(subarray);
+    CHECK(max_elements["a"].first == 5);
+    std::vector<uint32_t> offsets_r(max_elements["a"].first);
+    std::string data_r;
+    data_r.resize(max_elements["a"].second);
+    Query query_r(ctx_32, array_r);
+    query_r.set_subarray(subarray)
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_buffer("a", offsets_r, data_r);
+    query_r.submit();
+    auto result = query_r.result_buffer_elements();
+    CHECK(result["a"].first == 5);
+    CHECK(result["a"].second == 10);
+    CHECK(offsets_r == offsets);
+    CHECK(data_r == data);
+
+    // A buffer without room for the extra offset holds one cell less
+    std::vector<uint32_t> offsets_small(4);
+    Query query_small(ctx_32, array_r);
+    query_small.set_subarray(subarray)
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_buffer("a", offsets_small, data_r);
+    query_small.submit();
+    CHECK(query_small.query_status() == Query::Status::INCOMPLETE);
+    result = query_small.result_buffer_elements();
+    CHECK(result["a"].first == 4);
+    CHECK(result["a"].second == 6);
+    CHECK(offsets_small == std::vector<uint32_t>({0, 1, 3, 6}));
+    array_r.close();
+  }
+
+  SECTION("64-bit offsets with an extra element") {
+    Config config;
+    config["sm.var_offsets.extra_element"] = "true";
+    Context ctx_extra(config);
+
+    // Write
+    std::vector<uint64_t> offsets = {0, 1, 3, 6, 10};
+    Array array_w(ctx_extra, array_name, TILEDB_WRITE);
+    Query query_w(ctx_extra, array_w);
+    query_w.set_layout(TILEDB_ROW_MAJOR).set_buffer("a", offsets, data);
+    query_w.submit();
+    array_w.close();
+
+    // Read
+    std::vector<uint64_t> offsets_r(5);
+    std::string data_r;
+    data_r.resize(10);
+    Array array_r(ctx_extra, array_name, TILEDB_READ);
+    Query query_r(ctx_extra, array_r);
+    query_r.set_subarray(subarray)
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_buffer("a", offsets_r, data_r);
+    query_r.submit();
+    array_r.close();
+    CHECK(query_r.result_buffer_elements()["a"].first == 5);
+    CHECK(offsets_r == offsets);
+    CHECK(data_r == data);
+  }
+
+  // The array is readable with the default offsets
+  std::vector<uint64_t> offsets_r(4);
+  std::string data_r;
+  data_r.resize(10);
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r);
+  query_r.set_subarray(subarray)
+      .set_layout(TILEDB_ROW_MAJOR)
+      .set_buffer("a", offsets_r, data_r);
+  query_r.submit();
+  array_r.close();
+  CHECK(offsets_r == std::vector<uint64_t>({0, 1, 3, 6}));
+  CHECK(data_r == data);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
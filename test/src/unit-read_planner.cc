@@ -0,0 +1,118 @@
+/**
+ * @file unit-read_planner.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file unit-tests class ReadPlanner.
+ */
+
+#include "catch.hpp"
+#include "tiledb/sm/query/read_planner.h"
+
+using namespace tiledb::sm;
+
+TEST_CASE("ReadPlanner: Test empty plan", "[read-planner]") {
+  ReadPlanner planner(0, 100);
+  std::vector<ByteRange> ranges;
+  CHECK(planner.plan(ranges).empty());
+}
+
+TEST_CASE("ReadPlanner: Test contiguous ranges", "[read-planner]") {
+  ReadPlanner planner(0, 100);
+  std::vector<ByteRange> ranges = {{0, 10}, {10, 20}, {30, 5}};
+  auto reads = planner.plan(ranges);
+  REQUIRE(reads.size() == 1);
+  CHECK(reads[0].offset_ == 0);
+  CHECK(reads[0].size_ == 35);
+  CHECK(reads[0].ranges_ == std::vector<size_t>({0, 1, 2}));
+}
+
+TEST_CASE("ReadPlanner: Test gaps", "[read-planner]") {
+  std::vector<ByteRange> ranges = {{0, 10}, {15, 10}, {40, 10}};
+
+  SECTION("- no gap allowed") {
+    ReadPlanner planner(0, 100);
+    auto reads = planner.plan(ranges);
+    REQUIRE(reads.size() == 3);
+    for (size_t i = 0; i < 3; ++i) {
+      CHECK(reads[i].offset_ == ranges[i].offset_);
+      CHECK(reads[i].size_ == ranges[i].size_);
+      CHECK(reads[i].ranges_ == std::vector<size_t>({i}));
+    }
+  }
+
+  SECTION("- small gap allowed") {
+    ReadPlanner planner(5, 100);
+    auto reads = planner.plan(ranges);
+    REQUIRE(reads.size() == 2);
+    CHECK(reads[0].offset_ == 0);
+    CHECK(reads[0].size_ == 25);
+    CHECK(reads[0].ranges_ == std::vector<size_t>({0, 1}));
+    CHECK(reads[1].offset_ == 40);
+    CHECK(reads[1].size_ == 10);
+    CHECK(reads[1].ranges_ == std::vector<size_t>({2}));
+  }
+
+  SECTION("- large gap allowed") {
+    ReadPlanner planner(100, 100);
+    auto reads = planner.plan(ranges);
+    REQUIRE(reads.size() == 1);
+    CHECK(reads[0].offset_ == 0);
+    CHECK(reads[0].size_ == 50);
+  }
+}
+
+TEST_CASE("ReadPlanner: Test maximum read size", "[read-planner]") {
+  std::vector<ByteRange> ranges = {{0, 10}, {10, 10}, {20, 50}, {70, 10}};
+  ReadPlanner planner(0, 20);
+  auto reads = planner.plan(ranges);
+
+  // The range larger than the maximum size is read on its own
+  REQUIRE(reads.size() == 3);
+  CHECK(reads[0].offset_ == 0);
+  CHECK(reads[0].size_ == 20);
+  CHECK(reads[0].ranges_ == std::vector<size_t>({0, 1}));
+  CHECK(reads[1].offset_ == 20);
+  CHECK(reads[1].size_ == 50);
+  CHECK(reads[1].ranges_ == std::vector<size_t>({2}));
+  CHECK(reads[2].offset_ == 70);
+  CHECK(reads[2].size_ == 10);
+  CHECK(reads[2].ranges_ == std::vector<size_t>({3}));
+}
+
+TEST_CASE("ReadPlanner: Test unsorted ranges", "[read-planner]") {
+  std::vector<ByteRange> ranges = {{100, 10}, {0, 10}, {10, 10}, {110, 10}};
+  ReadPlanner planner(0, 1000);
+  auto reads = planner.plan(ranges);
+  REQUIRE(reads.size() == 2);
+  CHECK(reads[0].offset_ == 0);
+  CHECK(reads[0].size_ == 20);
+  CHECK(reads[0].ranges_ == std::vector<size_t>({1, 2}));
+  CHECK(reads[1].offset_ == 100);
+  CHECK(reads[1].size_ == 20);
+  CHECK(reads[1].ranges_ == std::vector<size_t>({0, 3}));
+}
@@ -0,0 +1,231 @@
+/**
+ * @file unit-rtree.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file unit-tests class RTree.
+ */
+
+#include "catch.hpp"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/utils.h"
+#include "tiledb/sm/rtree/rtree.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace tiledb::sm;
+
+template <class T>
+std::vector<void*> create_mbrs(const std::vector<T>& coords, unsigned dim_num) {
+  auto mbr_size = 2 * dim_num * sizeof(T);
+  auto mbr_num = coords.size() / (2 * dim_num);
+  std::vector<void*> mbrs(mbr_num);
+  for (size_t m = 0; m < mbr_num; ++m) {
+    mbrs[m] = std::malloc(mbr_size);
+    std::memcpy(mbrs[m], &coords[m * 2 * dim_num], mbr_size);
+  }
+  return mbrs;
+}
+
+void free_mbrs(std::vector<void*>* mbrs) {
+  for (auto mbr : *mbrs)
+    std::free(mbr);
+  mbrs->clear();
+}
+
+/** Returns the ids of the tiles in the overlap, sorted. */
+std::vector<uint64_t> overlap_ids(const TileOverlap& overlap) {
+  std::vector<uint64_t> ids;
+  for (const auto& tr : overlap.tile_ranges_) {
+    for (auto t = tr.first; t <= tr.second; ++t)
+      ids.push_back(t);
+  }
+  for (const auto& t : overlap.tiles_)
+    ids.push_back(t.first);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+TEST_CASE("RTree: Test empty tree", "[rtree]") {
+  RTree rtree;
+  CHECK(rtree.height() == 0);
+  CHECK(rtree.leaf_num() == 0);
+
+  std::vector<void*> mbrs;
+  RTree rtree2(Datatype::INT32, 1, 10, mbrs);
+  CHECK(rtree2.height() == 0);
+  CHECK(rtree2.leaf_num() == 0);
+
+  int rect[] = {0, 10};
+  auto overlap = rtree2.get_tile_overlap(rect);
+  CHECK(overlap.tiles_.empty());
+  CHECK(overlap.tile_ranges_.empty());
+}
+
+TEST_CASE("RTree: Test 1D tree", "[rtree]") {
+  // Seven 1D MBRs, fanout 3 -> levels with 1, 3 and 7 nodes
+  std::vector<int32_t> coords = {
+      1, 3, 5, 10, 11, 15, 20, 22, 23, 30, 31, 40, 41, 41};
+  auto mbrs = create_mbrs(coords, 1);
+  RTree rtree(Datatype::INT32, 1, 3, mbrs);
+  free_mbrs(&mbrs);
+
+  CHECK(rtree.dim_num() == 1);
+  CHECK(rtree.fanout() == 3);
+  CHECK(rtree.type() == Datatype::INT32);
+  REQUIRE(rtree.height() == 3);
+  CHECK(rtree.node_num(0) == 1);
+  CHECK(rtree.node_num(1) == 3);
+  CHECK(rtree.node_num(2) == 7);
+  CHECK(rtree.leaf_num() == 7);
+
+  // Check the internal MBRs
+  auto root = (const int32_t*)rtree.node_mbr(0, 0);
+  CHECK(root[0] == 1);
+  CHECK(root[1] == 41);
+  auto node = (const int32_t*)rtree.node_mbr(1, 1);
+  CHECK(node[0] == 20);
+  CHECK(node[1] == 40);
+  node = (const int32_t*)rtree.node_mbr(1, 2);
+  CHECK(node[0] == 41);
+  CHECK(node[1] == 41);
+
+  // No overlap
+  int32_t rect_none[] = {16, 19};
+  auto overlap = rtree.get_tile_overlap(rect_none);
+  CHECK(overlap.tiles_.empty());
+  CHECK(overlap.tile_ranges_.empty());
+
+  // Full overlap of everything
+  int32_t rect_all[] = {0, 100};
+  overlap = rtree.get_tile_overlap(rect_all);
+  CHECK(overlap.tiles_.empty());
+  REQUIRE(overlap.tile_ranges_.size() == 1);
+  CHECK(overlap.tile_ranges_[0].first == 0);
+  CHECK(overlap.tile_ranges_[0].second == 6);
+
+  // Partial overlap
+  int32_t rect_partial[] = {2, 12};
+  overlap = rtree.get_tile_overlap(rect_partial);
+  REQUIRE(overlap.tiles_.size() == 2);
+  CHECK(overlap.tiles_[0].first == 0);
+  CHECK(overlap.tiles_[0].second == (2.0 / 3));
+  CHECK(overlap.tiles_[1].first == 2);
+  CHECK(overlap.tiles_[1].second == (2.0 / 5));
+  REQUIRE(overlap.tile_ranges_.size() == 1);
+  CHECK(overlap.tile_ranges_[0].first == 1);
+  CHECK(overlap.tile_ranges_[0].second == 1);
+
+  // Adjacent fully contained ranges across subtrees are merged
+  int32_t rect_merge[] = {11, 41};
+  overlap = rtree.get_tile_overlap(rect_merge);
+  CHECK(overlap.tiles_.empty());
+  REQUIRE(overlap.tile_ranges_.size() == 1);
+  CHECK(overlap.tile_ranges_[0].first == 2);
+  CHECK(overlap.tile_ranges_[0].second == 6);
+}
+
+TEST_CASE("RTree: Test 2D tree against a linear scan", "[rtree]") {
+  // Create MBRs along a row-major sweep of a 2D grid
+  const unsigned dim_num = 2;
+  std::vector<uint64_t> coords;
+  for (uint64_t r = 0; r < 20; ++r) {
+    for (uint64_t c = 0; c < 25; ++c) {
+      coords.push_back(r * 10);
+      coords.push_back(r * 10 + 9);
+      coords.push_back(c * 4);
+      coords.push_back(c * 4 + (r % 3));
+    }
+  }
+  auto mbrs = create_mbrs(coords, dim_num);
+  for (auto fanout : {2u, 3u, 10u, 1000u}) {
+    RTree rtree(Datatype::UINT64, dim_num, fanout, mbrs);
+    CHECK(rtree.leaf_num() == mbrs.size());
+
+    std::srand(7);
+    for (int q = 0; q < 200; ++q) {
+      uint64_t rect[4];
+      for (unsigned d = 0; d < dim_num; ++d) {
+        auto a = (uint64_t)(std::rand() % 210);
+        auto b = (uint64_t)(std::rand() % 210);
+        rect[2 * d] = std::min(a, b);
+        rect[2 * d + 1] = std::max(a, b);
+      }
+
+      // Linear scan
+      std::vector<uint64_t> expected;
+      std::vector<uint64_t> expected_full;
+      bool full;
+      for (uint64_t m = 0; m < mbrs.size(); ++m) {
+        if (utils::geometry::overlap(
+                rect, (const uint64_t*)mbrs[m], dim_num, &full)) {
+          expected.push_back(m);
+          if (full)
+            expected_full.push_back(m);
+        }
+      }
+
+      auto overlap = rtree.get_tile_overlap(rect);
+      CHECK(overlap_ids(overlap) == expected);
+
+      std::vector<uint64_t> full_ids;
+      for (const auto& tr : overlap.tile_ranges_) {
+        for (auto t = tr.first; t <= tr.second; ++t)
+          full_ids.push_back(t);
+      }
+      CHECK(full_ids == expected_full);
+      for (const auto& t : overlap.tiles_) {
+        CHECK(t.second > 0.0);
+        CHECK(t.second < 1.0);
+      }
+    }
+  }
+
+  free_mbrs(&mbrs);
+}
+
+TEST_CASE("RTree: Test float tree", "[rtree]") {
+  std::vector<double> coords = {
+      0.0, 1.0, 0.0, 1.0, 1.0, 2.0, 0.0, 1.0, 0.5, 1.5, 1.0, 2.0};
+  auto mbrs = create_mbrs(coords, 2);
+  RTree rtree(Datatype::FLOAT64, 2, 2, mbrs);
+  free_mbrs(&mbrs);
+  CHECK(rtree.height() == 3);
+
+  double rect[] = {0.0, 1.0, 0.0, 1.5};
+  auto overlap = rtree.get_tile_overlap(rect);
+  REQUIRE(overlap.tile_ranges_.size() == 1);
+  CHECK(overlap.tile_ranges_[0].first == 0);
+  CHECK(overlap.tile_ranges_[0].second == 0);
+  REQUIRE(overlap.tiles_.size() == 2);
+  CHECK(overlap.tiles_[0].first == 1);
+  CHECK(overlap.tiles_[0].second == 0.0);
+  CHECK(overlap.tiles_[1].first == 2);
+  CHECK(overlap.tiles_[1].second == 0.25);
+}
@@ -270,8 +270,13 @@ Status Array::get_max_buffer_size(
         std::string("Cannot get max buffer size; Attribute '") +
         norm_attribute + "' is fixed-sized"));
 
-  // Retrieve buffer sizes
-  *buffer_off_size = it->second.first;
+  // Retrieve buffer sizes, with the offsets in the configured format
+  auto sm_params = storage_manager_->config().sm_params();
+  auto offset_size = sm_params.var_offsets_bitsize_ / 8;
+  auto cell_num = it->second.first / constants::cell_var_offset_size;
+  *buffer_off_size = cell_num * offset_size;
+  if (sm_params.var_offsets_extra_element_)
+    *buffer_off_size += offset_size;
   *buffer_val_size = it->second.second;
 
   return Status::Ok();
@@ -34,6 +34,7 @@
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/buffer/const_buffer.h"
 #include "tiledb/sm/filter/compression_filter.h"
+#include "tiledb/sm/misc/hilbert.h"
 #include "tiledb/sm/misc/logger.h"
 
 #include <cassert>
@@ -241,6 +242,23 @@ Status ArraySchema::check() const {
     }
   }
 
+  if (tile_order_ == Layout::HILBERT)
+    return LOG_STATUS(Status::ArraySchemaError(
+        "Array schema check failed; The Hilbert layout is applicable only to "
+        "the cell order"));
+
+  if (cell_order_ == Layout::HILBERT) {
+    if (array_type_ == ArrayType::DENSE)
+      return LOG_STATUS(Status::ArraySchemaError(
+          "Array schema check failed; The Hilbert cell order is applicable "
+          "only to sparse arrays"));
+    if (dim_num() > Hilbert::max_key_bits)
+      return LOG_STATUS(Status::ArraySchemaError(
+          "Array schema check failed; The Hilbert cell order supports at "
+          "most " +
+          std::to_string(Hilbert::max_key_bits) + " dimensions"));
+  }
+
   if (!check_double_delta_compressor())
     return LOG_STATUS(Status::ArraySchemaError(
         "Array schema check failed; Double delta compression can be used "
@@ -32,6 +32,7 @@
 
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/buffer/const_buffer.h"
+#include "tiledb/sm/misc/hilbert.h"
 #include "tiledb/sm/misc/logger.h"
 #include "tiledb/sm/misc/utils.h"
 
@@ -39,6 +40,7 @@
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <type_traits>
 
 /* ****************************** */
 /*             MACROS             */
@@ -61,6 +63,7 @@ Domain::Domain() {
   type_ = Datatype::INT32;
   cell_num_per_tile_ = 0;
   domain_ = nullptr;
+  hilbert_bits_ = 0;
   tile_extents_ = nullptr;
   tile_domain_ = nullptr;
 }
@@ -72,6 +75,7 @@ Domain::Domain(Datatype type)
   dim_num_ = 0;
   cell_num_per_tile_ = 0;
   domain_ = nullptr;
+  hilbert_bits_ = 0;
   tile_extents_ = nullptr;
   tile_domain_ = nullptr;
 }
@@ -80,6 +84,8 @@ Domain::Domain(const Domain* domain) {
   cell_num_per_tile_ = domain->cell_num_per_tile_;
   cell_order_ = domain->cell_order_;
   dim_num_ = domain->dim_num_;
+  hilbert_bits_ = domain->hilbert_bits_;
+  hilbert_shifts_ = domain->hilbert_shifts_;
   type_ = domain->type_;
 
   for (auto dim : domain->dimensions_)
@@ -222,10 +228,15 @@ Status Domain::split_subarray_global(
     }
   }
 
-  // Cannot split by tile, split by cell
-  if (dim_to_split == -1)
+  // Cannot split by tile, split by cell. Under the Hilbert cell order,
+  // the subarray cannot be split into two boxes that follow each other in
+  // the global order, so it is unsplittable.
+  if (dim_to_split == -1) {
+    if (cell_order_ == Layout::HILBERT)
+      return Status::Ok();
     return split_subarray_cell<T>(
         subarray, cell_order_, subarray_1, subarray_2);
+  }
 
   // Split by tile
   *subarray_1 = std::malloc(2 * dim_num_ * sizeof(T));
@@ -437,6 +448,9 @@ int Domain::cell_order_cmp(const T* coords_a, const T* coords_b) const {
       if (coords_a[i] > coords_b[i])
         return 1;
     }
+  } else if (cell_order_ == Layout::HILBERT) {  // HILBERT
+    return hilbert_order_cmp(
+        coords_a, hilbert_key(coords_a), coords_b, hilbert_key(coords_b));
   } else {  // Invalid cell order
     assert(0);
   }
@@ -582,6 +596,11 @@ Status Domain::get_cell_pos(const T* coords, uint64_t* pos) const {
     return Status::Ok();
   }
 
+  if (cell_order_ == Layout::HILBERT)
+    return LOG_STATUS(Status::DomainError(
+        "Cannot get cell position; The Hilbert cell order is applicable only "
+        "to sparse arrays"));
+
   return LOG_STATUS(
       Status::DomainError("Cannot get cell position; Invalid cell order"));
 }
@@ -702,6 +721,57 @@ void Domain::get_tile_subarray(
   }
 }
 
+unsigned Domain::hilbert_bits() const {
+  return hilbert_bits_;
+}
+
+template <class T>
+uint64_t Domain::hilbert_key(const T* coords) const {
+  assert(hilbert_bits_ > 0);
+  auto domain = static_cast<const T*>(domain_);
+  uint64_t max_coord = (hilbert_bits_ == 64) ?
+                           std::numeric_limits<uint64_t>::max() :
+                           (uint64_t(1) << hilbert_bits_) - 1;
+  uint64_t hilbert_coords[Hilbert::max_key_bits];
+  for (unsigned i = 0; i < dim_num_; ++i) {
+    if (std::is_integral<T>::value) {
+      hilbert_coords[i] = ((uint64_t)coords[i] - (uint64_t)domain[2 * i]) >>
+                          hilbert_shifts_[i];
+    } else {
+      double range = (double)domain[2 * i + 1] - (double)domain[2 * i];
+      double norm =
+          (range > 0) ? ((double)coords[i] - (double)domain[2 * i]) / range : 0;
+      double scaled = MAX(norm, 0.0) * (double)max_coord;
+      hilbert_coords[i] =
+          (scaled >= (double)max_coord) ? max_coord : (uint64_t)scaled;
+    }
+  }
+
+  return Hilbert(dim_num_, hilbert_bits_).key(hilbert_coords);
+}
+
+template <class T>
+int Domain::hilbert_order_cmp(
+    const T* coords_a,
+    uint64_t key_a,
+    const T* coords_b,
+    uint64_t key_b) const {
+  if (key_a < key_b)
+    return -1;
+  if (key_a > key_b)
+    return 1;
+
+  // Break ties in row-major order
+  for (unsigned int i = 0; i < dim_num_; ++i) {
+    if (coords_a[i] < coords_b[i])
+      return -1;
+    if (coords_a[i] > coords_b[i])
+      return 1;
+  }
+
+  return 0;
+}
+
 Status Domain::init(Layout cell_order, Layout tile_order) {
   // Set cell and tile order
   cell_order_ = cell_order;
@@ -732,6 +802,9 @@ Status Domain::init(Layout cell_order, Layout tile_order) {
   // Compute number of cells per tile
   compute_cell_num_per_tile();
 
+  // Compute the mapping of the coordinates on the Hilbert curve
+  compute_hilbert_params();
+
   // Compute tile domain
   compute_tile_domain();
 
@@ -903,6 +976,81 @@ Datatype Domain::type() const {
 /*         PRIVATE METHODS        */
 /* ****************************** */
 
+void Domain::compute_hilbert_params() {
+  // Invoke the proper templated function
+  switch (type_) {
+    case Datatype::INT32:
+      compute_hilbert_params<int>();
+      break;
+    case Datatype::INT64:
+      compute_hilbert_params<int64_t>();
+      break;
+    case Datatype::INT8:
+      compute_hilbert_params<int8_t>();
+      break;
+    case Datatype::UINT8:
+      compute_hilbert_params<uint8_t>();
+      break;
+    case Datatype::INT16:
+      compute_hilbert_params<int16_t>();
+      break;
+    case Datatype::UINT16:
+      compute_hilbert_params<uint16_t>();
+      break;
+    case Datatype::UINT32:
+      compute_hilbert_params<uint32_t>();
+      break;
+    case Datatype::UINT64:
+      compute_hilbert_params<uint64_t>();
+      break;
+    case Datatype::FLOAT32:
+      compute_hilbert_params<float>();
+      break;
+    case Datatype::FLOAT64:
+      compute_hilbert_params<double>();
+      break;
+    default:
+      return;
+  }
+}
+
+template <class T>
+void Domain::compute_hilbert_params() {
+  hilbert_bits_ = 0;
+  hilbert_shifts_.clear();
+
+  // Applicable only to the Hilbert cell order
+  if (cell_order_ != Layout::HILBERT || dim_num_ == 0 ||
+      dim_num_ > Hilbert::max_key_bits)
+    return;
+
+  // Each dimension gets an equal share of the key bits. Real dimensions use
+  // all of them, whereas integer dimensions use only as many as the widest
+  // dimension range needs, with wider ranges shifted right to fit.
+  unsigned max_bits = Hilbert::max_key_bits / dim_num_;
+  hilbert_shifts_.resize(dim_num_, 0);
+  if (!std::numeric_limits<T>::is_integer) {
+    hilbert_bits_ = max_bits;
+    return;
+  }
+
+  auto domain = static_cast<const T*>(domain_);
+  std::vector<unsigned> range_bits(dim_num_, 0);
+  unsigned bits = 1;
+  for (unsigned int i = 0; i < dim_num_; ++i) {
+    for (uint64_t range = (uint64_t)domain[2 * i + 1] - (uint64_t)domain[2 * i];
+         range != 0;
+         range >>= 1)
+      ++range_bits[i];
+    bits = MAX(bits, range_bits[i]);
+  }
+  hilbert_bits_ = MIN(bits, max_bits);
+  for (unsigned int i = 0; i < dim_num_; ++i) {
+    if (range_bits[i] > hilbert_bits_)
+      hilbert_shifts_[i] = range_bits[i] - hilbert_bits_;
+  }
+}
+
 void Domain::compute_cell_num_per_tile() {
   // Invoke the proper templated function
   switch (type_) {
@@ -1411,6 +1559,68 @@ template int Domain::cell_order_cmp<uint32_t>(
 template int Domain::cell_order_cmp<uint64_t>(
     const uint64_t* coords_a, const uint64_t* coords_b) const;
 
+template uint64_t Domain::hilbert_key<int>(const int* coords) const;
+template uint64_t Domain::hilbert_key<int64_t>(const int64_t* coords) const;
+template uint64_t Domain::hilbert_key<float>(const float* coords) const;
+template uint64_t Domain::hilbert_key<double>(const double* coords) const;
+template uint64_t Domain::hilbert_key<int8_t>(const int8_t* coords) const;
+template uint64_t Domain::hilbert_key<uint8_t>(const uint8_t* coords) const;
+template uint64_t Domain::hilbert_key<int16_t>(const int16_t* coords) const;
+template uint64_t Domain::hilbert_key<uint16_t>(const uint16_t* coords) const;
+template uint64_t Domain::hilbert_key<uint32_t>(const uint32_t* coords) const;
+template uint64_t Domain::hilbert_key<uint64_t>(const uint64_t* coords) const;
+
+template int Domain::hilbert_order_cmp<int>(
+    const int* coords_a,
+    uint64_t key_a,
+    const int* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<int64_t>(
+    const int64_t* coords_a,
+    uint64_t key_a,
+    const int64_t* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<float>(
+    const float* coords_a,
+    uint64_t key_a,
+    const float* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<double>(
+    const double* coords_a,
+    uint64_t key_a,
+    const double* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<int8_t>(
+    const int8_t* coords_a,
+    uint64_t key_a,
+    const int8_t* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<uint8_t>(
+    const uint8_t* coords_a,
+    uint64_t key_a,
+    const uint8_t* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<int16_t>(
+    const int16_t* coords_a,
+    uint64_t key_a,
+    const int16_t* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<uint16_t>(
+    const uint16_t* coords_a,
+    uint64_t key_a,
+    const uint16_t* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<uint32_t>(
+    const uint32_t* coords_a,
+    uint64_t key_a,
+    const uint32_t* coords_b,
+    uint64_t key_b) const;
+template int Domain::hilbert_order_cmp<uint64_t>(
+    const uint64_t* coords_a,
+    uint64_t key_a,
+    const uint64_t* coords_b,
+    uint64_t key_b) const;
+
 template Status Domain::get_cell_pos<int>(
     const int* coords, uint64_t* pos) const;
 template Status Domain::get_cell_pos<int64_t>(
@@ -124,6 +124,11 @@ class Domain {
    * result would be correct (i.e., the resulting cells would respect the
    * global layout).
    *
+   * Under the Hilbert cell order, a subarray can be split only across
+   * tiles, since no two boxes inside a tile are consecutive along the
+   * Hilbert curve. A subarray within a single tile is left unsplit (i.e.,
+   * the resulting subarrays are `nullptr`).
+   *
    * @tparam T The domain type.
    * @param subarray The input subarray.
    * @param layout The query layout.
@@ -197,7 +202,9 @@ class Domain {
   /**
    * Checks the cell order of the input coordinates. Note that, in the presence
    * of a regular tile grid, this function assumes that the cells are in the
-   * same regular tile.
+   * same regular tile. Under the Hilbert cell order, the Hilbert keys of
+   * both coordinates are computed on every call; sorts should precompute
+   * them and use `hilbert_order_cmp` instead.
    *
    * @tparam T The coordinates type.
    * @param coords_a The first input coordinates.
@@ -273,7 +280,8 @@ class Domain {
    *     coordinates in the array domain.
    * @pos The position of the cell coordinates in the array cell order
    *     within its corresponding tile.
-   * @return Status
+   * @return Status. It is an error under the Hilbert cell order, which
+   *     applies only to sparse arrays.
    *
    */
   template <class T>
@@ -434,6 +442,48 @@ class Domain {
   void get_tile_subarray(
       const T* domain, const T* tile_coords, T* tile_subarray) const;
 
+  /**
+   * Returns the number of bits of each coordinate mapped on the Hilbert
+   * curve, or 0 if the cell order is not `HILBERT`.
+   */
+  unsigned hilbert_bits() const;
+
+  /**
+   * Returns the Hilbert key of the input coordinates. Each coordinate is
+   * first mapped to `hilbert_bits()` bits: integer coordinates by their
+   * offset from the domain low bound, shifted right if the dimension range
+   * needs more bits; real coordinates by scaling their offset to the
+   * dimension range. Applicable only to the `HILBERT` cell order.
+   *
+   * @tparam T The coordinates type.
+   * @param coords The input coordinates.
+   * @return The Hilbert key.
+   */
+  template <class T>
+  uint64_t hilbert_key(const T* coords) const;
+
+  /**
+   * Checks the Hilbert order of the input coordinates, given their
+   * precomputed Hilbert keys. Coordinates with equal keys are ordered in
+   * row-major order, so that the order is total.
+   *
+   * @tparam T The coordinates type.
+   * @param coords_a The first input coordinates.
+   * @param key_a The Hilbert key of `coords_a`.
+   * @param coords_b The second input coordinates.
+   * @param key_b The Hilbert key of `coords_b`.
+   * @return One of the following:
+   *    - -1 if the first coordinates precede the second
+   *    -  0 if the two coordinates are identical
+   *    - +1 if the first coordinates succeed the second
+   */
+  template <class T>
+  int hilbert_order_cmp(
+      const T* coords_a,
+      uint64_t key_a,
+      const T* coords_b,
+      uint64_t key_b) const;
+
   /**
    * Initializes the domain.
    *
@@ -606,6 +656,19 @@ class Domain {
    */
   void* domain_;
 
+  /**
+   * The number of bits of each coordinate mapped on the Hilbert curve.
+   * Meaningful only for the `HILBERT` cell order.
+   */
+  unsigned hilbert_bits_;
+
+  /**
+   * The right shift that maps the offsets of the integer coordinates of each
+   * dimension to `hilbert_bits_` bits. Meaningful only for the `HILBERT` cell
+   * order.
+   */
+  std::vector<unsigned> hilbert_shifts_;
+
   /**
    * The array domain. It should contain one [lower, upper] pair per dimension.
    * The type of the values stored in this buffer should match the dimensions
@@ -654,6 +717,18 @@ class Domain {
   template <class T>
   void compute_cell_num_per_tile();
 
+  /** Computes `hilbert_bits_` and `hilbert_shifts_`. */
+  void compute_hilbert_params();
+
+  /**
+   * Computes `hilbert_bits_` and `hilbert_shifts_`.
+   *
+   * @tparam T The coordinates type.
+   * @return void
+   */
+  template <class T>
+  void compute_hilbert_params();
+
   /** Computes the tile domain. */
   void compute_tile_domain();
 
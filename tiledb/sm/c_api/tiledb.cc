@@ -45,6 +45,7 @@
 #include "tiledb/sm/misc/stats.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/query/query.h"
+#include "tiledb/sm/query/query_condition.h"
 #include "tiledb/sm/storage_manager/config.h"
 #include "tiledb/sm/storage_manager/config_iter.h"
 #include "tiledb/sm/storage_manager/context.h"
@@ -142,6 +143,14 @@ struct tiledb_query_t {
   tiledb::sm::Query* query_ = nullptr;
 };
 
+struct tiledb_query_condition_t {
+  tiledb::sm::QueryCondition* query_condition_ = nullptr;
+};
+
+struct tiledb_result_view_t {
+  tiledb::sm::ResultView* result_view_ = nullptr;
+};
+
 struct tiledb_kv_schema_t {
   tiledb::sm::ArraySchema* array_schema_ = nullptr;
 };
@@ -316,6 +325,29 @@ inline int32_t sanity_check(tiledb_ctx_t* ctx, const tiledb_domain_t* domain) {
   return TILEDB_OK;
 }
 
+inline int32_t sanity_check(
+    tiledb_ctx_t* ctx, const tiledb_query_condition_t* cond) {
+  if (cond == nullptr || cond->query_condition_ == nullptr) {
+    auto st =
+        tiledb::sm::Status::Error("Invalid TileDB query condition object");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+  return TILEDB_OK;
+}
+
+inline int32_t sanity_check(
+    tiledb_ctx_t* ctx, const tiledb_result_view_t* view) {
+  if (view == nullptr || view->result_view_ == nullptr) {
+    auto st = tiledb::sm::Status::Error("Invalid TileDB result view object");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+  return TILEDB_OK;
+}
+
 inline int32_t sanity_check(tiledb_ctx_t* ctx, const tiledb_query_t* query) {
   if (query == nullptr || query->query_ == nullptr) {
     auto st = tiledb::sm::Status::Error("Invalid TileDB query object");
@@ -2158,7 +2190,7 @@ int32_t tiledb_query_set_buffer_var(
   if (query->query_->type() == tiledb::sm::QueryType::WRITE &&
       save_error(
           ctx,
-          tiledb::sm::Query::check_var_attr_offsets(
+          query->query_->check_var_attr_offsets(
               buffer_off, buffer_off_size, buffer_val_size)))
     return TILEDB_ERR;
 
@@ -2243,6 +2275,267 @@ int32_t tiledb_query_set_layout(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_add_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* attribute,
+    tiledb_aggregate_op_t op) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (attribute == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot add aggregate; Invalid attribute");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Add aggregate
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          query->query_->add_aggregate(
+              attribute, static_cast<tiledb::sm::AggregateOp>(op))))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    tiledb_aggregate_op_t op,
+    void* value) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (attribute == nullptr || value == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get aggregate; Invalid attribute or value");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Get aggregate
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          query->query_->get_aggregate(
+              attribute, static_cast<tiledb::sm::AggregateOp>(op), value)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_set_result_views(
+    tiledb_ctx_t* ctx, tiledb_query_t* query, int32_t enabled) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  // Set result views
+  if (SAVE_ERROR_CATCH(ctx, query->query_->set_result_views(enabled != 0)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_get_result_view_num(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    uint64_t* view_num) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (attribute == nullptr || view_num == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get result view number; Invalid attribute or view number");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Get result views
+  const std::vector<tiledb::sm::ResultView>* views = nullptr;
+  if (SAVE_ERROR_CATCH(ctx, query->query_->get_result_views(attribute, &views)))
+    return TILEDB_ERR;
+
+  *view_num = (views == nullptr) ? 0 : views->size();
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_get_result_view(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    uint64_t view_idx,
+    const void** data,
+    uint64_t* size) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (attribute == nullptr || data == nullptr || size == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get result view; Invalid attribute, data or size");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Get result views
+  const std::vector<tiledb::sm::ResultView>* views = nullptr;
+  if (SAVE_ERROR_CATCH(ctx, query->query_->get_result_views(attribute, &views)))
+    return TILEDB_ERR;
+
+  if (views == nullptr || view_idx >= views->size()) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get result view; Invalid view index");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  *data = (*views)[view_idx].data_;
+  *size = (*views)[view_idx].size_;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_get_result_view_handle(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    uint64_t view_idx,
+    tiledb_result_view_t** view) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (attribute == nullptr || view == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get result view handle; Invalid attribute or view");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Get result views
+  const std::vector<tiledb::sm::ResultView>* views = nullptr;
+  if (SAVE_ERROR_CATCH(ctx, query->query_->get_result_views(attribute, &views)))
+    return TILEDB_ERR;
+
+  if (views == nullptr || view_idx >= views->size()) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get result view handle; Invalid view index");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Create result view struct, sharing the memory of the view
+  *view = new (std::nothrow) tiledb_result_view_t;
+  if (*view == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Failed to allocate TileDB result view object");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_OOM;
+  }
+  (*view)->result_view_ =
+      new (std::nothrow) tiledb::sm::ResultView((*views)[view_idx]);
+  if ((*view)->result_view_ == nullptr) {
+    delete *view;
+    *view = nullptr;
+    auto st = tiledb::sm::Status::Error(
+        "Failed to allocate TileDB result view object");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_OOM;
+  }
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_result_view_get_data(
+    tiledb_ctx_t* ctx,
+    const tiledb_result_view_t* view,
+    const void** data,
+    uint64_t* size) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR || sanity_check(ctx, view) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (data == nullptr || size == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot get result view data; Invalid data or size");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  *data = view->result_view_->data_;
+  *size = view->result_view_->size_;
+
+  return TILEDB_OK;
+}
+
+void tiledb_result_view_free(tiledb_result_view_t** view) {
+  if (view != nullptr && *view != nullptr) {
+    delete (*view)->result_view_;
+    delete *view;
+    *view = nullptr;
+  }
+}
+
+int32_t tiledb_query_add_range(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    uint32_t dim_idx,
+    const void* start,
+    const void* end) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  // Add range
+  if (SAVE_ERROR_CATCH(ctx, query->query_->add_range(dim_idx, start, end)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_set_condition(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const tiledb_query_condition_t* cond) {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR ||
+      sanity_check(ctx, cond) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  // Set condition
+  if (SAVE_ERROR_CATCH(
+          ctx, query->query_->set_condition(*cond->query_condition_)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_query_finalize(tiledb_ctx_t* ctx, tiledb_query_t* query) {
   // Trivial case
   if (query == nullptr)
@@ -2327,6 +2620,109 @@ int32_t tiledb_query_get_type(
   return TILEDB_OK;
 }
 
+/* ****************************** */
+/*         QUERY CONDITION        */
+/* ****************************** */
+
+int32_t tiledb_query_condition_alloc(
+    tiledb_ctx_t* ctx, tiledb_query_condition_t** cond) {
+  if (sanity_check(ctx) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  // Create query condition struct
+  *cond = new (std::nothrow) tiledb_query_condition_t;
+  if (*cond == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Failed to allocate TileDB query condition object");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_OOM;
+  }
+
+  // Create QueryCondition object
+  (*cond)->query_condition_ = new (std::nothrow) tiledb::sm::QueryCondition();
+  if ((*cond)->query_condition_ == nullptr) {
+    delete *cond;
+    *cond = nullptr;
+    auto st = tiledb::sm::Status::Error(
+        "Failed to allocate TileDB query condition object");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_OOM;
+  }
+
+  // Success
+  return TILEDB_OK;
+}
+
+void tiledb_query_condition_free(tiledb_query_condition_t** cond) {
+  if (cond != nullptr && *cond != nullptr) {
+    delete (*cond)->query_condition_;
+    delete *cond;
+    *cond = nullptr;
+  }
+}
+
+int32_t tiledb_query_condition_init(
+    tiledb_ctx_t* ctx,
+    tiledb_query_condition_t* cond,
+    const char* attribute_name,
+    const void* condition_value,
+    uint64_t condition_value_size,
+    tiledb_query_condition_op_t op) {
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, cond) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (attribute_name == nullptr) {
+    auto st = tiledb::sm::Status::Error(
+        "Cannot initialize query condition; Invalid attribute name");
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          cond->query_condition_->init(
+              attribute_name,
+              condition_value,
+              condition_value_size,
+              static_cast<tiledb::sm::QueryConditionOp>(op))))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_condition_combine(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_condition_t* left_cond,
+    const tiledb_query_condition_t* right_cond,
+    tiledb_query_condition_combination_op_t combination_op,
+    tiledb_query_condition_t** combined_cond) {
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, left_cond) == TILEDB_ERR ||
+      sanity_check(ctx, right_cond) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  // Create the combined query condition
+  if (tiledb_query_condition_alloc(ctx, combined_cond) != TILEDB_OK)
+    return TILEDB_ERR;
+
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          left_cond->query_condition_->combine(
+              *right_cond->query_condition_,
+              static_cast<tiledb::sm::QueryConditionCombinationOp>(
+                  combination_op),
+              (*combined_cond)->query_condition_))) {
+    tiledb_query_condition_free(combined_cond);
+    return TILEDB_ERR;
+  }
+
+  return TILEDB_OK;
+}
+
 /* ****************************** */
 /*              ARRAY             */
 /* ****************************** */
@@ -150,6 +150,30 @@ typedef enum {
 #undef TILEDB_WALK_ORDER_ENUM
 } tiledb_walk_order_t;
 
+/** Query condition operator. */
+typedef enum {
+/** Helper macro for defining query condition operator enums. */
+#define TILEDB_QUERY_CONDITION_OP_ENUM(id) TILEDB_##id
+#include "tiledb_enum.h"
+#undef TILEDB_QUERY_CONDITION_OP_ENUM
+} tiledb_query_condition_op_t;
+
+/** Query condition combination operator. */
+typedef enum {
+/** Helper macro for defining query condition combination operator enums. */
+#define TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM(id) TILEDB_##id
+#include "tiledb_enum.h"
+#undef TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM
+} tiledb_query_condition_combination_op_t;
+
+/** Aggregate operator. */
+typedef enum {
+/** Helper macro for defining aggregate operator enums. */
+#define TILEDB_AGGREGATE_OP_ENUM(id) TILEDB_##id
+#include "tiledb_enum.h"
+#undef TILEDB_AGGREGATE_OP_ENUM
+} tiledb_aggregate_op_t;
+
 /** VFS mode. */
 typedef enum {
 /** Helper macro for defining VFS mode enums. */
@@ -264,6 +288,12 @@ typedef struct tiledb_filter_list_t tiledb_filter_list_t;
 /** A TileDB query. */
 typedef struct tiledb_query_t tiledb_query_t;
 
+/** A TileDB query condition. */
+typedef struct tiledb_query_condition_t tiledb_query_condition_t;
+
+/** A handle to a result view, which keeps the results of the view alive. */
+typedef struct tiledb_result_view_t tiledb_result_view_t;
+
 /** A key-value store schema. */
 typedef struct tiledb_kv_schema_t tiledb_kv_schema_t;
 
@@ -393,6 +423,71 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config);
  * - `sm.tile_cache_size` <br>
  *    The tile cache size in bytes. Any `uint64_t` value is acceptable. <br>
  *    **Default**: 10,000,000
+ * - `sm.read_inflight_size` <br>
+ *    The maximum number of bytes of (persisted) tiles that a read query
+ *    fetches and unfilters concurrently. Tiles are streamed from storage
+ *    through the filter pipeline to the result buffers, and new tile
+ *    reads are issued only when earlier ones have completed within this
+ *    budget. At least one tile is always in flight. <br>
+ *    **Default**: 100,000,000
+ * - `sm.read_coalesce_gap` <br>
+ *    Tiles of the same file that are at most this many bytes apart are
+ *    fetched with a single read request, discarding the bytes in between.
+ *    <br>
+ *    **Default**: 65536
+ * - `sm.read_coalesce_max_size` <br>
+ *    The maximum number of bytes of a single coalesced tile read request.
+ *    A tile larger than this is still fetched with a single request. <br>
+ *    **Default**: 10485760
+ * - `sm.read_prefetch_partitions` <br>
+ *    The number of subarray partitions that an incomplete read query
+ *    fetches and decodes ahead of the user into internal staging buffers,
+ *    so that the next submission returns an already prepared partition.
+ *    `0` disables prefetching. <br>
+ *    **Default**: 0
+ * - `sm.read_prefetch_memory_budget` <br>
+ *    The maximum number of bytes of the staging buffers of the prefetched
+ *    partitions. Every prefetched partition needs as much memory as the
+ *    user buffers, so fewer partitions are prefetched if they do not fit.
+ *    <br>
+ *    **Default**: 1,000,000,000
+ * - `sm.memory_budget` <br>
+ *    The maximum number of bytes of the fixed-sized tiles (including
+ *    offsets and coordinates) that a read or write query holds in memory
+ *    at once. Reads partition the subarray further if the tiles that
+ *    overlap with a partition exceed it, and never keep more tile bytes in
+ *    flight. Writes prepare, filter and write the attributes in groups
+ *    whose tiles fit in it. <br>
+ *    **Default**: 5GB
+ * - `sm.memory_budget_var` <br>
+ *    The same as `sm.memory_budget`, but for the tiles of the values of
+ *    var-sized attributes. <br>
+ *    **Default**: 10GB
+ * - `sm.write_batch_size` <br>
+ *    The maximum number of (unfiltered) tile bytes of an attribute that
+ *    global order writes filter and write together. The write of a batch
+ *    overlaps with the filtering of the next one. <br>
+ *    **Default**: 10,000,000
+ * - `sm.write_staging_buffers` <br>
+ *    If greater than 0, write queries copy each submitted batch into one of
+ *    this many internal staging buffers and return immediately, filtering
+ *    and writing the batch in the background. The query buffers can then
+ *    be refilled with the next batch right away. A submission waits only
+ *    when all staging buffers are in use. Such queries must be finalized
+ *    in every layout, which waits for all batches to be written. Errors
+ *    of background writes are returned by the next submissions or by
+ *    finalization. <br>
+ *    **Default**: 0
+ * - `sm.var_offsets.bitsize` <br>
+ *    The size in bits (`32` or `64`) of the offsets of the var-sized
+ *    attribute buffers of read and write queries. <br>
+ *    **Default**: 64
+ * - `sm.var_offsets.extra_element` <br>
+ *    If `true`, the offsets of the var-sized attribute buffers of read and
+ *    write queries end with an extra element holding the total size of
+ *    the values, i.e., `N` cells have `N+1` offsets (as in Apache Arrow).
+ *    <br>
+ *    **Default**: false
  * - `sm.array_schema_cache_size` <br>
  *    The array schema cache size in bytes. Any `uint64_t` value is acceptable.
  * <br>
@@ -431,6 +526,14 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config);
  *    The maximum number of parallel operations on objects with `file:///`
  *    URIs. <br>
  *    **Default**: `vfs.num_threads`
+ * - `vfs.file.max_open_files` <br>
+ *    The maximum number of file descriptors that each VFS instance keeps
+ *    open for reading and appending to `file:///` objects, evicting the
+ *    least recently used ones. `0` disables caching. The limit applies to
+ *    every VFS instance separately (each context has its own), so it
+ *    must be set well below the process limit on open files when many
+ *    contexts or VFS objects are in use. <br>
+ *    **Default**: 256
  * - `vfs.s3.region` <br>
  *    The S3 region, if S3 is enabled. <br>
  *    **Default**: us-east-1
@@ -1810,7 +1913,10 @@ TILEDB_EXPORT int32_t tiledb_array_schema_set_capacity(
  *
  * @param ctx The TileDB context.
  * @param array_schema The array schema.
- * @param cell_order The cell order to be set.
+ * @param cell_order The cell order to be set. Besides `TILEDB_ROW_MAJOR`
+ *     and `TILEDB_COL_MAJOR`, sparse arrays accept `TILEDB_HILBERT`, which
+ *     sorts the cells along a Hilbert curve over the domain so that the
+ *     cells of each data tile (and hence its MBR) are compact in space.
  * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
  */
 TILEDB_EXPORT int32_t tiledb_array_schema_set_cell_order(
@@ -2431,7 +2537,11 @@ TILEDB_EXPORT int32_t tiledb_query_set_buffer(
  * @param attribute The attribute to set the buffer for.
  * @param buffer_off The buffer that either have the input data to be written,
  *     or will hold the data to be read. This buffer holds the starting offsets
- *     of each cell value in `buffer_val`.
+ *     of each cell value in `buffer_val`. The offsets are 64-bit unless
+ *     `sm.var_offsets.bitsize` is `32`, in which case `buffer_off` is
+ *     accessed as a `uint32_t` array, and they end with an extra element
+ *     holding the total size of the values if
+ *     `sm.var_offsets.extra_element` is `true`.
  * @param buffer_off_size In the case of writes, it is the size of `buffer_off`
  *     in bytes. In the case of reads, this initially contains the allocated
  *     size of `buffer_off`, but after the termination of the function
@@ -2547,6 +2657,263 @@ TILEDB_EXPORT int32_t tiledb_query_get_buffer_var(
 TILEDB_EXPORT int32_t tiledb_query_set_layout(
     tiledb_ctx_t* ctx, tiledb_query_t* query, tiledb_layout_t layout);
 
+/**
+ * Adds an aggregate on an attribute of a read query on a sparse array.
+ * An aggregate query does not copy any results to buffers (and no buffers
+ * may be set); instead, the results in the subarray (after applying any
+ * ranges and query condition) are reduced inside TileDB, and only the
+ * tiles that are needed to compute the aggregates are fetched. The result
+ * is retrieved with `tiledb_query_get_aggregate` after the query is
+ * submitted.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_add_aggregate(ctx, query, "a1", TILEDB_AGGREGATE_SUM);
+ * tiledb_query_submit(ctx, query);
+ * int64_t sum;
+ * tiledb_query_get_aggregate(ctx, query, "a1", TILEDB_AGGREGATE_SUM, &sum);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param attribute The attribute. `TILEDB_AGGREGATE_COUNT` is applicable
+ *     to any attribute (including `TILEDB_COORDS`); the other operators
+ *     only to numeric fixed-sized attributes with a single value per cell.
+ * @param op The aggregate operator.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_add_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* attribute,
+    tiledb_aggregate_op_t op);
+
+/**
+ * Retrieves the result of an aggregate of a completed read query. The
+ * type of the result depends on the operator:
+ *
+ *    - `TILEDB_AGGREGATE_COUNT`: `uint64_t`
+ *    - `TILEDB_AGGREGATE_SUM`: `int64_t` for signed integer attributes,
+ *      `uint64_t` for unsigned integer attributes and `double` for real
+ *      attributes.
+ *    - `TILEDB_AGGREGATE_MIN`, `TILEDB_AGGREGATE_MAX`: the attribute type.
+ *    - `TILEDB_AGGREGATE_MEAN`: `double`
+ *
+ * The minimum, maximum and mean of an empty result are errors.
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param attribute The attribute.
+ * @param op The aggregate operator.
+ * @param value The result to be retrieved.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    tiledb_aggregate_op_t op,
+    void* value);
+
+/**
+ * Enables or disables result views for a read query. With result views,
+ * the results of the fixed-sized attributes are not copied into the query
+ * buffers; instead, they are exposed as read-only views into memory owned
+ * by TileDB (mostly the decoded tiles), retrieved with
+ * `tiledb_query_get_result_view` after each submission. The buffers must
+ * still be set; their sizes are set to the sizes of the results, but they
+ * are not written and do not bound the results. Instead, each submission
+ * views at most `sm.memory_budget` bytes per attribute. This avoids
+ * copying the results of queries that only scan them. The results of
+ * var-sized attributes and the coordinates of dense arrays are still
+ * copied into the buffers. It must be called before the first submission.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_set_result_views(ctx, query, 1);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param enabled Non-zero to enable result views, zero to disable them.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_set_result_views(
+    tiledb_ctx_t* ctx, tiledb_query_t* query, int32_t enabled);
+
+/**
+ * Retrieves the number of result views of a fixed-sized attribute for the
+ * last submission of a query with result views enabled.
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param attribute The attribute.
+ * @param view_num The number of views to be retrieved.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_result_view_num(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    uint64_t* view_num);
+
+/**
+ * Retrieves a result view of a fixed-sized attribute for the last
+ * submission of a query with result views enabled. Concatenating the
+ * views in order yields the results that would otherwise be copied into
+ * the buffer of the attribute. The view is valid until the next
+ * submission of the query or until the query is freed; use
+ * `tiledb_query_get_result_view_handle` to keep it longer.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * uint64_t view_num;
+ * tiledb_query_get_result_view_num(ctx, query, "a1", &view_num);
+ * for (uint64_t i = 0; i < view_num; ++i) {
+ *   const void* data;
+ *   uint64_t size;
+ *   tiledb_query_get_result_view(ctx, query, "a1", i, &data, &size);
+ *   // Scan `size` bytes starting at `data`
+ * }
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param attribute The attribute.
+ * @param view_idx The index of the view.
+ * @param data Set to the start of the results of the view.
+ * @param size Set to the size (in bytes) of the results of the view.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_result_view(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    uint64_t view_idx,
+    const void** data,
+    uint64_t* size);
+
+/**
+ * Retrieves a handle to a result view of a fixed-sized attribute for the
+ * last submission of a query with result views enabled (see
+ * `tiledb_query_get_result_view`). The handle keeps the results of the view
+ * alive until it is freed, even after the next submission of the query or
+ * after the query is freed.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_result_view_t* view;
+ * tiledb_query_get_result_view_handle(ctx, query, "a1", 0, &view);
+ * tiledb_query_free(&query);
+ * const void* data;
+ * uint64_t size;
+ * tiledb_result_view_get_data(ctx, view, &data, &size);
+ * // Scan `size` bytes starting at `data`
+ * tiledb_result_view_free(&view);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param attribute The attribute.
+ * @param view_idx The index of the view.
+ * @param view The result view handle to be allocated.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_result_view_handle(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* attribute,
+    uint64_t view_idx,
+    tiledb_result_view_t** view);
+
+/**
+ * Retrieves the results of a result view handle.
+ *
+ * @param ctx The TileDB context.
+ * @param view The result view handle.
+ * @param data Set to the start of the results of the view.
+ * @param size Set to the size (in bytes) of the results of the view.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_result_view_get_data(
+    tiledb_ctx_t* ctx,
+    const tiledb_result_view_t* view,
+    const void** data,
+    uint64_t* size);
+
+/**
+ * Frees a result view handle, releasing the results of the view unless
+ * other views or the query still use them.
+ *
+ * @param view The result view handle to be freed.
+ */
+TILEDB_EXPORT void tiledb_result_view_free(tiledb_result_view_t** view);
+
+/**
+ * Adds a range along a dimension of a read query on a sparse array. The
+ * query results are the cells in the cross product of the ranges of all
+ * dimensions, i.e., several disjoint regions can be read with a single
+ * query. The dimensions without any added range are constrained only by
+ * the subarray. A tile that overlaps with several ranges is fetched and
+ * decompressed once.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * // Read rows 1-2 and 5-6, columns 3-4
+ * uint64_t r1[] = {1, 2}, r2[] = {5, 6}, c[] = {3, 4};
+ * tiledb_query_add_range(ctx, query, 0, &r1[0], &r1[1]);
+ * tiledb_query_add_range(ctx, query, 0, &r2[0], &r2[1]);
+ * tiledb_query_add_range(ctx, query, 1, &c[0], &c[1]);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param dim_idx The index of the dimension.
+ * @param start The range start, of the domain type.
+ * @param end The range end (inclusive), of the domain type.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_add_range(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    uint32_t dim_idx,
+    const void* start,
+    const void* end);
+
+/**
+ * Sets the query condition of a read query on a sparse array. Only the
+ * cells that satisfy the condition are returned as results, i.e., the
+ * condition is evaluated inside TileDB before any data is copied to the
+ * user buffers. The query keeps a copy of the condition, which can thus
+ * be freed after this call.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_condition_t* cond;
+ * tiledb_query_condition_alloc(ctx, &cond);
+ * int32_t value = 5;
+ * tiledb_query_condition_init(
+ *     ctx, cond, "a1", &value, sizeof(value), TILEDB_GT);
+ * tiledb_query_set_condition(ctx, query, cond);
+ * tiledb_query_condition_free(&cond);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param cond The query condition.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_set_condition(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const tiledb_query_condition_t* cond);
+
 /**
  * Flushes all internal state of a query object and finalizes the query.
  * This is applicable only to global layout writes. It has no effect for
@@ -2713,6 +3080,107 @@ TILEDB_EXPORT int32_t tiledb_query_get_status(
 TILEDB_EXPORT int32_t tiledb_query_get_type(
     tiledb_ctx_t* ctx, tiledb_query_t* query, tiledb_query_type_t* query_type);
 
+/* ********************************* */
+/*          QUERY CONDITION          */
+/* ********************************* */
+
+/**
+ * Allocates a TileDB query condition object.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_condition_t* cond;
+ * tiledb_query_condition_alloc(ctx, &cond);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param cond The query condition object to be allocated.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_condition_alloc(
+    tiledb_ctx_t* ctx, tiledb_query_condition_t** cond);
+
+/**
+ * Frees a TileDB query condition object.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_condition_t* cond;
+ * tiledb_query_condition_alloc(ctx, &cond);
+ * tiledb_query_condition_free(&cond);
+ * @endcode
+ *
+ * @param cond The query condition object to be freed.
+ */
+TILEDB_EXPORT void tiledb_query_condition_free(tiledb_query_condition_t** cond);
+
+/**
+ * Initializes a TileDB query condition object as a comparison of an
+ * attribute against a value, i.e., `attribute op value`. The attribute must
+ * be fixed-sized, with a single value per cell.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_condition_t* cond;
+ * tiledb_query_condition_alloc(ctx, &cond);
+ * float value = 1.5f;
+ * tiledb_query_condition_init(
+ *     ctx, cond, "a3", &value, sizeof(value), TILEDB_LE);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param cond The query condition to initialize.
+ * @param attribute_name The name of the attribute to compare.
+ * @param condition_value The value to compare against. Its type must match
+ *     the attribute type.
+ * @param condition_value_size The size of `condition_value` in bytes.
+ * @param op The comparison operator, i.e., one of `TILEDB_LT`, `TILEDB_LE`,
+ *     `TILEDB_GT`, `TILEDB_GE`, `TILEDB_EQ` and `TILEDB_NE`.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_condition_init(
+    tiledb_ctx_t* ctx,
+    tiledb_query_condition_t* cond,
+    const char* attribute_name,
+    const void* condition_value,
+    uint64_t condition_value_size,
+    tiledb_query_condition_op_t op);
+
+/**
+ * Combines two query conditions with a logical operator into a new query
+ * condition. The input conditions are not modified.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * // a1 >= 2 AND a1 < 6
+ * tiledb_query_condition_t *lhs, *rhs, *combined;
+ * int32_t low = 2, high = 6;
+ * tiledb_query_condition_alloc(ctx, &lhs);
+ * tiledb_query_condition_init(ctx, lhs, "a1", &low, sizeof(low), TILEDB_GE);
+ * tiledb_query_condition_alloc(ctx, &rhs);
+ * tiledb_query_condition_init(ctx, rhs, "a1", &high, sizeof(high), TILEDB_LT);
+ * tiledb_query_condition_combine(ctx, lhs, rhs, TILEDB_AND, &combined);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param left_cond The first query condition.
+ * @param right_cond The second query condition.
+ * @param combination_op The logical operator, i.e., `TILEDB_AND` or
+ *     `TILEDB_OR`.
+ * @param combined_cond The combined query condition to be allocated.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_condition_combine(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_condition_t* left_cond,
+    const tiledb_query_condition_t* right_cond,
+    tiledb_query_condition_combination_op_t combination_op,
+    tiledb_query_condition_t** combined_cond);
+
 /* ********************************* */
 /*               ARRAY               */
 /* ********************************* */
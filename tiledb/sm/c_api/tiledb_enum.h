@@ -106,6 +106,9 @@
     TILEDB_LAYOUT_ENUM(GLOBAL_ORDER) = 2,
     /** Unordered layout */
     TILEDB_LAYOUT_ENUM(UNORDERED) = 3,
+    /** Hilbert-curve layout (applicable only to the cell order of sparse
+     * arrays) */
+    TILEDB_LAYOUT_ENUM(HILBERT) = 4,
 #endif
 
 #ifdef TILEDB_COMPRESSOR_ENUM
@@ -186,6 +189,42 @@
     TILEDB_WALK_ORDER_ENUM(POSTORDER) = 1,
 #endif
 
+#ifdef TILEDB_QUERY_CONDITION_OP_ENUM
+    /** Less-than comparison */
+    TILEDB_QUERY_CONDITION_OP_ENUM(LT) = 0,
+    /** Less-than-or-equal comparison */
+    TILEDB_QUERY_CONDITION_OP_ENUM(LE) = 1,
+    /** Greater-than comparison */
+    TILEDB_QUERY_CONDITION_OP_ENUM(GT) = 2,
+    /** Greater-than-or-equal comparison */
+    TILEDB_QUERY_CONDITION_OP_ENUM(GE) = 3,
+    /** Equality comparison */
+    TILEDB_QUERY_CONDITION_OP_ENUM(EQ) = 4,
+    /** Inequality comparison */
+    TILEDB_QUERY_CONDITION_OP_ENUM(NE) = 5,
+#endif
+
+#ifdef TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM
+    /** Logical AND */
+    TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM(AND) = 0,
+    /** Logical OR */
+    TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM(OR) = 1,
+#endif
+
+/** TileDB aggregate operator */
+#ifdef TILEDB_AGGREGATE_OP_ENUM
+    /** Number of cells */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_COUNT) = 0,
+    /** Sum of the cell values */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_SUM) = 1,
+    /** Minimum cell value */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_MIN) = 2,
+    /** Maximum cell value */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_MAX) = 3,
+    /** Mean of the cell values */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_MEAN) = 4,
+#endif
+
 /** TileDB VFS mode */
 #ifdef TILEDB_VFS_MODE_ENUM
     /** Read mode */
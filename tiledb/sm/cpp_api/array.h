@@ -689,6 +689,8 @@ class Array {
     std::unordered_map<std::string, std::pair<uint64_t, uint64_t>> ret;
     auto schema_attrs = schema_.attributes();
     uint64_t attr_size, type_size;
+    uint64_t offset_size =
+        std::stoull(ctx.config().get("sm.var_offsets.bitsize")) / 8;
 
     for (const auto& a : schema_attrs) {
       auto var = a.second.cell_val_num() == TILEDB_VAR_NUM;
@@ -705,7 +707,7 @@ class Array {
             &size_off,
             &size_val));
         ret[a.first] = std::pair<uint64_t, uint64_t>(
-            size_off / TILEDB_OFFSET_SIZE, size_val / type_size);
+            size_off / offset_size, size_val / type_size);
       } else {
         ctx.handle_error(tiledb_array_max_buffer_size(
             ctx, array_.get(), name.c_str(), subarray.data(), &attr_size));
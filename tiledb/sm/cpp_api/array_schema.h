@@ -278,7 +278,8 @@ class ArraySchema : public Schema {
   /**
    * Sets the cell order.
    *
-   * @param layout Cell order to set.
+   * @param layout Cell order to set. `TILEDB_HILBERT` is applicable only to
+   *     sparse arrays.
    * @return Reference to this `ArraySchema` instance.
    */
   ArraySchema& set_cell_order(tiledb_layout_t layout) {
@@ -620,6 +621,8 @@ class ArraySchema : public Schema {
         return "COL-MAJOR";
       case TILEDB_UNORDERED:
         return "UNORDERED";
+      case TILEDB_HILBERT:
+        return "HILBERT";
     }
     return "";
   }
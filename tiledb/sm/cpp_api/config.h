@@ -246,6 +246,71 @@ class Config {
    * - `sm.tile_cache_size` <br>
    *    The tile cache size in bytes. Any `uint64_t` value is acceptable. <br>
    *    **Default**: 10,000,000
+   * - `sm.read_inflight_size` <br>
+   *    The maximum number of bytes of (persisted) tiles that a read query
+   *    fetches and unfilters concurrently. Tiles are streamed from storage
+   *    through the filter pipeline to the result buffers, and new tile
+   *    reads are issued only when earlier ones have completed within this
+   *    budget. At least one tile is always in flight. <br>
+   *    **Default**: 100,000,000
+   * - `sm.read_coalesce_gap` <br>
+   *    Tiles of the same file that are at most this many bytes apart are
+   *    fetched with a single read request, discarding the bytes in between.
+   *    <br>
+   *    **Default**: 65536
+   * - `sm.read_coalesce_max_size` <br>
+   *    The maximum number of bytes of a single coalesced tile read request.
+   *    A tile larger than this is still fetched with a single request. <br>
+   *    **Default**: 10485760
+   * - `sm.read_prefetch_partitions` <br>
+   *    The number of subarray partitions that an incomplete read query
+   *    fetches and decodes ahead of the user into internal staging buffers,
+   *    so that the next submission returns an already prepared partition.
+   *    `0` disables prefetching. <br>
+   *    **Default**: 0
+   * - `sm.read_prefetch_memory_budget` <br>
+   *    The maximum number of bytes of the staging buffers of the prefetched
+   *    partitions. Every prefetched partition needs as much memory as the
+   *    user buffers, so fewer partitions are prefetched if they do not fit.
+   *    <br>
+   *    **Default**: 1,000,000,000
+   * - `sm.memory_budget` <br>
+   *    The maximum number of bytes of the fixed-sized tiles (including
+   *    offsets and coordinates) that a read or write query holds in memory
+   *    at once. Reads partition the subarray further if the tiles that
+   *    overlap with a partition exceed it, and never keep more tile bytes in
+   *    flight. Writes prepare, filter and write the attributes in groups
+   *    whose tiles fit in it. <br>
+   *    **Default**: 5GB
+   * - `sm.memory_budget_var` <br>
+   *    The same as `sm.memory_budget`, but for the tiles of the values of
+   *    var-sized attributes. <br>
+   *    **Default**: 10GB
+   * - `sm.write_batch_size` <br>
+   *    The maximum number of (unfiltered) tile bytes of an attribute that
+   *    global order writes filter and write together. The write of a batch
+   *    overlaps with the filtering of the next one. <br>
+   *    **Default**: 10,000,000
+   * - `sm.write_staging_buffers` <br>
+   *    If greater than 0, write queries copy each submitted batch into one of
+   *    this many internal staging buffers and return immediately, filtering
+   *    and writing the batch in the background. The query buffers can then
+   *    be refilled with the next batch right away. A submission waits only
+   *    when all staging buffers are in use. Such queries must be finalized
+   *    in every layout, which waits for all batches to be written. Errors
+   *    of background writes are returned by the next submissions or by
+   *    finalization. <br>
+   *    **Default**: 0
+   * - `sm.var_offsets.bitsize` <br>
+   *    The size in bits (`32` or `64`) of the offsets of the var-sized
+   *    attribute buffers of read and write queries. <br>
+   *    **Default**: 64
+   * - `sm.var_offsets.extra_element` <br>
+   *    If `true`, the offsets of the var-sized attribute buffers of read and
+   *    write queries end with an extra element holding the total size of
+   *    the values, i.e., `N` cells have `N+1` offsets (as in Apache Arrow).
+   *    <br>
+   *    **Default**: false
    * - `sm.array_schema_cache_size` <br>
    *    The array schema cache size in bytes. Any `uint64_t` value is
    *    acceptable. <br>
@@ -285,6 +350,14 @@ class Config {
    *    The maximum number of parallel operations on objects with `file:///`
    *    URIs. <br>
    *    **Default**: `vfs.num_threads`
+   * - `vfs.file.max_open_files` <br>
+   *    The maximum number of file descriptors that each VFS instance keeps
+   *    open for reading and appending to `file:///` objects, evicting the
+   *    least recently used ones. `0` disables caching. The limit applies to
+   *    every VFS instance separately (each context has its own), so it
+   *    must be set well below the process limit on open files when many
+   *    contexts or VFS objects are in use. <br>
+   *    **Default**: 256
    * - `vfs.s3.region` <br>
    *    The S3 region, if S3 is enabled. <br>
    *    **Default**: us-east-1
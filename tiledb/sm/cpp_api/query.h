@@ -41,6 +41,7 @@
 #include "core_interface.h"
 #include "deleter.h"
 #include "exception.h"
+#include "query_condition.h"
 #include "tiledb.h"
 #include "type.h"
 #include "utils.h"
@@ -213,6 +214,157 @@ class Query {
     return *this;
   }
 
+  /**
+   * Adds a range along a dimension. Applicable only to read queries on
+   * sparse arrays. The results are the cells in the cross product of the
+   * ranges of all dimensions; the dimensions without any added range are
+   * constrained only by the subarray.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * // Read rows 1-2 and 5-6, columns 3-4
+   * query.add_range<uint64_t>(0, 1, 2)
+   *     .add_range<uint64_t>(0, 5, 6)
+   *     .add_range<uint64_t>(1, 3, 4);
+   * @endcode
+   *
+   * @tparam T The domain type.
+   * @param dim_idx The index of the dimension.
+   * @param start The range start.
+   * @param end The range end (inclusive).
+   * @return Reference to this Query
+   */
+  template <typename T>
+  Query& add_range(uint32_t dim_idx, T start, T end) {
+    impl::type_check<T>(schema_.domain().type());
+    auto& ctx = ctx_.get();
+    ctx.handle_error(
+        tiledb_query_add_range(ctx, query_.get(), dim_idx, &start, &end));
+    return *this;
+  }
+
+  /**
+   * Adds an aggregate on an attribute. Applicable only to read queries on
+   * sparse arrays; the results are reduced inside TileDB instead of being
+   * copied to buffers.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * query.add_aggregate("a1", TILEDB_AGGREGATE_SUM);
+   * query.submit();
+   * auto sum = query.get_aggregate<int64_t>("a1", TILEDB_AGGREGATE_SUM);
+   * @endcode
+   *
+   * @param attr The attribute name.
+   * @param op The aggregate operator.
+   * @return Reference to this Query
+   */
+  Query& add_aggregate(const std::string& attr, tiledb_aggregate_op_t op) {
+    auto& ctx = ctx_.get();
+    ctx.handle_error(
+        tiledb_query_add_aggregate(ctx, query_.get(), attr.c_str(), op));
+    return *this;
+  }
+
+  /**
+   * Retrieves the result of an aggregate, after the query completes.
+   *
+   * @tparam T The result type, i.e., `uint64_t` for counts, `int64_t`,
+   *     `uint64_t` or `double` for sums (depending on the attribute type),
+   *     the attribute type for minimums and maximums, and `double` for means.
+   * @param attr The attribute name.
+   * @param op The aggregate operator.
+   * @return The result of the aggregate.
+   */
+  template <typename T>
+  T get_aggregate(const std::string& attr, tiledb_aggregate_op_t op) const {
+    auto& ctx = ctx_.get();
+    T value;
+    ctx.handle_error(tiledb_query_get_aggregate(
+        ctx, query_.get(), attr.c_str(), op, &value));
+    return value;
+  }
+
+  /**
+   * Enables or disables result views. With result views, the results of
+   * the fixed-sized attributes are not copied into the buffers; instead,
+   * they are retrieved after each submission as read-only views into
+   * memory owned by TileDB with `result_views`. The buffers must still be
+   * set, but they do not bound the viewed results; each submission views
+   * at most `sm.memory_budget` bytes per attribute.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * query.set_result_views(true);
+   * query.submit();
+   * for (const auto& view : query.result_views("a1")) {
+   *   auto data = static_cast<const int*>(view.first);
+   *   auto num = view.second / sizeof(int);
+   *   // Scan `num` values starting at `data`
+   * }
+   * @endcode
+   *
+   * @param enabled `true` to enable result views.
+   * @return Reference to this Query
+   */
+  Query& set_result_views(bool enabled) {
+    auto& ctx = ctx_.get();
+    ctx.handle_error(
+        tiledb_query_set_result_views(ctx, query_.get(), enabled ? 1 : 0));
+    return *this;
+  }
+
+  /**
+   * Retrieves the result views of a fixed-sized attribute for the last
+   * submission. The views are valid until the next submission.
+   *
+   * @param attr The attribute name.
+   * @return The views, as (data, size in bytes) pairs in the order of the
+   *     results.
+   */
+  std::vector<std::pair<const void*, uint64_t>> result_views(
+      const std::string& attr) const {
+    auto& ctx = ctx_.get();
+    uint64_t view_num;
+    ctx.handle_error(tiledb_query_get_result_view_num(
+        ctx, query_.get(), attr.c_str(), &view_num));
+    std::vector<std::pair<const void*, uint64_t>> views(view_num);
+    for (uint64_t i = 0; i < view_num; ++i)
+      ctx.handle_error(tiledb_query_get_result_view(
+          ctx,
+          query_.get(),
+          attr.c_str(),
+          i,
+          &views[i].first,
+          &views[i].second));
+    return views;
+  }
+
+  /**
+   * Sets the query condition. Applicable only to read queries on sparse
+   * arrays; only the cells that satisfy the condition are returned.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * tiledb::QueryCondition cond(ctx);
+   * cond.init<int32_t>("a1", 5, TILEDB_GT);
+   * query.set_condition(cond);
+   * @endcode
+   *
+   * @param condition The query condition.
+   * @return Reference to this Query
+   */
+  Query& set_condition(const QueryCondition& condition) {
+    auto& ctx = ctx_.get();
+    ctx.handle_error(tiledb_query_set_condition(
+        ctx, query_.get(), condition.ptr().get()));
+    return *this;
+  }
+
   /** Returns the query status. */
   Status query_status() const {
     tiledb_query_status_t status;
@@ -365,8 +517,10 @@ class Query {
           (attr_name != TILEDB_COORDS &&
            schema_.attribute(attr_name).cell_val_num() == TILEDB_VAR_NUM);
       auto element_size = element_sizes_.find(attr_name)->second;
+      auto offset_size =
+          (var) ? offset_sizes_.find(attr_name)->second : sizeof(uint64_t);
       elements[attr_name] = (var) ? std::pair<uint64_t, uint64_t>(
-                                        size_pair.first / sizeof(uint64_t),
+                                        size_pair.first / offset_size,
                                         size_pair.second / element_size) :
                                     std::pair<uint64_t, uint64_t>(
                                         0, size_pair.second / element_size);
@@ -614,6 +768,7 @@ class Query {
     auto data_size = data_nelements * sizeof(T);
     auto offset_size = offset_nelements * sizeof(uint64_t);
     element_sizes_[attr] = sizeof(T);
+    offset_sizes_[attr] = sizeof(uint64_t);
     buff_sizes_[attr] = std::pair<uint64_t, uint64_t>(offset_size, data_size);
     ctx.handle_error(tiledb_query_set_buffer_var(
         ctx,
@@ -626,6 +781,45 @@ class Query {
     return *this;
   }
 
+  /**
+   * Sets a buffer for a variable-sized attribute with 32-bit offsets. This
+   * requires `sm.var_offsets.bitsize` to be set to `32` in the context
+   * configuration.
+   *
+   * @tparam T Attribute value type
+   * @param attr Attribute name
+   * @param offsets Offsets array pointer where a new element begins in the data
+   *        buffer.
+   * @param offsets_nelements Number of elements in offsets buffer.
+   * @param data Buffer array pointer with elements of the attribute type.
+   *        For variable sized attributes, the buffer should be flattened.
+   * @param data_nelements Number of array elements in data buffer.
+   **/
+  template <typename T>
+  Query& set_buffer(
+      const std::string& attr,
+      uint32_t* offsets,
+      uint64_t offset_nelements,
+      T* data,
+      uint64_t data_nelements) {
+    impl::type_check<T>(schema_.attribute(attr).type());
+    auto ctx = ctx_.get();
+    auto data_size = data_nelements * sizeof(T);
+    auto offset_size = offset_nelements * sizeof(uint32_t);
+    element_sizes_[attr] = sizeof(T);
+    offset_sizes_[attr] = sizeof(uint32_t);
+    buff_sizes_[attr] = std::pair<uint64_t, uint64_t>(offset_size, data_size);
+    ctx.handle_error(tiledb_query_set_buffer_var(
+        ctx,
+        query_.get(),
+        attr.c_str(),
+        (uint64_t*)offsets,
+        &(buff_sizes_[attr].first),
+        (void*)data,
+        &(buff_sizes_[attr].second)));
+    return *this;
+  }
+
   /**
    * Sets a buffer for a variable-sized attribute.
    *
@@ -654,6 +848,23 @@ class Query {
         attr, offsets.data(), offsets.size(), &data[0], data.size());
   }
 
+  /**
+   * Sets a buffer for a variable-sized attribute with 32-bit offsets. This
+   * requires `sm.var_offsets.bitsize` to be set to `32` in the context
+   * configuration.
+   *
+   * @tparam Vec buffer type. Should always be a vector of the attribute type.
+   * @param attr Attribute name
+   * @param offsets Offsets where a new element begins in the data buffer.
+   * @param data Buffer vector with elements of the attribute type.
+   **/
+  template <typename Vec>
+  Query& set_buffer(
+      const std::string& attr, std::vector<uint32_t>& offsets, Vec& data) {
+    return set_buffer(
+        attr, offsets.data(), offsets.size(), &data[0], data.size());
+  }
+
   /**
    * Sets a buffer for a variable-sized attribute.
 
@@ -721,6 +932,12 @@ class Query {
    */
   std::unordered_map<std::string, uint64_t> element_sizes_;
 
+  /**
+   * Stores the size of a single offset for the buffer set for a given
+   * var-sized attribute.
+   */
+  std::unordered_map<std::string, uint64_t> offset_sizes_;
+
   /** The TileDB context. */
   std::reference_wrapper<const Context> ctx_;
 
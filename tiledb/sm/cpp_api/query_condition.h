@@ -0,0 +1,200 @@
+/**
+ * @file   query_condition.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the C++ API for the TileDB QueryCondition object.
+ */
+
+#ifndef TILEDB_CPP_API_QUERY_CONDITION_H
+#define TILEDB_CPP_API_QUERY_CONDITION_H
+
+#include "context.h"
+#include "deleter.h"
+#include "tiledb.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace tiledb {
+
+/**
+ * Represents a condition on the attribute values of a read query. Only the
+ * cells that satisfy the condition are returned as results.
+ *
+ * **Example:**
+ *
+ * @code{.cpp}
+ * tiledb::Context ctx;
+ * // a1 >= 2 AND a1 < 6
+ * tiledb::QueryCondition low(ctx), high(ctx);
+ * low.init<int32_t>("a1", 2, TILEDB_GE);
+ * high.init<int32_t>("a1", 6, TILEDB_LT);
+ * auto cond = low.combine(high, TILEDB_AND);
+ * query.set_condition(cond);
+ * @endcode
+ */
+class QueryCondition {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Creates an empty TileDB query condition object.
+   *
+   * @param ctx TileDB context
+   */
+  explicit QueryCondition(const Context& ctx)
+      : ctx_(ctx) {
+    tiledb_query_condition_t* cond;
+    ctx.handle_error(tiledb_query_condition_alloc(ctx, &cond));
+    query_condition_ =
+        std::shared_ptr<tiledb_query_condition_t>(cond, deleter_);
+  }
+
+  /**
+   * Creates a TileDB query condition object with the input C object.
+   *
+   * @param ctx TileDB context
+   * @param cond C API query condition object
+   */
+  QueryCondition(const Context& ctx, tiledb_query_condition_t* cond)
+      : ctx_(ctx) {
+    query_condition_ =
+        std::shared_ptr<tiledb_query_condition_t>(cond, deleter_);
+  }
+
+  QueryCondition(const QueryCondition&) = default;
+  QueryCondition(QueryCondition&&) = default;
+  QueryCondition& operator=(const QueryCondition&) = default;
+  QueryCondition& operator=(QueryCondition&&) = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns a shared pointer to the C TileDB query condition object. */
+  std::shared_ptr<tiledb_query_condition_t> ptr() const {
+    return query_condition_;
+  }
+
+  /**
+   * Initializes the condition as a comparison of an attribute against a
+   * value, i.e., `attribute_name op value`.
+   *
+   * @param attribute_name The name of the (fixed-sized) attribute.
+   * @param condition_value The value to compare against.
+   * @param condition_value_size The size of `condition_value` in bytes.
+   * @param op The comparison operator.
+   * @return Reference to this QueryCondition.
+   */
+  QueryCondition& init(
+      const std::string& attribute_name,
+      const void* condition_value,
+      uint64_t condition_value_size,
+      tiledb_query_condition_op_t op) {
+    auto& ctx = ctx_.get();
+    ctx.handle_error(tiledb_query_condition_init(
+        ctx,
+        query_condition_.get(),
+        attribute_name.c_str(),
+        condition_value,
+        condition_value_size,
+        op));
+    return *this;
+  }
+
+  /**
+   * Initializes the condition as a comparison of an attribute against a
+   * value, i.e., `attribute_name op value`.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * tiledb::QueryCondition cond(ctx);
+   * cond.init<float>("a2", 1.5f, TILEDB_LE);
+   * @endcode
+   *
+   * @tparam T The attribute type.
+   * @param attribute_name The name of the (fixed-sized) attribute.
+   * @param condition_value The value to compare against.
+   * @param op The comparison operator.
+   * @return Reference to this QueryCondition.
+   */
+  template <
+      typename T,
+      typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+  QueryCondition& init(
+      const std::string& attribute_name,
+      T condition_value,
+      tiledb_query_condition_op_t op) {
+    return init(attribute_name, &condition_value, sizeof(T), op);
+  }
+
+  /**
+   * Combines this condition with the input one into a new condition. Neither
+   * of the two input conditions is modified.
+   *
+   * @param rhs The right-hand side condition.
+   * @param combination_op The logical operator (`TILEDB_AND` or `TILEDB_OR`).
+   * @return The combined condition.
+   */
+  QueryCondition combine(
+      const QueryCondition& rhs,
+      tiledb_query_condition_combination_op_t combination_op) const {
+    auto& ctx = ctx_.get();
+    tiledb_query_condition_t* combined;
+    ctx.handle_error(tiledb_query_condition_combine(
+        ctx,
+        query_condition_.get(),
+        rhs.query_condition_.get(),
+        combination_op,
+        &combined));
+    return QueryCondition(ctx, combined);
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The TileDB context. */
+  std::reference_wrapper<const Context> ctx_;
+
+  /** An auxiliary deleter. */
+  impl::Deleter deleter_;
+
+  /** The pointer to the C TileDB query condition object. */
+  std::shared_ptr<tiledb_query_condition_t> query_condition_;
+};
+
+}  // namespace tiledb
+
+#endif  // TILEDB_CPP_API_QUERY_CONDITION_H
@@ -201,6 +201,11 @@ inline bool datatype_is_integer(Datatype type) {
       type == Datatype::INT64 || type == Datatype::UINT64);
 }
 
+/** Returns true if the input datatype is a real (floating point) type. */
+inline bool datatype_is_real(Datatype type) {
+  return (type == Datatype::FLOAT32 || type == Datatype::FLOAT64);
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
@@ -44,16 +44,118 @@
 
 #include <ftw.h>
 
+#include <sys/uio.h>
+
 #include <fstream>
 #include <iostream>
 
 namespace tiledb {
 namespace sm {
 
+Posix::OpenFile::~OpenFile() {
+  if (fd_ != -1)
+    ::close(fd_);
+}
+
 bool Posix::both_slashes(char a, char b) {
   return a == '/' && b == '/';
 }
 
+Status Posix::get_open_file(
+    const std::string& path,
+    bool write,
+    std::shared_ptr<OpenFile>* file) const {
+  auto max_open_files = vfs_params_.file_params_.max_open_files_;
+  std::shared_ptr<OpenFile> cached;
+  if (max_open_files > 0) {
+    std::unique_lock<std::mutex> lck(open_files_mtx_);
+    auto it = open_files_map_.find(path);
+    if (it != open_files_map_.end() &&
+        (!write || it->second->second->writable_)) {
+      open_files_.splice(open_files_.end(), open_files_, it->second);
+      cached = it->second->second;
+    }
+  }
+
+  if (cached != nullptr) {
+    *file = cached;
+    STATS_COUNTER_ADD(vfs_posix_fd_cache_hits, 1);
+    return Status::Ok();
+  }
+  STATS_COUNTER_ADD(vfs_posix_fd_cache_misses, 1);
+
+  // Open the file outside the lock
+  int fd = write ? ::open(
+                       path.c_str(),
+                       O_RDWR | O_CREAT,
+                       vfs_params_.file_params_.creation_permission_) :
+                   ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return LOG_STATUS(Status::IOError(
+        std::string("Cannot open file '") + path + "'; " + strerror(errno)));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    return LOG_STATUS(Status::IOError(
+        "Cannot get file size of '" + path + "'; " + strerror(errno)));
+  }
+  file->reset(new OpenFile(fd, write, (uint64_t)st.st_size));
+  if (max_open_files == 0)
+    return Status::Ok();
+
+  // Cache the file, unless another thread cached a suitable one meanwhile
+  std::unique_lock<std::mutex> lck(open_files_mtx_);
+  auto it = open_files_map_.find(path);
+  if (it != open_files_map_.end()) {
+    if (!write || it->second->second->writable_) {
+      open_files_.splice(open_files_.end(), open_files_, it->second);
+      *file = it->second->second;
+      return Status::Ok();
+    }
+    open_files_.erase(it->second);
+    open_files_map_.erase(it);
+  }
+  open_files_.emplace_back(path, *file);
+  open_files_map_[path] = std::prev(open_files_.end());
+  while (open_files_.size() > max_open_files) {
+    open_files_map_.erase(open_files_.front().first);
+    open_files_.pop_front();
+  }
+
+  return Status::Ok();
+}
+
+void Posix::invalidate_open_file(
+    const std::string& path, const OpenFile* file) const {
+  std::unique_lock<std::mutex> lck(open_files_mtx_);
+  auto it = open_files_map_.find(path);
+  if (it != open_files_map_.end() &&
+      (file == nullptr || it->second->second.get() == file)) {
+    open_files_.erase(it->second);
+    open_files_map_.erase(it);
+  }
+}
+
+void Posix::invalidate_open_files(const std::string& path) const {
+  auto dir = path;
+  while (dir.size() > 1 && dir.back() == '/')
+    dir.pop_back();
+  auto prefix = dir + "/";
+
+  std::unique_lock<std::mutex> lck(open_files_mtx_);
+  for (auto it = open_files_.begin(); it != open_files_.end();) {
+    const auto& file_path = it->first;
+    if (file_path == dir ||
+        file_path.compare(0, prefix.size(), prefix) == 0) {
+      open_files_map_.erase(file_path);
+      it = open_files_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 uint64_t Posix::read_all(
     int fd, void* buffer, uint64_t nbytes, uint64_t offset) {
   auto bytes = reinterpret_cast<char*>(buffer);
@@ -137,6 +239,30 @@ std::string Posix::abs_path(const std::string& path) {
   return ret_dir;
 }
 
+Status Posix::close_file(const std::string& path) {
+  std::shared_ptr<OpenFile> file;
+  {
+    std::unique_lock<std::mutex> lck(open_files_mtx_);
+    auto it = open_files_map_.find(path);
+    if (it != open_files_map_.end()) {
+      file = it->second->second;
+      open_files_.erase(it->second);
+      open_files_map_.erase(it);
+    }
+  }
+
+  // Sync through the cached descriptor, which is closed once released
+  if (file != nullptr) {
+    if (file->writable_ && fsync(file->fd_) != 0) {
+      return LOG_STATUS(Status::IOError(
+          std::string("Cannot sync file '") + path + "'; " + strerror(errno)));
+    }
+    return Status::Ok();
+  }
+
+  return sync(path);
+}
+
 Status Posix::create_dir(const std::string& path) const {
   // If the directory does not exist, create it
   if (is_dir(path)) {
@@ -190,6 +316,7 @@ int Posix::unlink_cb(
 }
 
 Status Posix::remove_dir(const std::string& path) const {
+  invalidate_open_files(path);
   int rc = nftw(path.c_str(), unlink_cb, 64, FTW_DEPTH | FTW_PHYS);
   if (rc)
     return LOG_STATUS(Status::IOError(
@@ -199,6 +326,7 @@ Status Posix::remove_dir(const std::string& path) const {
 }
 
 Status Posix::remove_file(const std::string& path) const {
+  invalidate_open_file(path);
   if (remove(path.c_str()) != 0) {
     return LOG_STATUS(Status::IOError(
         std::string("Cannot delete file '") + path + "'; " + strerror(errno)));
@@ -304,6 +432,8 @@ Status Posix::ls(
 
 Status Posix::move_path(
     const std::string& old_path, const std::string& new_path) {
+  invalidate_open_files(old_path);
+  invalidate_open_files(new_path);
   if (rename(old_path.c_str(), new_path.c_str()) != 0) {
     return LOG_STATUS(
         Status::IOError(std::string("Cannot move path: ") + strerror(errno)));
@@ -371,18 +501,17 @@ Status Posix::read(
     void* buffer,
     uint64_t nbytes) const {
   // Checks
-  uint64_t file_size;
-  RETURN_NOT_OK(this->file_size(path, &file_size));
-  if (offset + nbytes > file_size)
-    return LOG_STATUS(
-        Status::IOError("Cannot read from file; Read exceeds file size"));
-
-  // Open file
-  int fd = open(path.c_str(), O_RDONLY);
-  if (fd == -1) {
-    return LOG_STATUS(Status::IOError(
-        std::string("Cannot read from file; ") + strerror(errno)));
+  std::shared_ptr<OpenFile> file;
+  RETURN_NOT_OK(get_open_file(path, false, &file));
+  if (offset + nbytes > file->size_) {
+    // The file may have been replaced or grown since it was cached
+    invalidate_open_file(path, file.get());
+    RETURN_NOT_OK(get_open_file(path, false, &file));
+    if (offset + nbytes > file->size_)
+      return LOG_STATUS(
+          Status::IOError("Cannot read from file; Read exceeds file size"));
   }
+
   if (offset > std::numeric_limits<off_t>::max()) {
     return LOG_STATUS(Status::IOError(
         std::string("Cannot read from file ' ") + path.c_str() +
@@ -393,17 +522,20 @@ Status Posix::read(
         std::string("Cannot read from file ' ") + path.c_str() +
         "'; nbytes > SSIZE_MAX"));
   }
-  uint64_t bytes_read = read_all(fd, buffer, nbytes, offset);
+  uint64_t bytes_read = read_all(file->fd_, buffer, nbytes, offset);
+  if (bytes_read != nbytes) {
+    // The file may have been truncated or replaced since it was cached, so
+    // the read is retried once with a freshly opened file
+    invalidate_open_file(path, file.get());
+    RETURN_NOT_OK(get_open_file(path, false, &file));
+    if (offset + nbytes <= file->size_)
+      bytes_read = read_all(file->fd_, buffer, nbytes, offset);
+  }
   if (bytes_read != nbytes) {
     return LOG_STATUS(Status::IOError(
         std::string("Cannot read from file '") + path.c_str() +
         "'; File reading error"));
   }
-  // Close file
-  if (close(fd)) {
-    return LOG_STATUS(Status::IOError(
-        std::string("Cannot read from file; ") + strerror(errno)));
-  }
   return Status::Ok();
 }
 
@@ -443,18 +575,11 @@ Status Posix::sync(const std::string& path) {
 
 Status Posix::write(
     const std::string& path, const void* buffer, uint64_t buffer_size) {
-  uint64_t file_offset = 0;
-  if (is_file(path) && !file_size(path, &file_offset).ok()) {
-    return LOG_STATUS(
-        Status::IOError(std::string("Cannot write to file '") + path));
-  }
-
-  // Open or create file.
-  int fd = open(path.c_str(), O_WRONLY | O_CREAT, vfs_params_.file_params_.creation_permission_);
-  if (fd == -1) {
-    return LOG_STATUS(Status::IOError(
-        std::string("Cannot open file '") + path + "'; " + strerror(errno)));
-  }
+  // Open or create file, reserving the range to append to
+  std::shared_ptr<OpenFile> file;
+  RETURN_NOT_OK(get_open_file(path, true, &file));
+  uint64_t file_offset = file->size_.fetch_add(buffer_size);
+  int fd = file->fd_;
 
   // Ensure that each thread is responsible for at least min_parallel_size
   // bytes, and cap the number of parallel operations at the thread pool size.
@@ -462,12 +587,9 @@ Status Posix::write(
       std::max(buffer_size / vfs_params_.min_parallel_size_, uint64_t(1)),
       vfs_params_.file_params_.max_parallel_ops_);
 
+  bool all_ok = true;
   if (num_ops == 1) {
-    if (!write_at(fd, file_offset, buffer, buffer_size).ok()) {
-      close(fd);
-      return LOG_STATUS(
-          Status::IOError(std::string("Cannot write to file '") + path));
-    }
+    all_ok = write_at(fd, file_offset, buffer, buffer_size).ok();
   } else {
     STATS_COUNTER_ADD(vfs_posix_write_num_parallelized, 1);
     std::vector<std::future<Status>> results;
@@ -487,17 +609,81 @@ Status Posix::write(
           }));
     }
 
-    bool all_ok = vfs_thread_pool_->wait_all(results);
-    if (!all_ok) {
-      close(fd);
-      return LOG_STATUS(
-          Status::IOError(std::string("Cannot write to file '") + path));
+    all_ok = vfs_thread_pool_->wait_all(results);
+  }
+
+  // The reserved range is unreliable after an error, so the file is reopened
+  // upon the next access
+  if (!all_ok) {
+    invalidate_open_file(path);
+    return LOG_STATUS(
+        Status::IOError(std::string("Cannot write to file '") + path));
+  }
+
+  return Status::Ok();
+}
+
+Status Posix::write(
+    const std::string& path, const std::vector<ConstBuffer>& buffers) {
+  if (buffers.size() == 1)
+    return write(path, buffers[0].data(), buffers[0].size());
+
+  uint64_t buffers_size = 0;
+  for (const auto& buff : buffers)
+    buffers_size += buff.size();
+
+  // Open or create file, reserving the range to append to
+  std::shared_ptr<OpenFile> file;
+  RETURN_NOT_OK(get_open_file(path, true, &file));
+  uint64_t file_offset = file->size_.fetch_add(buffers_size);
+  int fd = file->fd_;
+
+  // Split the buffers into contiguous groups of at least min_parallel_size
+  // bytes each, capping the number of groups at the thread pool size.
+  uint64_t num_ops = std::min(
+      std::max(buffers_size / vfs_params_.min_parallel_size_, uint64_t(1)),
+      vfs_params_.file_params_.max_parallel_ops_);
+  uint64_t op_nbytes = utils::math::ceil(buffers_size, num_ops);
+  std::vector<std::pair<uint64_t, uint64_t>> groups;
+  std::vector<uint64_t> group_offsets;
+  uint64_t group_begin = 0, group_nbytes = 0, group_offset = file_offset;
+  for (uint64_t i = 0; i < buffers.size(); ++i) {
+    group_nbytes += buffers[i].size();
+    if (group_nbytes >= op_nbytes || i == buffers.size() - 1) {
+      groups.emplace_back(group_begin, i + 1);
+      group_offsets.push_back(group_offset);
+      group_begin = i + 1;
+      group_offset += group_nbytes;
+      group_nbytes = 0;
     }
   }
 
-  if (close(fd) != 0) {
-    return LOG_STATUS(Status::IOError(
-        std::string("Cannot close file '") + path + "'; " + strerror(errno)));
+  bool all_ok = true;
+  if (groups.size() <= 1) {
+    all_ok = writev_at(fd, file_offset, buffers.data(), buffers.size()).ok();
+  } else {
+    STATS_COUNTER_ADD(vfs_posix_write_num_parallelized, 1);
+    std::vector<std::future<Status>> results;
+    for (uint64_t i = 0; i < groups.size(); ++i) {
+      auto thread_buffers = buffers.data() + groups[i].first;
+      uint64_t thread_num = groups[i].second - groups[i].first;
+      uint64_t thread_file_offset = group_offsets[i];
+      results.push_back(vfs_thread_pool_->enqueue(
+          [fd, thread_file_offset, thread_buffers, thread_num]() {
+            return writev_at(
+                fd, thread_file_offset, thread_buffers, thread_num);
+          }));
+    }
+
+    all_ok = vfs_thread_pool_->wait_all(results);
+  }
+
+  // The reserved range is unreliable after an error, so the file is reopened
+  // upon the next access
+  if (!all_ok) {
+    invalidate_open_file(path);
+    return LOG_STATUS(
+        Status::IOError(std::string("Cannot write to file '") + path));
   }
 
   return Status::Ok();
@@ -536,6 +722,65 @@ Status Posix::write_at(
   return Status::Ok();
 }
 
+Status Posix::writev_at(
+    int fd, uint64_t file_offset, const ConstBuffer* buffers, uint64_t num) {
+#ifdef IOV_MAX
+  const uint64_t max_iov = IOV_MAX;
+#else
+  const uint64_t max_iov = 1024;
+#endif
+
+  // Position of the next byte to write, as a buffer index and an offset
+  // within that buffer
+  uint64_t buff_idx = 0, buff_offset = 0;
+  std::vector<struct iovec> iov;
+  while (buff_idx < num) {
+    // Gather the next batch of buffers
+    iov.clear();
+    uint64_t batch_nbytes = 0;
+    for (uint64_t i = buff_idx, skip = buff_offset;
+         i < num && iov.size() < max_iov &&
+         batch_nbytes < constants::max_write_bytes;
+         ++i, skip = 0) {
+      uint64_t nbytes = std::min(
+          buffers[i].size() - skip, constants::max_write_bytes - batch_nbytes);
+      if (nbytes == 0)
+        continue;
+      struct iovec v;
+      v.iov_base = const_cast<char*>(
+          static_cast<const char*>(buffers[i].data()) + skip);
+      v.iov_len = nbytes;
+      iov.push_back(v);
+      batch_nbytes += nbytes;
+    }
+    if (batch_nbytes == 0)
+      break;
+
+    ssize_t written =
+        ::pwritev(fd, iov.data(), (int)iov.size(), (off_t)file_offset);
+    if (written == -1 && errno == EINTR)
+      continue;
+    if (written <= 0) {
+      return LOG_STATUS(Status::IOError(
+          std::string("Cannot write to file; ") + strerror(errno)));
+    }
+    STATS_COUNTER_ADD(vfs_posix_write_num_vectored, 1);
+
+    // Advance past the written bytes, which may end mid-buffer
+    file_offset += written;
+    uint64_t left = written;
+    while (buff_idx < num && left >= buffers[buff_idx].size() - buff_offset) {
+      left -= buffers[buff_idx].size() - buff_offset;
+      ++buff_idx;
+      buff_offset = 0;
+    }
+    buff_offset += left;
+  }
+
+  // Success
+  return Status::Ok();
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
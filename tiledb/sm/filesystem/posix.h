@@ -38,10 +38,16 @@
 #include <ftw.h>
 #include <sys/types.h>
 
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/buffer/const_buffer.h"
 #include "tiledb/sm/filesystem/filelock.h"
 #include "tiledb/sm/misc/status.h"
 #include "tiledb/sm/misc/thread_pool.h"
@@ -62,6 +68,15 @@ class Posix {
    */
   static std::string abs_path(const std::string& path);
 
+  /**
+   * Syncs a file or directory, and closes the file descriptor cached for
+   * it (if any).
+   *
+   * @param path The name of the file or directory.
+   * @return Status
+   */
+  Status close_file(const std::string& path);
+
   /**
    * Creates a new directory.
    *
@@ -215,6 +230,18 @@ class Posix {
   Status write(
       const std::string& path, const void* buffer, uint64_t buffer_size);
 
+  /**
+   * Appends the input buffers to a file, in the given order, with as few
+   * vectored writes (`pwritev`) as possible. The file is created if it
+   * does not exist.
+   *
+   * @param path The name of the file.
+   * @param buffers The input buffers.
+   * @return Status
+   */
+  Status write(
+      const std::string& path, const std::vector<ConstBuffer>& buffers);
+
  private:
   /** Config parameters from parent VFS instance. */
   Config::VFSParams vfs_params_;
@@ -222,10 +249,86 @@ class Posix {
   /** Thread pool from parent VFS instance. */
   ThreadPool* vfs_thread_pool_;
 
+  /** A file descriptor kept open by the file descriptor cache. */
+  struct OpenFile {
+    /** Constructor. */
+    OpenFile(int fd, bool writable, uint64_t size)
+        : fd_(fd)
+        , writable_(writable)
+        , size_(size) {
+    }
+
+    /** Destructor. Closes the file descriptor. */
+    ~OpenFile();
+
+    /** The file descriptor. */
+    int fd_;
+
+    /** `true` if the file was opened for writing as well as reading. */
+    bool writable_;
+
+    /**
+     * The size of the file, which is also the offset where the next write
+     * appends. Writes reserve their range by incrementing it.
+     */
+    std::atomic<uint64_t> size_;
+  };
+
+  /**
+   * The cached open files, most recently used last. A file is closed once
+   * evicted and no longer in use by an ongoing operation. The cache is per
+   * instance, bounded by `vfs.file.max_open_files` (256 by default).
+   */
+  mutable std::list<std::pair<std::string, std::shared_ptr<OpenFile>>>
+      open_files_;
+
+  /** Maps a path to its node in `open_files_`. */
+  mutable std::unordered_map<
+      std::string,
+      std::list<std::pair<std::string, std::shared_ptr<OpenFile>>>::iterator>
+      open_files_map_;
+
+  /** Protects `open_files_` and `open_files_map_`. */
+  mutable std::mutex open_files_mtx_;
+
   static void adjacent_slashes_dedup(std::string* path);
 
   static bool both_slashes(char a, char b);
 
+  /**
+   * Retrieves the cached open file for the input path, opening the file
+   * and caching it if needed. Files opened for writing are created if
+   * they do not exist. Upon inserting a file, the least recently used
+   * files are evicted so that at most `vfs.file.max_open_files` remain.
+   *
+   * Cache hits do not check the file on disk. Removing, moving or writing
+   * a file through this instance updates or evicts its cached descriptor,
+   * while a file replaced or truncated outside this instance is reopened
+   * once a read exceeds its cached size or fails (see `read`).
+   *
+   * @param path The name of the file.
+   * @param write `true` if the file will be written to.
+   * @param file Set to the open file.
+   * @return Status
+   */
+  Status get_open_file(
+      const std::string& path,
+      bool write,
+      std::shared_ptr<OpenFile>* file) const;
+
+  /**
+   * Evicts the cached open file for the input path (if any).
+   *
+   * @param path The name of the file.
+   * @param file If not `nullptr`, the file is evicted only if it is still
+   *     the one cached for the path.
+   */
+  void invalidate_open_file(
+      const std::string& path, const OpenFile* file = nullptr) const;
+
+  /** Evicts the cached open files of the input path and anything in it. */
+  void invalidate_open_files(const std::string& path) const;
+
   /**
    * It takes as input an **absolute** path, and returns it in its canonicalized
    * form, after appropriately replacing "./" and "../" in the path.
@@ -282,6 +385,21 @@ class Posix {
    */
   static Status write_at(
       int fd, uint64_t file_offset, const void* buffer, uint64_t buffer_size);
+
+  /**
+   * Writes the given buffers contiguously to the file descriptor, beginning
+   * at the given offset. The buffers are gathered into as few `pwritev`
+   * calls as the system limits on the number of vectors and
+   * `constants::max_write_bytes` allow.
+   *
+   * @param fd Open file descriptor to write to
+   * @param file_offset Offset in the file at which to start writing
+   * @param buffers The buffers to write
+   * @param num Number of buffers to write
+   * @return Status
+   */
+  static Status writev_at(
+      int fd, uint64_t file_offset, const ConstBuffer* buffers, uint64_t num);
 };
 
 }  // namespace sm
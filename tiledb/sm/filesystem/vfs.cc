@@ -893,7 +893,7 @@ Status VFS::close_file(const URI& uri) {
 #ifdef _WIN32
     return win_.sync(uri.to_path());
 #else
-    return posix_.sync(uri.to_path());
+    return posix_.close_file(uri.to_path());
 #endif
   }
   if (uri.is_hdfs()) {
@@ -949,5 +949,32 @@ Status VFS::write(const URI& uri, const void* buffer, uint64_t buffer_size) {
   STATS_FUNC_OUT(vfs_write);
 }
 
+Status VFS::write(const URI& uri, const std::vector<ConstBuffer>& buffers) {
+  // The other backends already coalesce small writes into their own file
+  // buffers, so the buffers are written in turn
+  if (!uri.is_file()) {
+    for (const auto& buff : buffers)
+      RETURN_NOT_OK(write(uri, buff.data(), buff.size()));
+    return Status::Ok();
+  }
+
+  STATS_FUNC_IN(vfs_write);
+
+  uint64_t buffers_size = 0;
+  for (const auto& buff : buffers)
+    buffers_size += buff.size();
+  STATS_COUNTER_ADD(vfs_write_total_bytes, buffers_size);
+
+#ifdef _WIN32
+  for (const auto& buff : buffers)
+    RETURN_NOT_OK(win_.write(uri.to_path(), buff.data(), buff.size()));
+  return Status::Ok();
+#else
+  return posix_.write(uri.to_path(), buffers);
+#endif
+
+  STATS_FUNC_OUT(vfs_write);
+}
+
 }  // namespace sm
 }  // namespace tiledb
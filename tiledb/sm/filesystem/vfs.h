@@ -34,6 +34,7 @@
 #define TILEDB_VFS_H
 
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/buffer/const_buffer.h"
 #include "tiledb/sm/enums/filesystem.h"
 #include "tiledb/sm/enums/vfs_mode.h"
 #include "tiledb/sm/filesystem/filelock.h"
@@ -328,6 +329,17 @@ class VFS {
    */
   Status write(const URI& uri, const void* buffer, uint64_t buffer_size);
 
+  /**
+   * Writes the contents of a batch of buffers into a file, one after the
+   * other. This is equivalent to writing each buffer in turn, but lets the
+   * backend issue fewer and larger I/O operations.
+   *
+   * @param uri The URI of the file.
+   * @param buffers The buffers to write from.
+   * @return Status
+   */
+  Status write(const URI& uri, const std::vector<ConstBuffer>& buffers);
+
  private:
 /* ********************************* */
 /*         PRIVATE ATTRIBUTES        */
@@ -33,10 +33,12 @@
 
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/buffer/const_buffer.h"
+#include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/logger.h"
 #include "tiledb/sm/misc/utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 
@@ -65,7 +67,7 @@ FragmentMetadata::FragmentMetadata(
     , timestamp_(timestamp) {
   domain_ = nullptr;
   non_empty_domain_ = nullptr;
-  version_ = constants::format_version;
+  version_ = constants::fragment_metadata_version;
   tile_index_base_ = 0;
 
   auto attributes = array_schema_->attributes();
@@ -161,6 +163,26 @@ Status FragmentMetadata::set_mbr(uint64_t tile, const void* mbr) {
   return expand_non_empty_domain(static_cast<const T*>(mbr));
 }
 
+void FragmentMetadata::set_tile_stats(
+    const std::string& attribute,
+    uint64_t tile,
+    const void* min,
+    const void* max,
+    const void* sum,
+    uint64_t nan_num) {
+  auto attribute_id = attribute_idx_map_[attribute];
+  auto cell_size = array_schema_->cell_size(attribute);
+  tile += tile_index_base_;
+  assert((tile + 1) * cell_size <= tile_min_[attribute_id].size());
+  std::memcpy(&tile_min_[attribute_id][tile * cell_size], min, cell_size);
+  std::memcpy(&tile_max_[attribute_id][tile * cell_size], max, cell_size);
+  std::memcpy(
+      &tile_sum_[attribute_id][tile * constants::tile_sum_size],
+      sum,
+      constants::tile_sum_size);
+  tile_nan_num_[attribute_id][tile] = nan_num;
+}
+
 void FragmentMetadata::set_tile_index_base(uint64_t tile_base) {
   tile_index_base_ = tile_base;
 }
@@ -241,89 +263,27 @@ Status FragmentMetadata::add_max_buffer_sizes_sparse(
     const T* subarray,
     std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>*
         buffer_sizes) const {
-  unsigned tid = 0;
-  auto dim_num = array_schema_->dim_num();
-  for (auto& mbr : mbrs_) {
-    if (utils::geometry::overlap(static_cast<T*>(mbr), subarray, dim_num)) {
-      for (auto& it : *buffer_sizes) {
-        if (array_schema_->var_size(it.first)) {
-          auto cell_num = this->cell_num(tid);
-          it.second.first += cell_num * constants::cell_var_offset_size;
-          it.second.second += tile_var_size(it.first, tid);
-        } else {
-          it.second.first += cell_num(tid) * array_schema_->cell_size(it.first);
-        }
-      }
-    }
-    tid++;
-  }
-
-  return Status::Ok();
-}
-
-template <class T>
-Status FragmentMetadata::add_est_read_buffer_sizes(
-    const T* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const {
-  if (dense_)
-    return add_est_read_buffer_sizes_dense(subarray, buffer_sizes);
-  return add_est_read_buffer_sizes_sparse(subarray, buffer_sizes);
-}
-
-template <class T>
-Status FragmentMetadata::add_est_read_buffer_sizes_dense(
-    const T* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const {
-  // Calculate the ids and coverage of all tiles overlapping with subarray
-  auto tids_cov = compute_overlapping_tile_ids_cov(subarray);
-
-  // Compute buffer sizes
-  for (auto& tid_cov : tids_cov) {
-    auto tid = tid_cov.first;
-    auto cov = tid_cov.second;
+  // Get the tiles overlapping with the subarray from the R-tree
+  auto overlap = rtree_.get_tile_overlap(subarray);
+  auto add_tile = [&](uint64_t tid) {
     for (auto& it : *buffer_sizes) {
       if (array_schema_->var_size(it.first)) {
-        it.second.first += cov * tile_size(it.first, tid);
-        it.second.second += cov * tile_var_size(it.first, tid);
+        auto cell_num = this->cell_num(tid);
+        it.second.first += cell_num * constants::cell_var_offset_size;
+        it.second.second += tile_var_size(it.first, tid);
       } else {
-        it.second.first += cov * tile_size(it.first, tid);
+        it.second.first += cell_num(tid) * array_schema_->cell_size(it.first);
       }
     }
-  }
+  };
 
-  return Status::Ok();
-}
-
-template <class T>
-Status FragmentMetadata::add_est_read_buffer_sizes_sparse(
-    const T* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const {
-  bool overlap;
-  auto dim_num = array_schema_->dim_num();
-  auto subarray_overlap = new T[2 * dim_num];
-  unsigned tid = 0;
-  for (auto& mbr : mbrs_) {
-    utils::geometry::overlap(
-        (T*)mbr, subarray, dim_num, subarray_overlap, &overlap);
-    if (overlap) {
-      double cov =
-          utils::geometry::coverage(subarray_overlap, (T*)mbr, dim_num);
-      for (auto& it : *buffer_sizes) {
-        if (array_schema_->var_size(it.first)) {
-          it.second.first += cov * tile_size(it.first, tid);
-          it.second.second += cov * tile_var_size(it.first, tid);
-        } else {
-          it.second.first += cov * tile_size(it.first, tid);
-        }
-      }
-    }
-    tid++;
+  for (const auto& tr : overlap.tile_ranges_) {
+    for (uint64_t tid = tr.first; tid <= tr.second; ++tid)
+      add_tile(tid);
   }
+  for (const auto& t : overlap.tiles_)
+    add_tile(t.first);
 
-  delete[] subarray_overlap;
   return Status::Ok();
 }
 
@@ -342,6 +302,15 @@ Status FragmentMetadata::deserialize(ConstBuffer* buf) {
   RETURN_NOT_OK(load_last_tile_cell_num(buf));
   RETURN_NOT_OK(load_file_sizes(buf));
   RETURN_NOT_OK(load_file_var_sizes(buf));
+  if (version_ >= 3)
+    RETURN_NOT_OK(load_tile_stats(buf));
+
+  if (!dense_)
+    rtree_ = RTree(
+        array_schema_->coords_type(),
+        array_schema_->dim_num(),
+        constants::rtree_fanout,
+        mbrs_);
 
   return Status::Ok();
 }
@@ -363,13 +332,70 @@ uint64_t FragmentMetadata::file_var_sizes(const std::string& attribute) const {
 }
 
 uint32_t FragmentMetadata::format_version() const {
-  return version_;
+  return std::min(version_, constants::format_version);
 }
 
 const URI& FragmentMetadata::fragment_uri() const {
   return fragment_uri_;
 }
 
+bool FragmentMetadata::has_tile_stats(const std::string& attribute) const {
+  auto it = attribute_idx_map_.find(attribute);
+  if (it == attribute_idx_map_.end() || it->second >= tile_min_.size())
+    return false;
+  return !tile_min_[it->second].empty();
+}
+
+template <class T>
+void FragmentMetadata::get_overlapping_tiles(
+    const T* subarray,
+    std::vector<uint64_t>* tile_ids,
+    std::vector<T>* tile_rects) const {
+  auto dim_num = array_schema_->dim_num();
+
+  // Sparse fragment - get the tiles from the R-tree
+  if (!dense_) {
+    auto overlap = rtree_.get_tile_overlap(subarray);
+    auto add_tile = [&](uint64_t tid) {
+      auto mbr = static_cast<const T*>(mbrs_[tid]);
+      tile_ids->push_back(tid);
+      tile_rects->insert(tile_rects->end(), mbr, mbr + 2 * dim_num);
+    };
+    for (const auto& tr : overlap.tile_ranges_) {
+      for (uint64_t tid = tr.first; tid <= tr.second; ++tid)
+        add_tile(tid);
+    }
+    for (const auto& t : overlap.tiles_)
+      add_tile(t.first);
+    return;
+  }
+
+  // Dense fragment - check if there is any overlap
+  auto metadata_domain = static_cast<const T*>(domain_);
+  if (!utils::geometry::overlap(subarray, metadata_domain, dim_num))
+    return;
+
+  // Initialize subarray tile domain and tile coordinates
+  std::vector<T> subarray_tile_domain(2 * dim_num);
+  get_subarray_tile_domain(subarray, &subarray_tile_domain[0]);
+  std::vector<T> tile_coords(dim_num);
+  for (unsigned int i = 0; i < dim_num; ++i)
+    tile_coords[i] = subarray_tile_domain[2 * i];
+
+  // Walk through all tiles in subarray tile domain
+  auto domain = array_schema_->domain();
+  std::vector<T> tile_subarray(2 * dim_num);
+  do {
+    domain->get_tile_subarray(
+        metadata_domain, &tile_coords[0], &tile_subarray[0]);
+    tile_ids->push_back(domain->get_tile_pos(metadata_domain, &tile_coords[0]));
+    tile_rects->insert(
+        tile_rects->end(), tile_subarray.begin(), tile_subarray.end());
+    domain->get_next_tile_coords(&subarray_tile_domain[0], &tile_coords[0]);
+  } while (utils::geometry::coords_in_rect(
+      &tile_coords[0], &subarray_tile_domain[0], dim_num));
+}
+
 template <class T>
 uint64_t FragmentMetadata::get_tile_pos(const T* tile_coords) const {
   // For easy reference
@@ -433,6 +459,12 @@ Status FragmentMetadata::init(const void* non_empty_domain) {
   // Initialize variable tile sizes
   tile_var_sizes_.resize(attribute_num);
 
+  // Initialize tile statistics
+  tile_min_.resize(attribute_num);
+  tile_max_.resize(attribute_num);
+  tile_sum_.resize(attribute_num);
+  tile_nan_num_.resize(attribute_num);
+
   return Status::Ok();
 }
 
@@ -448,6 +480,10 @@ const void* FragmentMetadata::non_empty_domain() const {
   return non_empty_domain_;
 }
 
+const RTree& FragmentMetadata::rtree() const {
+  return rtree_;
+}
+
 Status FragmentMetadata::serialize(Buffer* buf) {
   RETURN_NOT_OK(write_version(buf));
   RETURN_NOT_OK(write_non_empty_domain(buf));
@@ -459,6 +495,7 @@ Status FragmentMetadata::serialize(Buffer* buf) {
   RETURN_NOT_OK(write_last_tile_cell_num(buf));
   RETURN_NOT_OK(write_file_sizes(buf));
   RETURN_NOT_OK(write_file_var_sizes(buf));
+  RETURN_NOT_OK(write_tile_stats(buf));
 
   return Status::Ok();
 }
@@ -478,6 +515,17 @@ Status FragmentMetadata::set_num_tiles(uint64_t num_tiles) {
   if (!dense_) {
     mbrs_.resize(num_tiles, nullptr);
     bounding_coords_.resize(num_tiles, nullptr);
+
+    auto attributes = array_schema_->attributes();
+    for (unsigned i = 0; i < num_attributes; i++) {
+      if (!tile_stats_supported(i))
+        continue;
+      auto cell_size = attributes[i]->cell_size();
+      tile_min_[i].resize(num_tiles * cell_size, 0);
+      tile_max_[i].resize(num_tiles * cell_size, 0);
+      tile_sum_[i].resize(num_tiles * constants::tile_sum_size, 0);
+      tile_nan_num_[i].resize(num_tiles, 0);
+    }
   }
 
   return Status::Ok();
@@ -560,6 +608,40 @@ uint64_t FragmentMetadata::tile_var_size(
   return tile_var_sizes_[attribute_id][tile_idx];
 }
 
+const void* FragmentMetadata::tile_max(
+    const std::string& attribute, uint64_t tile_idx) const {
+  if (!has_tile_stats(attribute))
+    return nullptr;
+  auto attribute_id = attribute_idx_map_.find(attribute)->second;
+  auto cell_size = array_schema_->cell_size(attribute);
+  return &tile_max_[attribute_id][tile_idx * cell_size];
+}
+
+const void* FragmentMetadata::tile_min(
+    const std::string& attribute, uint64_t tile_idx) const {
+  if (!has_tile_stats(attribute))
+    return nullptr;
+  auto attribute_id = attribute_idx_map_.find(attribute)->second;
+  auto cell_size = array_schema_->cell_size(attribute);
+  return &tile_min_[attribute_id][tile_idx * cell_size];
+}
+
+uint64_t FragmentMetadata::tile_nan_num(
+    const std::string& attribute, uint64_t tile_idx) const {
+  if (!has_tile_stats(attribute))
+    return 0;
+  auto attribute_id = attribute_idx_map_.find(attribute)->second;
+  return tile_nan_num_[attribute_id][tile_idx];
+}
+
+const void* FragmentMetadata::tile_sum(
+    const std::string& attribute, uint64_t tile_idx) const {
+  if (!has_tile_stats(attribute))
+    return nullptr;
+  auto attribute_id = attribute_idx_map_.find(attribute)->second;
+  return &tile_sum_[attribute_id][tile_idx * constants::tile_sum_size];
+}
+
 uint64_t FragmentMetadata::timestamp() const {
   return timestamp_;
 }
@@ -612,56 +694,6 @@ std::vector<uint64_t> FragmentMetadata::compute_overlapping_tile_ids(
   return tids;
 }
 
-template <class T>
-std::vector<std::pair<uint64_t, double>>
-FragmentMetadata::compute_overlapping_tile_ids_cov(const T* subarray) const {
-  assert(dense_);
-  std::vector<std::pair<uint64_t, double>> tids;
-  auto dim_num = array_schema_->dim_num();
-  auto metadata_domain = static_cast<const T*>(domain_);
-
-  // Check if there is any overlap
-  if (!utils::geometry::overlap(subarray, metadata_domain, dim_num))
-    return tids;
-
-  // Initialize subarray tile domain
-  auto subarray_tile_domain = new T[2 * dim_num];
-  get_subarray_tile_domain(subarray, subarray_tile_domain);
-
-  auto tile_subarray = new T[2 * dim_num];
-  auto tile_overlap = new T[2 * dim_num];
-  bool overlap;
-  double cov;
-
-  // Initialize tile coordinates
-  auto tile_coords = new T[dim_num];
-  for (unsigned int i = 0; i < dim_num; ++i)
-    tile_coords[i] = subarray_tile_domain[2 * i];
-
-  // Walk through all tiles in subarray tile domain
-  auto domain = array_schema_->domain();
-  uint64_t tile_pos;
-  do {
-    domain->get_tile_subarray(metadata_domain, tile_coords, tile_subarray);
-    utils::geometry::overlap(
-        subarray, tile_subarray, dim_num, tile_overlap, &overlap);
-    assert(overlap);
-    cov = utils::geometry::coverage(tile_overlap, tile_subarray, dim_num);
-    tile_pos = domain->get_tile_pos(metadata_domain, tile_coords);
-    tids.emplace_back(tile_pos, cov);
-    domain->get_next_tile_coords(subarray_tile_domain, tile_coords);
-  } while (utils::geometry::coords_in_rect(
-      tile_coords, subarray_tile_domain, dim_num));
-
-  // Clean up
-  delete[] subarray_tile_domain;
-  delete[] tile_coords;
-  delete[] tile_subarray;
-  delete[] tile_overlap;
-
-  return tids;
-}
-
 template <class T>
 void FragmentMetadata::get_subarray_tile_domain(
     const T* subarray, T* subarray_tile_domain) const {
@@ -976,6 +1008,63 @@ Status FragmentMetadata::load_tile_var_sizes(ConstBuffer* buff) {
   return Status::Ok();
 }
 
+// ===== FORMAT =====
+// tile_stats_attr#0_num (uint64_t)
+// tile_min_attr#0_#1 tile_min_attr#0_#2 ... (attribute type)
+// tile_max_attr#0_#1 tile_max_attr#0_#2 ... (attribute type)
+// tile_sum_attr#0_#1 tile_sum_attr#0_#2 ... (int64_t, uint64_t or double)
+// tile_nan_num_attr#0_#1 tile_nan_num_attr#0_#2 ... (uint64_t)
+// ...
+// tile_stats_attr#<attribute_num-1>_num (uint64_t)
+// ...
+Status FragmentMetadata::load_tile_stats(ConstBuffer* buff) {
+  Status st;
+  auto attributes = array_schema_->attributes();
+  auto attribute_num = array_schema_->attribute_num();
+  uint64_t tile_stats_num = 0;
+
+  // Allocate tile statistics
+  tile_min_.resize(attribute_num);
+  tile_max_.resize(attribute_num);
+  tile_sum_.resize(attribute_num);
+  tile_nan_num_.resize(attribute_num);
+
+  // For all attributes, get the tile statistics
+  for (unsigned int i = 0; i < attribute_num; ++i) {
+    // Get number of tile statistics
+    st = buff->read(&tile_stats_num, sizeof(uint64_t));
+    if (!st.ok()) {
+      return LOG_STATUS(Status::FragmentMetadataError(
+          "Cannot load fragment metadata; Reading number of tile statistics "
+          "failed"));
+    }
+
+    if (tile_stats_num == 0)
+      continue;
+
+    // Get tile statistics
+    auto cell_size = attributes[i]->cell_size();
+    tile_min_[i].resize(tile_stats_num * cell_size);
+    tile_max_[i].resize(tile_stats_num * cell_size);
+    tile_sum_[i].resize(tile_stats_num * constants::tile_sum_size);
+    for (auto v : {&tile_min_[i], &tile_max_[i], &tile_sum_[i]}) {
+      st = buff->read(&(*v)[0], v->size());
+      if (!st.ok()) {
+        return LOG_STATUS(Status::FragmentMetadataError(
+            "Cannot load fragment metadata; Reading tile statistics failed"));
+      }
+    }
+    tile_nan_num_[i].resize(tile_stats_num);
+    st = buff->read(&tile_nan_num_[i][0], tile_stats_num * sizeof(uint64_t));
+    if (!st.ok()) {
+      return LOG_STATUS(Status::FragmentMetadataError(
+          "Cannot load fragment metadata; Reading tile statistics failed"));
+    }
+  }
+
+  return Status::Ok();
+}
+
 // ===== FORMAT =====
 // version (uint32_t)
 Status FragmentMetadata::load_version(ConstBuffer* buff) {
@@ -1226,6 +1315,63 @@ Status FragmentMetadata::write_tile_var_sizes(Buffer* buff) {
   return Status::Ok();
 }
 
+bool FragmentMetadata::tile_stats_supported(unsigned attribute_id) const {
+  auto attr = array_schema_->attributes()[attribute_id];
+  auto type = attr->type();
+  return (datatype_is_integer(type) || datatype_is_real(type)) &&
+         !attr->var_size() && attr->cell_val_num() == 1;
+}
+
+// ===== FORMAT =====
+// tile_stats_attr#0_num (uint64_t)
+// tile_min_attr#0_#1 tile_min_attr#0_#2 ... (attribute type)
+// tile_max_attr#0_#1 tile_max_attr#0_#2 ... (attribute type)
+// tile_sum_attr#0_#1 tile_sum_attr#0_#2 ... (int64_t, uint64_t or double)
+// tile_nan_num_attr#0_#1 tile_nan_num_attr#0_#2 ... (uint64_t)
+// ...
+// tile_stats_attr#<attribute_num-1>_num (uint64_t)
+// ...
+Status FragmentMetadata::write_tile_stats(Buffer* buff) {
+  Status st;
+  auto attributes = array_schema_->attributes();
+  auto attribute_num = array_schema_->attribute_num();
+
+  // Write tile statistics for each attribute
+  for (unsigned int i = 0; i < attribute_num; ++i) {
+    // Write number of tile statistics
+    uint64_t tile_stats_num = 0;
+    if (i < tile_min_.size())
+      tile_stats_num = tile_min_[i].size() / attributes[i]->cell_size();
+    st = buff->write(&tile_stats_num, sizeof(uint64_t));
+    if (!st.ok()) {
+      return LOG_STATUS(Status::FragmentMetadataError(
+          "Cannot serialize fragment metadata; Writing number of tile "
+          "statistics failed"));
+    }
+
+    if (tile_stats_num == 0)
+      continue;
+
+    // Write tile statistics
+    for (auto v : {&tile_min_[i], &tile_max_[i], &tile_sum_[i]}) {
+      st = buff->write(&(*v)[0], v->size());
+      if (!st.ok()) {
+        return LOG_STATUS(Status::FragmentMetadataError(
+            "Cannot serialize fragment metadata; Writing tile statistics "
+            "failed"));
+      }
+    }
+    st = buff->write(&tile_nan_num_[i][0], tile_stats_num * sizeof(uint64_t));
+    if (!st.ok()) {
+      return LOG_STATUS(Status::FragmentMetadataError(
+          "Cannot serialize fragment metadata; Writing tile statistics "
+          "failed"));
+    }
+  }
+
+  return Status::Ok();
+}
+
 // ===== FORMAT =====
 // version (uint32_t)
 Status FragmentMetadata::write_version(Buffer* buff) {
@@ -1296,46 +1442,46 @@ template Status FragmentMetadata::add_max_buffer_sizes<double>(
     std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>*
         buffer_sizes) const;
 
-template Status FragmentMetadata::add_est_read_buffer_sizes<int8_t>(
+template void FragmentMetadata::get_overlapping_tiles<int8_t>(
     const int8_t* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<uint8_t>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<int8_t>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<uint8_t>(
     const uint8_t* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<int16_t>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<uint8_t>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<int16_t>(
     const int16_t* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<uint16_t>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<int16_t>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<uint16_t>(
     const uint16_t* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<int>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<uint16_t>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<int>(
     const int* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<unsigned>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<int>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<unsigned>(
     const unsigned* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<int64_t>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<unsigned>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<int64_t>(
     const int64_t* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<uint64_t>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<int64_t>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<uint64_t>(
     const uint64_t* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<float>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<uint64_t>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<float>(
     const float* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
-template Status FragmentMetadata::add_est_read_buffer_sizes<double>(
+    std::vector<uint64_t>* tile_ids,
+    std::vector<float>* tile_rects) const;
+template void FragmentMetadata::get_overlapping_tiles<double>(
     const double* subarray,
-    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-    const;
+    std::vector<uint64_t>* tile_ids,
+    std::vector<double>* tile_rects) const;
 
 template uint64_t FragmentMetadata::get_tile_pos<int8_t>(
     const int8_t* tile_coords) const;
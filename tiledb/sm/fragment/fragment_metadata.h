@@ -38,6 +38,7 @@
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/misc/status.h"
+#include "tiledb/sm/rtree/rtree.h"
 
 #include <vector>
 
@@ -138,65 +139,6 @@ class FragmentMetadata {
       std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>*
           buffer_sizes) const;
 
-  /**
-   * Computes an estimate on the buffer sizes needed when reading a subarray
-   * from the fragment, for a given set of attributes. Note that these upper
-   * bounds is added to those in `buffer_sizes`.
-   *
-   * @tparam T The coordinates type.
-   * @param subarray The targeted subarray.
-   * @param buffer_sizes The upper bounds will be added to this map. The latter
-   *     maps an attribute to a buffer size pair. For fix-sized attributes, only
-   *     the first size is useful. For var-sized attributes, the first is the
-   *     offsets size, whereas the second is the data size.
-   * @return Status
-   */
-  template <class T>
-  Status add_est_read_buffer_sizes(
-      const T* subarray,
-      std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-      const;
-
-  /**
-   * Computes an estimate on the buffer sizes needed when reading a subarray
-   * from the fragment, for a given set of attributes. Note that these upper
-   * bounds is added to those in `buffer_sizes`. Applicable only to the dense
-   * case.
-   *
-   * @tparam T The coordinates type.
-   * @param subarray The targeted subarray.
-   * @param buffer_sizes The upper bounds will be added to this map. The latter
-   *     maps an attribute to a buffer size pair. For fix-sized attributes, only
-   *     the first size is useful. For var-sized attributes, the first is the
-   *     offsets size, whereas the second is the data size.
-   * @return Status
-   */
-  template <class T>
-  Status add_est_read_buffer_sizes_dense(
-      const T* subarray,
-      std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-      const;
-
-  /**
-   * Computes an estimate on the buffer sizes needed when reading a subarray
-   * from the fragment, for a given set of attributes. Note that these upper
-   * bounds is added to those in `buffer_sizes`. Applicable only to the sparse
-   * case.
-   *
-   * @tparam T The coordinates type.
-   * @param subarray The targeted subarray.
-   * @param buffer_sizes The upper bounds will be added to this map. The latter
-   *     maps an attribute to a buffer size pair. For fix-sized attributes, only
-   *     the first size is useful. For var-sized attributes, the first is the
-   *     offsets size, whereas the second is the data size.
-   * @return Status
-   */
-  template <class T>
-  Status add_est_read_buffer_sizes_sparse(
-      const T* subarray,
-      std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
-      const;
-
   /**
    * Returns ture if the corresponding fragment is dense, and false if it
    * is sparse.
@@ -220,12 +162,37 @@ class FragmentMetadata {
   /** Returns the size of the input variable attribute. */
   uint64_t file_var_sizes(const std::string& attribute) const;
 
-  /** Returns the format version of this fragment. */
+  /** Returns the format version of the tiles of this fragment. */
   uint32_t format_version() const;
 
   /** Returns the fragment URI. */
   const URI& fragment_uri() const;
 
+  /**
+   * Returns `true` if the fragment stores per-tile statistics (minimum,
+   * maximum, sum and number of NaN values) for the input attribute. These
+   * exist only in sparse fragments, for the numeric fixed-sized attributes
+   * with a single value per cell.
+   */
+  bool has_tile_stats(const std::string& attribute) const;
+
+  /**
+   * Retrieves the tiles of the fragment that overlap with the input subarray,
+   * along with the hyper-rectangle each tile covers. This is the MBR of the
+   * tile for sparse fragments, and the space tile for dense fragments.
+   *
+   * @tparam T The coordinates type.
+   * @param subarray The targeted subarray.
+   * @param tile_ids The ids of the overlapping tiles are appended here.
+   * @param tile_rects The rectangles of the overlapping tiles are appended
+   *     here, as `[low, high]` pairs along each dimension.
+   */
+  template <class T>
+  void get_overlapping_tiles(
+      const T* subarray,
+      std::vector<uint64_t>* tile_ids,
+      std::vector<T>* tile_rects) const;
+
   /**
    * Given as input global tile coordinates, it retrieves the tile position
    * within the fragment.
@@ -255,6 +222,12 @@ class FragmentMetadata {
   /** Returns the non-empty domain in which the fragment is constrained. */
   const void* non_empty_domain() const;
 
+  /**
+   * Returns the R-tree built over the MBRs upon loading the metadata
+   * (applicable only to sparse fragments).
+   */
+  const RTree& rtree() const;
+
   /**
    * Serializes the metadata structures into a binary buffer.
    *
@@ -323,6 +296,27 @@ class FragmentMetadata {
    */
   void set_tile_index_base(uint64_t tile_base);
 
+  /**
+   * Sets the statistics of the input tile for the input attribute (which
+   * must have statistics, see `has_tile_stats`).
+   *
+   * @param attribute The attribute.
+   * @param tile The tile index.
+   * @param min The minimum value of the tile, of the attribute type.
+   * @param max The maximum value of the tile, of the attribute type.
+   * @param sum The sum of the values of the tile, as an `int64_t`,
+   *     `uint64_t` or `double` (see `Aggregate`).
+   * @param nan_num The number of NaN values of the tile, which are
+   *     excluded from `min` and `max`.
+   */
+  void set_tile_stats(
+      const std::string& attribute,
+      uint64_t tile,
+      const void* min,
+      const void* max,
+      const void* sum,
+      uint64_t nan_num);
+
   /**
    * Sets a tile offset for the input attribute.
    *
@@ -364,6 +358,30 @@ class FragmentMetadata {
   /** Returns the number of tiles in the fragment. */
   uint64_t tile_num() const;
 
+  /**
+   * Returns the maximum value of the input tile for the input attribute,
+   * or `nullptr` if the attribute has no statistics.
+   */
+  const void* tile_max(const std::string& attribute, uint64_t tile_idx) const;
+
+  /**
+   * Returns the minimum value of the input tile for the input attribute,
+   * or `nullptr` if the attribute has no statistics.
+   */
+  const void* tile_min(const std::string& attribute, uint64_t tile_idx) const;
+
+  /**
+   * Returns the number of NaN values of the input tile for the input
+   * attribute, or 0 if the attribute has no statistics.
+   */
+  uint64_t tile_nan_num(const std::string& attribute, uint64_t tile_idx) const;
+
+  /**
+   * Returns the sum of the values of the input tile for the input
+   * attribute, or `nullptr` if the attribute has no statistics.
+   */
+  const void* tile_sum(const std::string& attribute, uint64_t tile_idx) const;
+
   /** Returns the URI of the input attribute. */
   URI attr_uri(const std::string& attribute) const;
 
@@ -492,6 +510,12 @@ class FragmentMetadata {
   /** The MBRs (applicable only to the sparse case with irregular tiles). */
   std::vector<void*> mbrs_;
 
+  /**
+   * An R-tree over `mbrs_`, built upon deserialization of the metadata
+   * (applicable only to the sparse case).
+   */
+  RTree rtree_;
+
   /** The offsets of the next tile for each attribute. */
   std::vector<uint64_t> next_tile_offsets_;
 
@@ -516,6 +540,27 @@ class FragmentMetadata {
    */
   std::vector<std::vector<uint64_t>> tile_offsets_;
 
+  /**
+   * The maximum value of each tile, per attribute. Empty for the attributes
+   * without statistics (see `has_tile_stats`).
+   */
+  std::vector<std::vector<uint8_t>> tile_max_;
+
+  /** The minimum value of each tile, per attribute. */
+  std::vector<std::vector<uint8_t>> tile_min_;
+
+  /**
+   * The number of NaN values of each tile, per attribute. The NaN values
+   * are excluded from the minimum and maximum.
+   */
+  std::vector<std::vector<uint64_t>> tile_nan_num_;
+
+  /**
+   * The sum of the values of each tile, per attribute, stored in
+   * `constants::tile_sum_size` bytes.
+   */
+  std::vector<std::vector<uint8_t>> tile_sum_;
+
   /**
    * The variable tile offsets in their corresponding attribute files.
    * Meaningful only for variable-sized tiles.
@@ -528,7 +573,10 @@ class FragmentMetadata {
    */
   std::vector<std::vector<uint64_t>> tile_var_sizes_;
 
-  /** The format version of this metadata. */
+  /**
+   * The format version of this metadata, which may be ahead of the format
+   * version of the tiles (see `constants::fragment_metadata_version`).
+   */
   uint32_t version_;
 
   /** The creation timestamp of the fragment. */
@@ -542,14 +590,6 @@ class FragmentMetadata {
   template <class T>
   std::vector<uint64_t> compute_overlapping_tile_ids(const T* subarray) const;
 
-  /**
-   * Returns the ids (positions) of the tiles overlapping `subarray`, along with
-   * with the coverage of the overlap.
-   */
-  template <class T>
-  std::vector<std::pair<uint64_t, double>> compute_overlapping_tile_ids_cov(
-      const T* subarray) const;
-
   /**
    * Retrieves the tile domain for the input `subarray` based on the expanded
    * `domain_`.
@@ -634,6 +674,15 @@ class FragmentMetadata {
    */
   Status load_tile_var_sizes(ConstBuffer* buff);
 
+  /**
+   * Loads the per-tile attribute statistics from the fragment metadata
+   * buffer (present from format version 3 onwards).
+   *
+   * @param buff Metadata buffer.
+   * @return Status
+   */
+  Status load_tile_stats(ConstBuffer* buff);
+
   /** Loads the format version from the buffer. */
   Status load_version(ConstBuffer* buff);
 
@@ -699,6 +748,20 @@ class FragmentMetadata {
    */
   Status write_tile_var_sizes(Buffer* buff);
 
+  /**
+   * Returns `true` if per-tile statistics are computed for the input
+   * attribute in a sparse fragment.
+   */
+  bool tile_stats_supported(unsigned attribute_id) const;
+
+  /**
+   * Writes the per-tile attribute statistics to the fragment metadata buffer.
+   *
+   * @param buff Metadata buffer.
+   * @return Status
+   */
+  Status write_tile_stats(Buffer* buff);
+
   /** Writes the format version to the buffer. */
   Status write_version(Buffer* buff);
 };
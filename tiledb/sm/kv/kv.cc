@@ -662,6 +662,7 @@ Status KV::set_write_query_buffers(Query* query) {
 Status KV::submit_read_query(const uint64_t* subarray) {
   // Create and send query
   auto query = new Query(storage_manager_, array_);
+  RETURN_NOT_OK_ELSE(query->set_var_offsets_format(64, false), delete query);
   RETURN_NOT_OK_ELSE(set_read_query_buffers(query), delete query);
   RETURN_NOT_OK_ELSE(query->set_subarray(subarray), delete query);
   RETURN_NOT_OK_ELSE(query->submit(), delete query);
@@ -672,6 +673,7 @@ Status KV::submit_read_query(const uint64_t* subarray) {
 
 Status KV::submit_write_query() {
   auto query = new Query(storage_manager_, array_);
+  RETURN_NOT_OK_ELSE(query->set_var_offsets_format(64, false), delete query);
   RETURN_NOT_OK_ELSE(set_write_query_buffers(query), delete query);
   RETURN_NOT_OK_ELSE(query->submit(), delete query);
   delete query;
@@ -136,11 +136,19 @@ class GlobalCmp {
   /**
    * Constructor.
    *
-   * @param dim_num The number of dimensions of the coords.
+   * @param domain The domain.
+   * @param buff The coords buffer, when sorting coordinate positions.
+   * @param hilbert_keys The precomputed Hilbert keys of the coordinates in
+   *     `buff`, so that they are not recomputed on every comparison under
+   *     the Hilbert cell order. Not applicable to `OverlappingCoords`.
    */
-  GlobalCmp(const Domain* domain, const T* buff = nullptr)
+  GlobalCmp(
+      const Domain* domain,
+      const T* buff = nullptr,
+      const uint64_t* hilbert_keys = nullptr)
       : domain_(domain)
-      , buff_(buff) {
+      , buff_(buff)
+      , hilbert_keys_(hilbert_keys) {
     dim_num_ = domain->dim_num();
   }
 
@@ -193,6 +201,9 @@ class GlobalCmp {
     // else tile_cmp == 0 --> continue
 
     // Compare cell order
+    if (hilbert_keys_ != nullptr)
+      return domain_->hilbert_order_cmp(
+                 coords_a, hilbert_keys_[a], coords_b, hilbert_keys_[b]) == -1;
     auto cell_cmp = domain_->cell_order_cmp(coords_a, coords_b);
     return cell_cmp == -1;
   }
@@ -202,6 +213,8 @@ class GlobalCmp {
   const Domain* domain_;
   /** A buffer - not applicable to sorting `OverlappingCoords`. */
   const T* buff_;
+  /** The Hilbert keys of the coordinates in `buff_` (optional). */
+  const uint64_t* hilbert_keys_;
   /** The number of dimensions. */
   unsigned dim_num_;
 };
@@ -205,6 +205,9 @@ const int vfs_file_creation_permission = S_IRWXU;
 /** The default maximum number of parallel file:/// operations. */
 const uint64_t vfs_file_max_parallel_ops = vfs_num_threads;
 
+/** The default maximum number of cached open file:/// descriptors. */
+const uint64_t vfs_file_max_open_files = 256;
+
 /** The maximum name length. */
 const uint32_t uri_max_len = 256;
 
@@ -247,6 +250,87 @@ const int num_tbb_threads = -1;
 /** The tile cache size. */
 const uint64_t tile_cache_size = 10000000;
 
+/**
+ * The maximum number of (persisted) tile bytes that a read keeps in flight,
+ * i.e., being fetched and unfiltered concurrently.
+ */
+const uint64_t read_inflight_size = 100000000;
+
+/**
+ * The maximum number of bytes between two tiles of the same file that a
+ * read fetches with a single request.
+ */
+const uint64_t read_coalesce_gap = 65536;
+
+/** The maximum size of a single (coalesced) tile read request. */
+const uint64_t read_coalesce_max_size = 10485760;
+
+/**
+ * The number of subarray partitions that a read prefetches ahead of the
+ * user (0 disables prefetching).
+ */
+const uint64_t read_prefetch_partitions = 0;
+
+/** The memory budget for the staging buffers of prefetched partitions. */
+const uint64_t read_prefetch_memory_budget = 1000000000;
+
+/**
+ * The memory budget for the fixed-sized tiles (including offsets and
+ * coordinates) that a query holds at once.
+ */
+const uint64_t memory_budget = 5368709120;
+
+/**
+ * The memory budget for the tiles of the values of var-sized attributes
+ * that a query holds at once.
+ */
+const uint64_t memory_budget_var = 10737418240;
+
+/**
+ * The maximum size of the tiles of an attribute filtered and written
+ * together in global order writes.
+ */
+const uint64_t write_batch_size = 10000000;
+
+/** The number of staging buffers of asynchronous writes (0 disables them). */
+const uint64_t write_staging_buffers = 0;
+
+/** The size (in bits) of the offsets of var-sized attribute buffers. */
+const uint32_t var_offsets_bitsize = 64;
+
+/**
+ * Whether the offsets of var-sized attribute buffers end with an extra
+ * element holding the total size of the values (as in Apache Arrow).
+ */
+const bool var_offsets_extra_element = false;
+
+/**
+ * The average cell range size (in bytes) below which a read copies the
+ * cell ranges of an attribute serially rather than in parallel.
+ */
+const uint64_t copy_parallel_min_range_size = 4096;
+
+/**
+ * The minimum number of bytes filled with a broadcast fill value for
+ * which non-temporal (cache-bypassing) stores are used.
+ */
+const uint64_t copy_nontemporal_min_size = 4194304;
+
+/**
+ * The size of the per-tile sum of an attribute in the fragment metadata,
+ * which is stored as an `int64_t`, `uint64_t` or `double`.
+ */
+const uint64_t tile_sum_size = sizeof(uint64_t);
+
+/**
+ * The number of candidate split values considered when a subarray
+ * partition is split on a real dimension.
+ */
+const uint64_t partitioner_real_split_num = 65536;
+
+/** The fanout of the R-tree built over the MBRs of a sparse fragment. */
+const unsigned rtree_fanout = 10;
+
 /** Empty String **/
 const std::string empty_str = "";
 
@@ -369,6 +453,9 @@ const std::string global_order_str = "global-order";
 /** The string representation for the unordered layout. */
 const std::string unordered_str = "unordered";
 
+/** The string representation for the Hilbert layout. */
+const std::string hilbert_str = "hilbert";
+
 /** The string representation of null. */
 const std::string null_str = "null";
 
@@ -379,6 +466,9 @@ const int32_t library_version[3] = {
 /** The TileDB serialization format version number. */
 const uint32_t format_version = 2;
 
+/** The fragment metadata format version number. */
+const uint32_t fragment_metadata_version = 3;
+
 /** The maximum size of a tile chunk (unit of compression) in bytes. */
 const uint64_t max_tile_chunk_size = 64 * 1024;
 
@@ -191,6 +191,9 @@ extern const int vfs_file_creation_permission;
 /** The default maximum number of parallel file:/// operations. */
 extern const uint64_t vfs_file_max_parallel_ops;
 
+/** The default maximum number of cached open file:/// descriptors. */
+extern const uint64_t vfs_file_max_open_files;
+
 /** The maximum name length. */
 extern const uint32_t uri_max_len;
 
@@ -227,6 +230,87 @@ extern const int num_tbb_threads;
 /** The tile cache size. */
 extern const uint64_t tile_cache_size;
 
+/**
+ * The maximum number of (persisted) tile bytes that a read keeps in flight,
+ * i.e., being fetched and unfiltered concurrently.
+ */
+extern const uint64_t read_inflight_size;
+
+/**
+ * The maximum number of bytes between two tiles of the same file that a
+ * read fetches with a single request.
+ */
+extern const uint64_t read_coalesce_gap;
+
+/** The maximum size of a single (coalesced) tile read request. */
+extern const uint64_t read_coalesce_max_size;
+
+/**
+ * The number of subarray partitions that a read prefetches ahead of the
+ * user (0 disables prefetching).
+ */
+extern const uint64_t read_prefetch_partitions;
+
+/** The memory budget for the staging buffers of prefetched partitions. */
+extern const uint64_t read_prefetch_memory_budget;
+
+/**
+ * The memory budget for the fixed-sized tiles (including offsets and
+ * coordinates) that a query holds at once.
+ */
+extern const uint64_t memory_budget;
+
+/**
+ * The memory budget for the tiles of the values of var-sized attributes
+ * that a query holds at once.
+ */
+extern const uint64_t memory_budget_var;
+
+/**
+ * The maximum size of the tiles of an attribute filtered and written
+ * together in global order writes.
+ */
+extern const uint64_t write_batch_size;
+
+/** The number of staging buffers of asynchronous writes (0 disables them). */
+extern const uint64_t write_staging_buffers;
+
+/** The size (in bits) of the offsets of var-sized attribute buffers. */
+extern const uint32_t var_offsets_bitsize;
+
+/**
+ * Whether the offsets of var-sized attribute buffers end with an extra
+ * element holding the total size of the values (as in Apache Arrow).
+ */
+extern const bool var_offsets_extra_element;
+
+/**
+ * The average cell range size (in bytes) below which a read copies the
+ * cell ranges of an attribute serially rather than in parallel.
+ */
+extern const uint64_t copy_parallel_min_range_size;
+
+/**
+ * The minimum number of bytes filled with a broadcast fill value for
+ * which non-temporal (cache-bypassing) stores are used.
+ */
+extern const uint64_t copy_nontemporal_min_size;
+
+/**
+ * The size of the per-tile sum of an attribute in the fragment metadata,
+ * which is stored as an `int64_t`, `uint64_t` or `double`.
+ */
+extern const uint64_t tile_sum_size;
+
+/**
+ * The number of candidate split values considered when a subarray
+ * partition is split on a real dimension.
+ */
+extern const uint64_t partitioner_real_split_num;
+
+/** The fanout of the R-tree built over the MBRs of a sparse fragment. */
+extern const unsigned rtree_fanout;
+
 /** Empty String reference **/
 extern const std::string empty_str;
 
@@ -350,6 +434,9 @@ extern const std::string global_order_str;
 /** The string representation for the unordered layout. */
 extern const std::string unordered_str;
 
+/** The string representation for the Hilbert layout. */
+extern const std::string hilbert_str;
+
 /** The string representation of null. */
 extern const std::string null_str;
 
@@ -359,6 +446,13 @@ extern const int32_t library_version[3];
 /** The TileDB serialization format version number. */
 extern const uint32_t format_version;
 
+/**
+ * The fragment metadata format version number. It is ahead of
+ * `format_version` because the fragment metadata also stores the per-tile
+ * attribute statistics.
+ */
+extern const uint32_t fragment_metadata_version;
+
 /** The maximum size of a tile chunk (unit of compression) in bytes. */
 extern const uint64_t max_tile_chunk_size;
 
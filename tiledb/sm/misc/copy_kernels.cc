@@ -0,0 +1,268 @@
+/**
+ * @file   copy_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ * @copyright Copyright (c) 2016 MIT and Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements the kernels used to materialize cell ranges into the
+ * user buffers.
+ */
+
+#include "tiledb/sm/misc/copy_kernels.h"
+#include "tiledb/sm/misc/constants.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace tiledb {
+namespace sm {
+
+namespace copy_kernels {
+
+/* ****************************** */
+/*            CONSTANTS           */
+/* ****************************** */
+
+/**
+ * The size of the filled prefix (in bytes) that `fill` stops doubling at,
+ * and then replicates block by block. It is kept small enough for the
+ * source block to remain in L1.
+ */
+static const uint64_t fill_block_size = 4096;
+
+/**
+ * The side (in cells) of the square blocks in which `copy_box` transposes
+ * cells, so that the cache lines touched in both buffers are reused.
+ */
+static const uint64_t transpose_block_size = 16;
+
+/* ****************************** */
+/*        STATIC FUNCTIONS        */
+/* ****************************** */
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+#ifdef __AVX2__
+typedef __m256i vec_t;
+#define VEC_LOADU(p) _mm256_loadu_si256((const __m256i*)(p))
+#define VEC_STREAM(p, v) _mm256_stream_si256((__m256i*)(p), (v))
+#else
+typedef __m128i vec_t;
+#define VEC_LOADU(p) _mm_loadu_si128((const __m128i*)(p))
+#define VEC_STREAM(p, v) _mm_stream_si128((__m128i*)(p), (v))
+#endif
+
+/**
+ * Completes a fill with non-temporal stores. The first `filled` bytes
+ * of `out` already hold the pattern and the value size divides the
+ * vector width, so any vector-sized window of the filled prefix ending
+ * right before an address is the pattern in the phase of that address.
+ */
+static void fill_nontemporal(
+    unsigned char* out, uint64_t filled, uint64_t size) {
+  const uint64_t width = sizeof(vec_t);
+  assert(filled >= width);
+  auto end = out + size;
+  auto p = out + filled;
+
+  // Head, up to the first aligned address
+  auto misalignment = (uintptr_t)p % width;
+  if (misalignment != 0) {
+    auto head = std::min<uint64_t>(width - misalignment, end - p);
+    std::memcpy(p, p - width, head);
+    p += head;
+  }
+
+  // Aligned body
+  auto v = VEC_LOADU(p - width);
+  for (; p + width <= end; p += width)
+    VEC_STREAM(p, v);
+  _mm_sfence();
+
+  // Tail
+  if (p < end)
+    std::memcpy(p, p - width, end - p);
+}
+
+#undef VEC_LOADU
+#undef VEC_STREAM
+
+#endif
+
+/**
+ * Copies the cells of a hyper-rectangle, as described in `copy_box`.
+ * `N` is the cell size if it is known at compile time, and 0 otherwise.
+ */
+template <uint64_t N>
+static void copy_box(
+    const unsigned char* src,
+    const std::vector<uint64_t>& src_strides,
+    unsigned char* dst,
+    const std::vector<uint64_t>& dst_strides,
+    const std::vector<uint64_t>& extents,
+    uint64_t cell_size) {
+  auto size = (N != 0) ? N : cell_size;
+  auto dim_num = (unsigned)extents.size();
+
+  // The dimensions along which the cells are contiguous
+  unsigned src_dim = 0, dst_dim = 0;
+  for (unsigned d = 1; d < dim_num; ++d) {
+    if (src_strides[d] < src_strides[src_dim])
+      src_dim = d;
+    if (dst_strides[d] < dst_strides[dst_dim])
+      dst_dim = d;
+  }
+  auto contiguous = (src_dim == dst_dim && src_strides[src_dim] == 1 &&
+                     dst_strides[dst_dim] == 1);
+
+  // Iterate over the remaining dimensions
+  std::vector<unsigned> outer_dims;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (d != src_dim && d != dst_dim)
+      outer_dims.push_back(d);
+  }
+  std::vector<uint64_t> idx(outer_dims.size(), 0);
+  const auto n_i = extents[src_dim], n_j = extents[dst_dim];
+  const auto src_i = src_strides[src_dim], src_j = src_strides[dst_dim];
+  const auto dst_i = dst_strides[src_dim], dst_j = dst_strides[dst_dim];
+  const auto block = transpose_block_size;
+  while (true) {
+    uint64_t src_offset = 0, dst_offset = 0;
+    for (size_t k = 0; k < outer_dims.size(); ++k) {
+      src_offset += idx[k] * src_strides[outer_dims[k]];
+      dst_offset += idx[k] * dst_strides[outer_dims[k]];
+    }
+    auto s = src + src_offset * size;
+    auto d = dst + dst_offset * size;
+
+    if (contiguous) {
+      std::memcpy(d, s, n_j * size);
+    } else if (src_dim == dst_dim) {
+      for (uint64_t j = 0; j < n_j; ++j)
+        std::memcpy(d + j * dst_j * size, s + j * src_j * size, size);
+    } else {
+      for (uint64_t i0 = 0; i0 < n_i; i0 += block) {
+        auto i1 = std::min(i0 + block, n_i);
+        for (uint64_t j0 = 0; j0 < n_j; j0 += block) {
+          auto j1 = std::min(j0 + block, n_j);
+          for (auto i = i0; i < i1; ++i) {
+            for (auto j = j0; j < j1; ++j)
+              std::memcpy(
+                  d + (i * dst_i + j * dst_j) * size,
+                  s + (i * src_i + j * src_j) * size,
+                  size);
+          }
+        }
+      }
+    }
+
+    // Advance to the next combination of the remaining dimensions
+    size_t k = 0;
+    for (; k < outer_dims.size(); ++k) {
+      if (++idx[k] < extents[outer_dims[k]])
+        break;
+      idx[k] = 0;
+    }
+    if (k == outer_dims.size())
+      break;
+  }
+}
+
+/* ****************************** */
+/*            FUNCTIONS           */
+/* ****************************** */
+
+void copy_box(
+    const void* src,
+    const std::vector<uint64_t>& src_strides,
+    void* dst,
+    const std::vector<uint64_t>& dst_strides,
+    const std::vector<uint64_t>& extents,
+    uint64_t cell_size) {
+  assert(src_strides.size() == extents.size());
+  assert(dst_strides.size() == extents.size());
+  auto s = (const unsigned char*)src;
+  auto d = (unsigned char*)dst;
+  switch (cell_size) {
+    case 1:
+      return copy_box<1>(s, src_strides, d, dst_strides, extents, cell_size);
+    case 2:
+      return copy_box<2>(s, src_strides, d, dst_strides, extents, cell_size);
+    case 4:
+      return copy_box<4>(s, src_strides, d, dst_strides, extents, cell_size);
+    case 8:
+      return copy_box<8>(s, src_strides, d, dst_strides, extents, cell_size);
+    default:
+      return copy_box<0>(s, src_strides, d, dst_strides, extents, cell_size);
+  }
+}
+
+void fill(void* dst, uint64_t size, const void* value, uint64_t value_size) {
+  assert(value_size > 0);
+  assert(size % value_size == 0);
+  if (size == 0)
+    return;
+
+  // Write the value once and double the filled prefix. Every copy is a
+  // multiple of the value size, so the pattern stays in phase.
+  auto out = (unsigned char*)dst;
+  uint64_t filled = std::min(size, value_size);
+  std::memcpy(out, value, filled);
+  while (filled < size && filled < fill_block_size) {
+    auto n = std::min(filled, size - filled);
+    std::memcpy(out + filled, out, n);
+    filled += n;
+  }
+  if (filled == size)
+    return;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  if (size >= constants::copy_nontemporal_min_size &&
+      sizeof(vec_t) % value_size == 0) {
+    fill_nontemporal(out, filled, size);
+    return;
+  }
+#endif
+
+  // Replicate the (cache-resident) prefix block by block
+  auto block = filled;
+  while (filled < size) {
+    auto n = std::min(block, size - filled);
+    std::memcpy(out + filled, out, n);
+    filled += n;
+  }
+}
+
+}  // namespace copy_kernels
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,90 @@
+/**
+ * @file   copy_kernels.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ * @copyright Copyright (c) 2016 MIT and Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the kernels used to materialize cell ranges into the
+ * user buffers.
+ */
+
+#ifndef TILEDB_COPY_KERNELS_H
+#define TILEDB_COPY_KERNELS_H
+
+#include <cinttypes>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+namespace copy_kernels {
+
+/**
+ * Copies a hyper-rectangle of cells between two buffers, where each buffer
+ * lays out the cells with its own strides (in cells) along each dimension.
+ * This transforms, e.g., a decoded tile in the cell order into its place
+ * in a row- or col-major result. If the two buffers share the dimension
+ * along which cells are contiguous, whole runs are copied at once;
+ * otherwise, the cells are transposed in cache-sized blocks.
+ *
+ * @param src The first cell of the hyper-rectangle in the source.
+ * @param src_strides The strides of the source along each dimension.
+ * @param dst The first cell of the hyper-rectangle in the destination.
+ * @param dst_strides The strides of the destination along each dimension.
+ * @param extents The number of cells along each dimension.
+ * @param cell_size The size of a cell in bytes.
+ */
+void copy_box(
+    const void* src,
+    const std::vector<uint64_t>& src_strides,
+    void* dst,
+    const std::vector<uint64_t>& dst_strides,
+    const std::vector<uint64_t>& extents,
+    uint64_t cell_size);
+
+/**
+ * Fills `size` bytes of `dst` by repeating the `value_size` bytes of
+ * `value`, i.e., broadcasts a (fill) value over a buffer. The value is
+ * written once and the filled prefix is then doubled with block copies,
+ * so the cost does not depend on the number of values. Large fills whose
+ * value size divides the vector width bypass the cache with non-temporal
+ * stores, when the target supports them.
+ *
+ * @param dst The destination buffer.
+ * @param size The number of bytes to fill. It must be a multiple of
+ *     `value_size`.
+ * @param value The value to broadcast.
+ * @param value_size The size of the value in bytes.
+ */
+void fill(void* dst, uint64_t size, const void* value, uint64_t value_size);
+
+}  // namespace copy_kernels
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_COPY_KERNELS_H
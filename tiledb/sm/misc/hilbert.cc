@@ -0,0 +1,114 @@
+/**
+ * @file   hilbert.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class Hilbert.
+ */
+
+#include "tiledb/sm/misc/hilbert.h"
+
+#include <cassert>
+
+namespace tiledb {
+namespace sm {
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+Hilbert::Hilbert(unsigned dim_num, unsigned bits)
+    : bits_(bits)
+    , dim_num_(dim_num) {
+  assert(dim_num_ > 0 && bits_ > 0);
+  assert(dim_num_ * bits_ <= max_key_bits);
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+unsigned Hilbert::bits() const {
+  return bits_;
+}
+
+unsigned Hilbert::dim_num() const {
+  return dim_num_;
+}
+
+uint64_t Hilbert::key(uint64_t* coords) const {
+  // A single dimension is traversed in order
+  if (dim_num_ == 1)
+    return coords[0];
+
+  // Interleave the bits of the transposed form, from the most significant
+  // bit of the first coordinate to the least significant bit of the last one
+  axes_to_transpose(coords);
+  uint64_t key = 0;
+  for (unsigned j = bits_; j-- > 0;) {
+    for (unsigned i = 0; i < dim_num_; ++i)
+      key = (key << 1) | ((coords[i] >> j) & 1);
+  }
+
+  return key;
+}
+
+/* ********************************* */
+/*          PRIVATE METHODS          */
+/* ********************************* */
+
+void Hilbert::axes_to_transpose(uint64_t* coords) const {
+  uint64_t m = uint64_t(1) << (bits_ - 1), p, q, t;
+
+  // Inverse undo
+  for (q = m; q > 1; q >>= 1) {
+    p = q - 1;
+    for (unsigned i = 0; i < dim_num_; ++i) {
+      if (coords[i] & q) {
+        coords[0] ^= p;
+      } else {
+        t = (coords[0] ^ coords[i]) & p;
+        coords[0] ^= t;
+        coords[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (unsigned i = 1; i < dim_num_; ++i)
+    coords[i] ^= coords[i - 1];
+  t = 0;
+  for (q = m; q > 1; q >>= 1) {
+    if (coords[dim_num_ - 1] & q)
+      t ^= q - 1;
+  }
+  for (unsigned i = 0; i < dim_num_; ++i)
+    coords[i] ^= t;
+}
+
+}  // namespace sm
+}  // namespace tiledb
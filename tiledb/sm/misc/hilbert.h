@@ -0,0 +1,114 @@
+/**
+ * @file   hilbert.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class Hilbert, which maps multi-dimensional points to
+ * their positions on a Hilbert curve.
+ */
+
+#ifndef TILEDB_HILBERT_H
+#define TILEDB_HILBERT_H
+
+#include <cstdint>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Maps points of a `dim_num`-dimensional grid with `2^bits` cells per side
+ * to their positions (keys) along the Hilbert curve that fills the grid.
+ * Points that are close in the grid tend to have close keys, which is why
+ * sorting cells on their keys yields spatially compact runs of cells.
+ *
+ * The conversion follows J. Skilling, "Programming the Hilbert curve",
+ * AIP Conference Proceedings 707, 2004.
+ */
+class Hilbert {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param dim_num The number of dimensions.
+   * @param bits The number of bits of each coordinate. `dim_num * bits`
+   *     must not exceed 64, so that keys fit in a `uint64_t`.
+   */
+  Hilbert(unsigned dim_num, unsigned bits);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the number of bits of each coordinate. */
+  unsigned bits() const;
+
+  /** Returns the number of dimensions. */
+  unsigned dim_num() const;
+
+  /**
+   * Returns the Hilbert key of the input point.
+   *
+   * @param coords The coordinates of the point, each in `[0, 2^bits)`. They
+   *     are used as scratch space and overwritten.
+   * @return The key, in `[0, 2^(dim_num * bits))`.
+   */
+  uint64_t key(uint64_t* coords) const;
+
+  /** The maximum number of bits of a key. */
+  static const unsigned max_key_bits = 64;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The number of bits of each coordinate. */
+  unsigned bits_;
+
+  /** The number of dimensions. */
+  unsigned dim_num_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Transforms the input coordinates in place into the "transposed" form of
+   * their Hilbert key, where bit `j` of coordinate `i` holds bit
+   * `j * dim_num + (dim_num - 1 - i)` of the key.
+   */
+  void axes_to_transpose(uint64_t* coords) const;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_HILBERT_H
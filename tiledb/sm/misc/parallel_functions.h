@@ -35,6 +35,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "tiledb/sm/misc/status.h"
 
 #ifdef HAVE_TBB
 #include <tbb/parallel_for.h>
@@ -108,22 +112,117 @@ std::vector<Status> parallel_for_each(IterT begin, IterT end, const FuncT& F) {
   return result;
 }
 
+/**
+ * Call the given function on each index in the given range, possibly in
+ * parallel.
+ *
+ * @tparam FuncT Function type (returning Status).
+ * @param begin Beginning of the range (inclusive).
+ * @param end End of the range (exclusive).
+ * @param F Function to call on each index
+ * @return Vector of Status objects, where the status of `F(i)` is at
+ *     position `i - begin`.
+ */
 template <typename FuncT>
 std::vector<Status> parallel_for(uint64_t begin, uint64_t end, const FuncT& F) {
   assert(begin < end);
   uint64_t num_iters = end - begin;
   std::vector<Status> result(num_iters);
 #ifdef HAVE_TBB
-  tbb::parallel_for(
-      begin, end, [&result, &F](uint64_t i) { result[i] = F(i); });
+  tbb::parallel_for(begin, end, [begin, &result, &F](uint64_t i) {
+    result[i - begin] = F(i);
+  });
 #else
   for (uint64_t i = begin; i < end; i++) {
-    result[i] = F(i);
+    result[i - begin] = F(i);
   }
 #endif
   return result;
 }
 
+/**
+ * Sorts the given keys in ascending order, possibly in parallel, applying
+ * the same permutation to the given values. The sort is a stable LSD radix
+ * sort that visits only the `key_bits` least significant bits of the keys,
+ * one byte at a time. Within each pass, the keys are split into chunks
+ * whose digits are counted and scattered in parallel.
+ *
+ * @tparam ValueT Value type
+ * @param keys The keys to sort by.
+ * @param values The values to permute along with the keys.
+ * @param key_bits The number of significant bits in the keys.
+ */
+template <typename ValueT>
+void parallel_radix_sort(
+    std::vector<uint64_t>* keys,
+    std::vector<ValueT>* values,
+    unsigned key_bits) {
+  assert(keys->size() == values->size());
+  const uint64_t num = keys->size();
+  const uint64_t radix = 256;
+  const uint64_t min_chunk_size = 1 << 16;
+  const uint64_t max_num_chunks = 64;
+  if (num < 2)
+    return;
+
+  uint64_t num_chunks =
+      std::min(std::max(num / min_chunk_size, uint64_t(1)), max_num_chunks);
+  uint64_t chunk_size = (num + num_chunks - 1) / num_chunks;
+  num_chunks = (num + chunk_size - 1) / chunk_size;
+
+  std::vector<uint64_t> tmp_keys(num);
+  std::vector<ValueT> tmp_values(num);
+  std::vector<uint64_t> counts(num_chunks * radix);
+  for (unsigned shift = 0; shift < key_bits; shift += 8) {
+    // Count the digits of each chunk
+    std::fill(counts.begin(), counts.end(), 0);
+    parallel_for(0, num_chunks, [&](uint64_t c) {
+      uint64_t* chunk_counts = &counts[c * radix];
+      uint64_t end = std::min((c + 1) * chunk_size, num);
+      for (uint64_t i = c * chunk_size; i < end; ++i)
+        ++chunk_counts[((*keys)[i] >> shift) & (radix - 1)];
+      return Status::Ok();
+    });
+
+    // Skip the pass if all keys share the digit
+    bool skip = false;
+    for (uint64_t d = 0; d < radix && !skip; ++d) {
+      uint64_t digit_count = 0;
+      for (uint64_t c = 0; c < num_chunks; ++c)
+        digit_count += counts[c * radix + d];
+      skip = (digit_count == num);
+    }
+    if (skip)
+      continue;
+
+    // Turn the counts into the offsets where each chunk scatters each digit,
+    // preserving the order of the chunks within every digit
+    uint64_t offset = 0;
+    for (uint64_t d = 0; d < radix; ++d) {
+      for (uint64_t c = 0; c < num_chunks; ++c) {
+        uint64_t count = counts[c * radix + d];
+        counts[c * radix + d] = offset;
+        offset += count;
+      }
+    }
+
+    // Scatter the keys and values of each chunk
+    parallel_for(0, num_chunks, [&](uint64_t c) {
+      uint64_t* chunk_offsets = &counts[c * radix];
+      uint64_t end = std::min((c + 1) * chunk_size, num);
+      for (uint64_t i = c * chunk_size; i < end; ++i) {
+        uint64_t pos = chunk_offsets[((*keys)[i] >> shift) & (radix - 1)]++;
+        tmp_keys[pos] = (*keys)[i];
+        tmp_values[pos] = (*values)[i];
+      }
+      return Status::Ok();
+    });
+
+    keys->swap(tmp_keys);
+    values->swap(tmp_values);
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
@@ -159,6 +159,26 @@ bool Statistics::enabled() const {
   return enabled_;
 }
 
+void Statistics::gauge_add(
+    std::atomic<uint64_t>* gauge,
+    std::atomic<uint64_t>* peak,
+    uint64_t value) {
+  // A failed exchange reloads the peak, so the loop ends once the peak
+  // is at least the current value
+  auto current = (*gauge += value);
+  auto cur_peak = peak->load();
+  while (cur_peak < current &&
+         !peak->compare_exchange_weak(cur_peak, current)) {
+  }
+}
+
+void Statistics::gauge_sub(std::atomic<uint64_t>* gauge, uint64_t value) {
+  auto current = gauge->load();
+  while (!gauge->compare_exchange_weak(
+      current, (current > value) ? current - value : 0)) {
+  }
+}
+
 void Statistics::set_enabled(bool enabled) {
   enabled_ = enabled;
 }
@@ -92,6 +92,31 @@ class Statistics {
   /** Enable or disable statistics gathering. */
   void set_enabled(bool enabled);
 
+  /**
+   * Adds a value to a gauge, i.e., a counter that holds a current usage,
+   * and raises the peak counter of the gauge if needed. Gauges are kept
+   * even when statistics are disabled, so that they stay consistent. Like
+   * all the statistics, gauges are process-global, summing the usage of
+   * all the queries in flight.
+   *
+   * @param gauge The gauge counter.
+   * @param peak The peak counter of the gauge.
+   * @param value The value to add.
+   */
+  void gauge_add(
+      std::atomic<uint64_t>* gauge,
+      std::atomic<uint64_t>* peak,
+      uint64_t value);
+
+  /**
+   * Subtracts a value from a gauge, saturating at zero (the gauge may have
+   * been reset in the meantime).
+   *
+   * @param gauge The gauge counter.
+   * @param value The value to subtract.
+   */
+  void gauge_sub(std::atomic<uint64_t>* gauge, uint64_t value);
+
  private:
   /** True if stats are being gathered. */
   bool enabled_;
@@ -224,6 +249,20 @@ extern Statistics all_stats;
     stats::all_stats.counter_##counter_name += (value); \
   }
 
+/**
+ * Adds a value to a gauge counter stat (e.g., a current memory usage),
+ * updating its `_peak` counter stat.
+ */
+#define STATS_GAUGE_ADD(gauge_name, value)           \
+  stats::all_stats.gauge_add(                        \
+      &stats::all_stats.counter_##gauge_name,        \
+      &stats::all_stats.counter_##gauge_name##_peak, \
+      (value))
+
+/** Subtracts a value from a gauge counter stat. */
+#define STATS_GAUGE_SUB(gauge_name, value) \
+  stats::all_stats.gauge_sub(&stats::all_stats.counter_##gauge_name, (value))
+
 /** Starts an ad hoc timer of the given name. */
 #define STATS_TIMER_START(name) \
   auto __timer_##name = std::chrono::steady_clock::now()
@@ -54,9 +54,12 @@ STATS_DEFINE_FUNC_STAT(cache_lru_invalidate)
 STATS_DEFINE_FUNC_STAT(cache_lru_read)
 STATS_DEFINE_FUNC_STAT(cache_lru_read_partial)
 // Reader
+STATS_DEFINE_FUNC_STAT(reader_aggregate_read)
+STATS_DEFINE_FUNC_STAT(reader_apply_query_condition)
 STATS_DEFINE_FUNC_STAT(reader_compute_cell_ranges)
 STATS_DEFINE_FUNC_STAT(reader_compute_dense_cell_ranges)
 STATS_DEFINE_FUNC_STAT(reader_compute_dense_overlapping_tiles_and_cell_ranges)
+STATS_DEFINE_FUNC_STAT(reader_compute_dense_tile_runs)
 STATS_DEFINE_FUNC_STAT(reader_compute_overlapping_coords)
 STATS_DEFINE_FUNC_STAT(reader_compute_overlapping_tiles)
 STATS_DEFINE_FUNC_STAT(reader_compute_tile_coords)
@@ -64,14 +67,19 @@ STATS_DEFINE_FUNC_STAT(reader_copy_fixed_cells)
 STATS_DEFINE_FUNC_STAT(reader_copy_var_cells)
 STATS_DEFINE_FUNC_STAT(reader_dedup_coords)
 STATS_DEFINE_FUNC_STAT(reader_dense_read)
+STATS_DEFINE_FUNC_STAT(reader_dense_read_transform)
+STATS_DEFINE_FUNC_STAT(reader_fetch_tiles)
 STATS_DEFINE_FUNC_STAT(reader_fill_coords)
-STATS_DEFINE_FUNC_STAT(reader_filter_tiles)
 STATS_DEFINE_FUNC_STAT(reader_init_tile_fragment_dense_cell_range_iters)
+STATS_DEFINE_FUNC_STAT(reader_merge_coords)
 STATS_DEFINE_FUNC_STAT(reader_next_subarray_partition)
 STATS_DEFINE_FUNC_STAT(reader_read)
 STATS_DEFINE_FUNC_STAT(reader_read_all_tiles)
 STATS_DEFINE_FUNC_STAT(reader_sort_coords)
 STATS_DEFINE_FUNC_STAT(reader_sparse_read)
+STATS_DEFINE_FUNC_STAT(reader_unfilter_tile)
+STATS_DEFINE_FUNC_STAT(reader_wait_prefetched_partition)
+STATS_DEFINE_FUNC_STAT(reader_wait_tile_pipeline)
 // Writer
 STATS_DEFINE_FUNC_STAT(writer_check_coord_dups)
 STATS_DEFINE_FUNC_STAT(writer_check_coord_dups_global)
@@ -79,8 +87,10 @@ STATS_DEFINE_FUNC_STAT(writer_check_global_order)
 STATS_DEFINE_FUNC_STAT(writer_compute_coord_dups)
 STATS_DEFINE_FUNC_STAT(writer_compute_coord_dups_global)
 STATS_DEFINE_FUNC_STAT(writer_compute_coords_metadata)
+STATS_DEFINE_FUNC_STAT(writer_compute_tile_stats)
 STATS_DEFINE_FUNC_STAT(writer_compute_write_cell_ranges)
 STATS_DEFINE_FUNC_STAT(writer_create_fragment)
+STATS_DEFINE_FUNC_STAT(writer_filter_and_write_tiles)
 STATS_DEFINE_FUNC_STAT(writer_filter_tiles)
 STATS_DEFINE_FUNC_STAT(writer_global_write)
 STATS_DEFINE_FUNC_STAT(writer_init_global_write_state)
@@ -92,6 +102,7 @@ STATS_DEFINE_FUNC_STAT(writer_prepare_tiles_fixed)
 STATS_DEFINE_FUNC_STAT(writer_prepare_tiles_ordered)
 STATS_DEFINE_FUNC_STAT(writer_prepare_tiles_var)
 STATS_DEFINE_FUNC_STAT(writer_sort_coords)
+STATS_DEFINE_FUNC_STAT(writer_stage_batch)
 STATS_DEFINE_FUNC_STAT(writer_unordered_write)
 STATS_DEFINE_FUNC_STAT(writer_write)
 STATS_DEFINE_FUNC_STAT(writer_write_all_tiles)
@@ -164,9 +175,12 @@ STATS_INIT_FUNC_STAT(cache_lru_invalidate)
 STATS_INIT_FUNC_STAT(cache_lru_read)
 STATS_INIT_FUNC_STAT(cache_lru_read_partial)
 // Reader
+STATS_INIT_FUNC_STAT(reader_aggregate_read)
+STATS_INIT_FUNC_STAT(reader_apply_query_condition)
 STATS_INIT_FUNC_STAT(reader_compute_cell_ranges)
 STATS_INIT_FUNC_STAT(reader_compute_dense_cell_ranges)
 STATS_INIT_FUNC_STAT(reader_compute_dense_overlapping_tiles_and_cell_ranges)
+STATS_INIT_FUNC_STAT(reader_compute_dense_tile_runs)
 STATS_INIT_FUNC_STAT(reader_compute_overlapping_coords)
 STATS_INIT_FUNC_STAT(reader_compute_overlapping_tiles)
 STATS_INIT_FUNC_STAT(reader_compute_tile_coords)
@@ -174,14 +188,19 @@ STATS_INIT_FUNC_STAT(reader_copy_fixed_cells)
 STATS_INIT_FUNC_STAT(reader_copy_var_cells)
 STATS_INIT_FUNC_STAT(reader_dedup_coords)
 STATS_INIT_FUNC_STAT(reader_dense_read)
+STATS_INIT_FUNC_STAT(reader_dense_read_transform)
+STATS_INIT_FUNC_STAT(reader_fetch_tiles)
 STATS_INIT_FUNC_STAT(reader_fill_coords)
-STATS_INIT_FUNC_STAT(reader_filter_tiles)
 STATS_INIT_FUNC_STAT(reader_init_tile_fragment_dense_cell_range_iters)
+STATS_INIT_FUNC_STAT(reader_merge_coords)
 STATS_INIT_FUNC_STAT(reader_next_subarray_partition)
 STATS_INIT_FUNC_STAT(reader_read)
 STATS_INIT_FUNC_STAT(reader_read_all_tiles)
 STATS_INIT_FUNC_STAT(reader_sort_coords)
 STATS_INIT_FUNC_STAT(reader_sparse_read)
+STATS_INIT_FUNC_STAT(reader_unfilter_tile)
+STATS_INIT_FUNC_STAT(reader_wait_prefetched_partition)
+STATS_INIT_FUNC_STAT(reader_wait_tile_pipeline)
 // Writer
 STATS_INIT_FUNC_STAT(writer_check_coord_dups)
 STATS_INIT_FUNC_STAT(writer_check_coord_dups_global)
@@ -189,8 +208,10 @@ STATS_INIT_FUNC_STAT(writer_check_global_order)
 STATS_INIT_FUNC_STAT(writer_compute_coord_dups)
 STATS_INIT_FUNC_STAT(writer_compute_coord_dups_global)
 STATS_INIT_FUNC_STAT(writer_compute_coords_metadata)
+STATS_INIT_FUNC_STAT(writer_compute_tile_stats)
 STATS_INIT_FUNC_STAT(writer_compute_write_cell_ranges)
 STATS_INIT_FUNC_STAT(writer_create_fragment)
+STATS_INIT_FUNC_STAT(writer_filter_and_write_tiles)
 STATS_INIT_FUNC_STAT(writer_filter_tiles)
 STATS_INIT_FUNC_STAT(writer_global_write)
 STATS_INIT_FUNC_STAT(writer_init_global_write_state)
@@ -202,6 +223,7 @@ STATS_INIT_FUNC_STAT(writer_prepare_tiles_fixed)
 STATS_INIT_FUNC_STAT(writer_prepare_tiles_ordered)
 STATS_INIT_FUNC_STAT(writer_prepare_tiles_var)
 STATS_INIT_FUNC_STAT(writer_sort_coords)
+STATS_INIT_FUNC_STAT(writer_stage_batch)
 STATS_INIT_FUNC_STAT(writer_unordered_write)
 STATS_INIT_FUNC_STAT(writer_write)
 STATS_INIT_FUNC_STAT(writer_write_all_tiles)
@@ -275,9 +297,12 @@ STATS_REPORT_FUNC_STAT(cache_lru_invalidate)
 STATS_REPORT_FUNC_STAT(cache_lru_read)
 STATS_REPORT_FUNC_STAT(cache_lru_read_partial)
 // Reader
+STATS_REPORT_FUNC_STAT(reader_aggregate_read)
+STATS_REPORT_FUNC_STAT(reader_apply_query_condition)
 STATS_REPORT_FUNC_STAT(reader_compute_cell_ranges)
 STATS_REPORT_FUNC_STAT(reader_compute_dense_cell_ranges)
 STATS_REPORT_FUNC_STAT(reader_compute_dense_overlapping_tiles_and_cell_ranges)
+STATS_REPORT_FUNC_STAT(reader_compute_dense_tile_runs)
 STATS_REPORT_FUNC_STAT(reader_compute_overlapping_coords)
 STATS_REPORT_FUNC_STAT(reader_compute_overlapping_tiles)
 STATS_REPORT_FUNC_STAT(reader_compute_tile_coords)
@@ -285,14 +310,19 @@ STATS_REPORT_FUNC_STAT(reader_copy_fixed_cells)
 STATS_REPORT_FUNC_STAT(reader_copy_var_cells)
 STATS_REPORT_FUNC_STAT(reader_dedup_coords)
 STATS_REPORT_FUNC_STAT(reader_dense_read)
+STATS_REPORT_FUNC_STAT(reader_dense_read_transform)
+STATS_REPORT_FUNC_STAT(reader_fetch_tiles)
 STATS_REPORT_FUNC_STAT(reader_fill_coords)
-STATS_REPORT_FUNC_STAT(reader_filter_tiles)
 STATS_REPORT_FUNC_STAT(reader_init_tile_fragment_dense_cell_range_iters)
+STATS_REPORT_FUNC_STAT(reader_merge_coords)
 STATS_REPORT_FUNC_STAT(reader_next_subarray_partition)
 STATS_REPORT_FUNC_STAT(reader_read)
 STATS_REPORT_FUNC_STAT(reader_read_all_tiles)
 STATS_REPORT_FUNC_STAT(reader_sort_coords)
 STATS_REPORT_FUNC_STAT(reader_sparse_read)
+STATS_REPORT_FUNC_STAT(reader_unfilter_tile)
+STATS_REPORT_FUNC_STAT(reader_wait_prefetched_partition)
+STATS_REPORT_FUNC_STAT(reader_wait_tile_pipeline)
 // Writer
 STATS_REPORT_FUNC_STAT(writer_check_coord_dups)
 STATS_REPORT_FUNC_STAT(writer_check_coord_dups_global)
@@ -300,8 +330,10 @@ STATS_REPORT_FUNC_STAT(writer_check_global_order)
 STATS_REPORT_FUNC_STAT(writer_compute_coord_dups)
 STATS_REPORT_FUNC_STAT(writer_compute_coord_dups_global)
 STATS_REPORT_FUNC_STAT(writer_compute_coords_metadata)
+STATS_REPORT_FUNC_STAT(writer_compute_tile_stats)
 STATS_REPORT_FUNC_STAT(writer_compute_write_cell_ranges)
 STATS_REPORT_FUNC_STAT(writer_create_fragment)
+STATS_REPORT_FUNC_STAT(writer_filter_and_write_tiles)
 STATS_REPORT_FUNC_STAT(writer_filter_tiles)
 STATS_REPORT_FUNC_STAT(writer_global_write)
 STATS_REPORT_FUNC_STAT(writer_init_global_write_state)
@@ -313,6 +345,7 @@ STATS_REPORT_FUNC_STAT(writer_prepare_tiles_fixed)
 STATS_REPORT_FUNC_STAT(writer_prepare_tiles_ordered)
 STATS_REPORT_FUNC_STAT(writer_prepare_tiles_var)
 STATS_REPORT_FUNC_STAT(writer_sort_coords)
+STATS_REPORT_FUNC_STAT(writer_stage_batch)
 STATS_REPORT_FUNC_STAT(writer_unordered_write)
 STATS_REPORT_FUNC_STAT(writer_write)
 STATS_REPORT_FUNC_STAT(writer_write_all_tiles)
@@ -368,16 +401,35 @@ STATS_DEFINE_COUNTER_STAT(cache_lru_read_hits)
 STATS_DEFINE_COUNTER_STAT(cache_lru_read_misses)
 // Reader
 STATS_DEFINE_COUNTER_STAT(reader_attr_tile_cache_hits)
+STATS_DEFINE_COUNTER_STAT(reader_inflight_tile_bytes)
+STATS_DEFINE_COUNTER_STAT(reader_inflight_tile_bytes_peak)
 STATS_DEFINE_COUNTER_STAT(reader_num_attr_tiles_touched)
+STATS_DEFINE_COUNTER_STAT(reader_num_cells_filtered_by_condition)
 STATS_DEFINE_COUNTER_STAT(reader_num_fixed_cell_bytes_copied)
 STATS_DEFINE_COUNTER_STAT(reader_num_fixed_cell_bytes_read)
+STATS_DEFINE_COUNTER_STAT(reader_num_fixed_cell_bytes_viewed)
+STATS_DEFINE_COUNTER_STAT(reader_num_memory_budget_splits)
+STATS_DEFINE_COUNTER_STAT(reader_num_prefetched_partitions)
 STATS_DEFINE_COUNTER_STAT(reader_num_tile_bytes_read)
+STATS_DEFINE_COUNTER_STAT(reader_num_tile_pipeline_stalls)
+STATS_DEFINE_COUNTER_STAT(reader_num_tile_reads)
+STATS_DEFINE_COUNTER_STAT(reader_num_tiles_aggregated_from_metadata)
+STATS_DEFINE_COUNTER_STAT(reader_num_tiles_skipped_by_condition)
+STATS_DEFINE_COUNTER_STAT(reader_num_tiles_skipped_by_coords)
+STATS_DEFINE_COUNTER_STAT(reader_num_tiles_transformed)
 STATS_DEFINE_COUNTER_STAT(reader_num_var_cell_bytes_copied)
 STATS_DEFINE_COUNTER_STAT(reader_num_var_cell_bytes_read)
 // Writer
 STATS_DEFINE_COUNTER_STAT(writer_num_attr_tiles_written)
 STATS_DEFINE_COUNTER_STAT(writer_num_bytes_written)
 STATS_DEFINE_COUNTER_STAT(writer_num_input_bytes)
+STATS_DEFINE_COUNTER_STAT(writer_num_radix_sorts)
+STATS_DEFINE_COUNTER_STAT(writer_num_staged_batches)
+STATS_DEFINE_COUNTER_STAT(writer_num_staging_stalls)
+STATS_DEFINE_COUNTER_STAT(writer_num_tile_batches)
+STATS_DEFINE_COUNTER_STAT(writer_num_tile_pipeline_stalls)
+STATS_DEFINE_COUNTER_STAT(writer_tile_bytes)
+STATS_DEFINE_COUNTER_STAT(writer_tile_bytes_peak)
 // StorageManager
 STATS_DEFINE_COUNTER_STAT(sm_contexts_created)
 STATS_DEFINE_COUNTER_STAT(sm_query_submit_layout_col_major)
@@ -395,7 +447,10 @@ STATS_DEFINE_COUNTER_STAT(tileio_write_num_input_bytes)
 STATS_DEFINE_COUNTER_STAT(vfs_read_total_bytes)
 STATS_DEFINE_COUNTER_STAT(vfs_write_total_bytes)
 STATS_DEFINE_COUNTER_STAT(vfs_read_num_parallelized)
+STATS_DEFINE_COUNTER_STAT(vfs_posix_fd_cache_hits)
+STATS_DEFINE_COUNTER_STAT(vfs_posix_fd_cache_misses)
 STATS_DEFINE_COUNTER_STAT(vfs_posix_write_num_parallelized)
+STATS_DEFINE_COUNTER_STAT(vfs_posix_write_num_vectored)
 STATS_DEFINE_COUNTER_STAT(vfs_win32_write_num_parallelized)
 STATS_DEFINE_COUNTER_STAT(vfs_s3_num_parts_written)
 STATS_DEFINE_COUNTER_STAT(vfs_s3_write_num_parallelized)
@@ -408,16 +463,35 @@ STATS_INIT_COUNTER_STAT(cache_lru_read_hits)
 STATS_INIT_COUNTER_STAT(cache_lru_read_misses)
 // Reader
 STATS_INIT_COUNTER_STAT(reader_attr_tile_cache_hits)
+STATS_INIT_COUNTER_STAT(reader_inflight_tile_bytes)
+STATS_INIT_COUNTER_STAT(reader_inflight_tile_bytes_peak)
 STATS_INIT_COUNTER_STAT(reader_num_attr_tiles_touched)
+STATS_INIT_COUNTER_STAT(reader_num_cells_filtered_by_condition)
 STATS_INIT_COUNTER_STAT(reader_num_fixed_cell_bytes_copied)
 STATS_INIT_COUNTER_STAT(reader_num_fixed_cell_bytes_read)
+STATS_INIT_COUNTER_STAT(reader_num_fixed_cell_bytes_viewed)
+STATS_INIT_COUNTER_STAT(reader_num_memory_budget_splits)
+STATS_INIT_COUNTER_STAT(reader_num_prefetched_partitions)
 STATS_INIT_COUNTER_STAT(reader_num_tile_bytes_read)
+STATS_INIT_COUNTER_STAT(reader_num_tile_pipeline_stalls)
+STATS_INIT_COUNTER_STAT(reader_num_tile_reads)
+STATS_INIT_COUNTER_STAT(reader_num_tiles_aggregated_from_metadata)
+STATS_INIT_COUNTER_STAT(reader_num_tiles_skipped_by_condition)
+STATS_INIT_COUNTER_STAT(reader_num_tiles_skipped_by_coords)
+STATS_INIT_COUNTER_STAT(reader_num_tiles_transformed)
 STATS_INIT_COUNTER_STAT(reader_num_var_cell_bytes_copied)
 STATS_INIT_COUNTER_STAT(reader_num_var_cell_bytes_read)
 // Writer
 STATS_INIT_COUNTER_STAT(writer_num_attr_tiles_written)
 STATS_INIT_COUNTER_STAT(writer_num_bytes_written)
 STATS_INIT_COUNTER_STAT(writer_num_input_bytes)
+STATS_INIT_COUNTER_STAT(writer_num_radix_sorts)
+STATS_INIT_COUNTER_STAT(writer_num_staged_batches)
+STATS_INIT_COUNTER_STAT(writer_num_staging_stalls)
+STATS_INIT_COUNTER_STAT(writer_num_tile_batches)
+STATS_INIT_COUNTER_STAT(writer_num_tile_pipeline_stalls)
+STATS_INIT_COUNTER_STAT(writer_tile_bytes)
+STATS_INIT_COUNTER_STAT(writer_tile_bytes_peak)
 // StorageManager
 STATS_INIT_COUNTER_STAT(sm_contexts_created)
 STATS_INIT_COUNTER_STAT(sm_query_submit_layout_col_major)
@@ -435,7 +509,10 @@ STATS_INIT_COUNTER_STAT(tileio_write_num_input_bytes)
 STATS_INIT_COUNTER_STAT(vfs_read_total_bytes)
 STATS_INIT_COUNTER_STAT(vfs_write_total_bytes)
 STATS_INIT_COUNTER_STAT(vfs_read_num_parallelized)
+STATS_INIT_COUNTER_STAT(vfs_posix_fd_cache_hits)
+STATS_INIT_COUNTER_STAT(vfs_posix_fd_cache_misses)
 STATS_INIT_COUNTER_STAT(vfs_posix_write_num_parallelized)
+STATS_INIT_COUNTER_STAT(vfs_posix_write_num_vectored)
 STATS_INIT_COUNTER_STAT(vfs_win32_write_num_parallelized)
 STATS_INIT_COUNTER_STAT(vfs_s3_num_parts_written)
 STATS_INIT_COUNTER_STAT(vfs_s3_write_num_parallelized)
@@ -448,16 +525,35 @@ STATS_REPORT_COUNTER_STAT(cache_lru_read_hits)
 STATS_REPORT_COUNTER_STAT(cache_lru_read_misses)
 // Reader
 STATS_REPORT_COUNTER_STAT(reader_attr_tile_cache_hits)
+STATS_REPORT_COUNTER_STAT(reader_inflight_tile_bytes)
+STATS_REPORT_COUNTER_STAT(reader_inflight_tile_bytes_peak)
 STATS_REPORT_COUNTER_STAT(reader_num_attr_tiles_touched)
+STATS_REPORT_COUNTER_STAT(reader_num_cells_filtered_by_condition)
 STATS_REPORT_COUNTER_STAT(reader_num_fixed_cell_bytes_copied)
 STATS_REPORT_COUNTER_STAT(reader_num_fixed_cell_bytes_read)
+STATS_REPORT_COUNTER_STAT(reader_num_fixed_cell_bytes_viewed)
+STATS_REPORT_COUNTER_STAT(reader_num_memory_budget_splits)
+STATS_REPORT_COUNTER_STAT(reader_num_prefetched_partitions)
 STATS_REPORT_COUNTER_STAT(reader_num_tile_bytes_read)
+STATS_REPORT_COUNTER_STAT(reader_num_tile_pipeline_stalls)
+STATS_REPORT_COUNTER_STAT(reader_num_tile_reads)
+STATS_REPORT_COUNTER_STAT(reader_num_tiles_aggregated_from_metadata)
+STATS_REPORT_COUNTER_STAT(reader_num_tiles_skipped_by_condition)
+STATS_REPORT_COUNTER_STAT(reader_num_tiles_skipped_by_coords)
+STATS_REPORT_COUNTER_STAT(reader_num_tiles_transformed)
 STATS_REPORT_COUNTER_STAT(reader_num_var_cell_bytes_copied)
 STATS_REPORT_COUNTER_STAT(reader_num_var_cell_bytes_read)
 // Writer
 STATS_REPORT_COUNTER_STAT(writer_num_attr_tiles_written)
 STATS_REPORT_COUNTER_STAT(writer_num_bytes_written)
 STATS_REPORT_COUNTER_STAT(writer_num_input_bytes)
+STATS_REPORT_COUNTER_STAT(writer_num_radix_sorts)
+STATS_REPORT_COUNTER_STAT(writer_num_staged_batches)
+STATS_REPORT_COUNTER_STAT(writer_num_staging_stalls)
+STATS_REPORT_COUNTER_STAT(writer_num_tile_batches)
+STATS_REPORT_COUNTER_STAT(writer_num_tile_pipeline_stalls)
+STATS_REPORT_COUNTER_STAT(writer_tile_bytes)
+STATS_REPORT_COUNTER_STAT(writer_tile_bytes_peak)
 // StorageManager
 STATS_REPORT_COUNTER_STAT(sm_contexts_created)
 STATS_REPORT_COUNTER_STAT(sm_query_submit_layout_col_major)
@@ -475,7 +571,10 @@ STATS_REPORT_COUNTER_STAT(tileio_write_num_input_bytes)
 STATS_REPORT_COUNTER_STAT(vfs_read_total_bytes)
 STATS_REPORT_COUNTER_STAT(vfs_write_total_bytes)
 STATS_REPORT_COUNTER_STAT(vfs_read_num_parallelized)
+STATS_REPORT_COUNTER_STAT(vfs_posix_fd_cache_hits)
+STATS_REPORT_COUNTER_STAT(vfs_posix_fd_cache_misses)
 STATS_REPORT_COUNTER_STAT(vfs_posix_write_num_parallelized)
+STATS_REPORT_COUNTER_STAT(vfs_posix_write_num_vectored)
 STATS_REPORT_COUNTER_STAT(vfs_win32_write_num_parallelized)
 STATS_REPORT_COUNTER_STAT(vfs_s3_num_parts_written)
 STATS_REPORT_COUNTER_STAT(vfs_s3_write_num_parallelized)
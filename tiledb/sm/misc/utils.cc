@@ -435,6 +435,137 @@ inline bool coords_in_rect(
   return true;
 }
 
+/**
+ * Tests the coordinates along a single dimension against `[low, high]`,
+ * initializing (`first`) or AND-ing into the bitmap. A compile-time
+ * `DIM_NUM` (0 if only known at runtime) turns the strided loads into
+ * fixed shuffles, which makes the loop vectorizable.
+ */
+template <class T, unsigned DIM_NUM>
+inline void coords_in_range(
+    const T* coords,
+    uint64_t coords_num,
+    unsigned dim_num,
+    T low,
+    T high,
+    bool first,
+    uint8_t* bitmap) {
+  const unsigned stride = (DIM_NUM == 0) ? dim_num : DIM_NUM;
+  if (first) {
+    for (uint64_t i = 0; i < coords_num; ++i) {
+      auto c = coords[i * stride];
+      bitmap[i] = (uint8_t)((c >= low) & (c <= high));
+    }
+  } else {
+    for (uint64_t i = 0; i < coords_num; ++i) {
+      auto c = coords[i * stride];
+      bitmap[i] &= (uint8_t)((c >= low) & (c <= high));
+    }
+  }
+}
+
+template <class T, unsigned DIM_NUM>
+inline void coords_in_rect_dims(
+    const T* coords,
+    uint64_t coords_num,
+    const T* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap) {
+  for (unsigned d = 0; d < dim_num; ++d)
+    coords_in_range<T, DIM_NUM>(
+        coords + d,
+        coords_num,
+        dim_num,
+        rect[2 * d],
+        rect[2 * d + 1],
+        d == 0,
+        bitmap);
+}
+
+template <class T>
+inline void coords_in_rect_generic(
+    const T* coords,
+    uint64_t coords_num,
+    const T* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap) {
+  switch (dim_num) {
+    case 1:
+      coords_in_rect_dims<T, 1>(coords, coords_num, rect, dim_num, bitmap);
+      break;
+    case 2:
+      coords_in_rect_dims<T, 2>(coords, coords_num, rect, dim_num, bitmap);
+      break;
+    case 3:
+      coords_in_rect_dims<T, 3>(coords, coords_num, rect, dim_num, bitmap);
+      break;
+    default:
+      coords_in_rect_dims<T, 0>(coords, coords_num, rect, dim_num, bitmap);
+  }
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TILEDB_COORDS_IN_RECT_DISPATCH
+
+template <class T>
+__attribute__((target("avx2"))) void coords_in_rect_avx2(
+    const T* coords,
+    uint64_t coords_num,
+    const T* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap) {
+  coords_in_rect_generic<T>(coords, coords_num, rect, dim_num, bitmap);
+}
+
+template <class T>
+__attribute__((target("sse4.2"))) void coords_in_rect_sse42(
+    const T* coords,
+    uint64_t coords_num,
+    const T* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap) {
+  coords_in_rect_generic<T>(coords, coords_num, rect, dim_num, bitmap);
+}
+
+/** The instruction sets the `coords_in_rect` bitmap kernels can use. */
+enum class CoordsInRectISA { GENERIC, SSE42, AVX2 };
+
+/** Detects (once) the best instruction set supported by the CPU. */
+CoordsInRectISA coords_in_rect_isa() {
+  static const CoordsInRectISA isa = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+      return CoordsInRectISA::AVX2;
+    if (__builtin_cpu_supports("sse4.2"))
+      return CoordsInRectISA::SSE42;
+    return CoordsInRectISA::GENERIC;
+  }();
+  return isa;
+}
+#endif
+
+template <class T>
+void coords_in_rect(
+    const T* coords,
+    uint64_t coords_num,
+    const T* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap) {
+#ifdef TILEDB_COORDS_IN_RECT_DISPATCH
+  switch (coords_in_rect_isa()) {
+    case CoordsInRectISA::AVX2:
+      coords_in_rect_avx2<T>(coords, coords_num, rect, dim_num, bitmap);
+      return;
+    case CoordsInRectISA::SSE42:
+      coords_in_rect_sse42<T>(coords, coords_num, rect, dim_num, bitmap);
+      return;
+    default:
+      break;
+  }
+#endif
+  coords_in_rect_generic<T>(coords, coords_num, rect, dim_num, bitmap);
+}
+
 template <class T>
 void expand_mbr(T* mbr, const T* coords, unsigned int dim_num) {
   for (unsigned int i = 0; i < dim_num; ++i) {
@@ -567,6 +698,67 @@ template bool coords_in_rect<uint32_t>(
 template bool coords_in_rect<uint64_t>(
     const uint64_t* cell, const uint64_t* subarray, unsigned int dim_num);
 
+template void coords_in_rect<int>(
+    const int* coords,
+    uint64_t coords_num,
+    const int* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<int64_t>(
+    const int64_t* coords,
+    uint64_t coords_num,
+    const int64_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<float>(
+    const float* coords,
+    uint64_t coords_num,
+    const float* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<double>(
+    const double* coords,
+    uint64_t coords_num,
+    const double* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<int8_t>(
+    const int8_t* coords,
+    uint64_t coords_num,
+    const int8_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<uint8_t>(
+    const uint8_t* coords,
+    uint64_t coords_num,
+    const uint8_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<int16_t>(
+    const int16_t* coords,
+    uint64_t coords_num,
+    const int16_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<uint16_t>(
+    const uint16_t* coords,
+    uint64_t coords_num,
+    const uint16_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<uint32_t>(
+    const uint32_t* coords,
+    uint64_t coords_num,
+    const uint32_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+template void coords_in_rect<uint64_t>(
+    const uint64_t* coords,
+    uint64_t coords_num,
+    const uint64_t* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+
 template void expand_mbr<int>(
     int* mbr, const int* coords, unsigned int dim_num);
 template void expand_mbr<int64_t>(
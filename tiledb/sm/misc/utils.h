@@ -144,6 +144,32 @@ namespace geometry {
 template <class T>
 bool coords_in_rect(const T* coords, const T* rect, unsigned int dim_num);
 
+/**
+ * Checks which of the input coordinates are inside `rect`, producing a
+ * bitmap with one byte per cell. The check is performed one dimension at
+ * a time, AND-ing the result of each dimension into the bitmap, which
+ * allows the compiler to vectorize it. On x86 the function dispatches at
+ * runtime to an AVX2 or SSE4.2 version, if supported by the CPU.
+ *
+ * @tparam T The type of the coordinates and hyper-rectangle.
+ * @param coords The zipped coordinates to be checked.
+ * @param coords_num The number of coordinate tuples in `coords`.
+ * @param rect The hyper-rectangle to be checked, expressed as [low, high]
+ *     pairs along each dimension.
+ * @param dim_num The number of dimensions for the coordinates and
+ *     hyper-rectangle.
+ * @param bitmap The output bitmap, which must be able to hold `coords_num`
+ *     bytes. The i-th byte is set to 1 if the i-th coordinates are inside
+ *     `rect` and 0 otherwise.
+ */
+template <class T>
+void coords_in_rect(
+    const T* coords,
+    uint64_t coords_num,
+    const T* rect,
+    unsigned int dim_num,
+    uint8_t* bitmap);
+
 /**
  * Expands the input MBR so that it encompasses the input coordinates.
  *
@@ -0,0 +1,451 @@
+/**
+ * @file   aggregate.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class Aggregate.
+ */
+
+#include "tiledb/sm/query/aggregate.h"
+#include "tiledb/sm/misc/logger.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace tiledb {
+namespace sm {
+
+/** The type of the sum of values of type `T`. */
+template <class T>
+struct SumType {
+  typedef int64_t type;
+};
+
+template <>
+struct SumType<uint8_t> {
+  typedef uint64_t type;
+};
+
+template <>
+struct SumType<uint16_t> {
+  typedef uint64_t type;
+};
+
+template <>
+struct SumType<uint32_t> {
+  typedef uint64_t type;
+};
+
+template <>
+struct SumType<uint64_t> {
+  typedef uint64_t type;
+};
+
+template <>
+struct SumType<float> {
+  typedef double type;
+};
+
+template <>
+struct SumType<double> {
+  typedef double type;
+};
+
+/** Returns `true` if the input value is a floating point NaN. */
+template <class T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type is_nan(
+    T value) {
+  return std::isnan(value);
+}
+
+/** Integer values are never NaN. */
+template <class T>
+typename std::enable_if<!std::is_floating_point<T>::value, bool>::type is_nan(
+    T) {
+  return false;
+}
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+Aggregate::Aggregate()
+    : Aggregate(Datatype::INT32) {
+}
+
+Aggregate::Aggregate(Datatype type)
+    : count_(0)
+    , nan_count_(0)
+    , ops_(0)
+    , sum_float_(0)
+    , sum_int_(0)
+    , sum_uint_(0)
+    , type_(type) {
+}
+
+Aggregate::~Aggregate() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+void Aggregate::add_op(AggregateOp op) {
+  ops_ |= (uint8_t)(1 << (uint8_t)op);
+}
+
+void Aggregate::add_count(uint64_t cell_num) {
+  count_ += cell_num;
+}
+
+void Aggregate::clear() {
+  count_ = 0;
+  nan_count_ = 0;
+  max_.clear();
+  min_.clear();
+  sum_float_ = 0;
+  sum_int_ = 0;
+  sum_uint_ = 0;
+}
+
+uint64_t Aggregate::count() const {
+  return count_;
+}
+
+Status Aggregate::get(AggregateOp op, void* value) const {
+  if (value == nullptr)
+    return LOG_STATUS(
+        Status::QueryError("Cannot get aggregate; Invalid result pointer"));
+
+  switch (op) {
+    case AggregateOp::AGGREGATE_COUNT:
+      std::memcpy(value, &count_, sizeof(count_));
+      return Status::Ok();
+    case AggregateOp::AGGREGATE_SUM:
+      if (datatype_is_real(type_))
+        std::memcpy(value, &sum_float_, sizeof(sum_float_));
+      else if (
+          type_ == Datatype::UINT8 || type_ == Datatype::UINT16 ||
+          type_ == Datatype::UINT32 || type_ == Datatype::UINT64)
+        std::memcpy(value, &sum_uint_, sizeof(sum_uint_));
+      else
+        std::memcpy(value, &sum_int_, sizeof(sum_int_));
+      return Status::Ok();
+    case AggregateOp::AGGREGATE_MIN:
+    case AggregateOp::AGGREGATE_MAX:
+    case AggregateOp::AGGREGATE_MEAN:
+      break;
+  }
+
+  // The rest of the operators are undefined on an empty set of cells
+  if (count_ == 0)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot get aggregate; The query has no results"));
+
+  if (op == AggregateOp::AGGREGATE_MEAN) {
+    auto mean = sum_as_double() / count_;
+    std::memcpy(value, &mean, sizeof(mean));
+  } else {
+    const auto& v = (op == AggregateOp::AGGREGATE_MIN) ? min_ : max_;
+    if (!v.empty()) {
+      std::memcpy(value, &v[0], v.size());
+    } else if (type_ == Datatype::FLOAT32) {
+      // All the aggregated values are NaN
+      auto nan = std::numeric_limits<float>::quiet_NaN();
+      std::memcpy(value, &nan, sizeof(nan));
+    } else {
+      assert(type_ == Datatype::FLOAT64);
+      auto nan = std::numeric_limits<double>::quiet_NaN();
+      std::memcpy(value, &nan, sizeof(nan));
+    }
+  }
+
+  return Status::Ok();
+}
+
+bool Aggregate::has_op(AggregateOp op) const {
+  return (ops_ & (uint8_t)(1 << (uint8_t)op)) != 0;
+}
+
+void Aggregate::merge(const Aggregate& aggregate) {
+  assert(aggregate.type_ == type_);
+  count_ += aggregate.count_;
+  nan_count_ += aggregate.nan_count_;
+  sum_float_ += aggregate.sum_float_;
+  sum_int_ += aggregate.sum_int_;
+  sum_uint_ += aggregate.sum_uint_;
+
+  switch (type_) {
+    case Datatype::INT8:
+      return merge_min_max<int8_t>(aggregate);
+    case Datatype::UINT8:
+      return merge_min_max<uint8_t>(aggregate);
+    case Datatype::INT16:
+      return merge_min_max<int16_t>(aggregate);
+    case Datatype::UINT16:
+      return merge_min_max<uint16_t>(aggregate);
+    case Datatype::INT32:
+      return merge_min_max<int>(aggregate);
+    case Datatype::UINT32:
+      return merge_min_max<unsigned>(aggregate);
+    case Datatype::INT64:
+      return merge_min_max<int64_t>(aggregate);
+    case Datatype::UINT64:
+      return merge_min_max<uint64_t>(aggregate);
+    case Datatype::FLOAT32:
+      return merge_min_max<float>(aggregate);
+    case Datatype::FLOAT64:
+      return merge_min_max<double>(aggregate);
+    default:
+      return;
+  }
+}
+
+void Aggregate::merge_summary(
+    uint64_t count,
+    uint64_t nan_count,
+    const void* min,
+    const void* max,
+    const void* sum) {
+  if (count == 0)
+    return;
+
+  count_ += count;
+  nan_count_ += nan_count;
+  if (datatype_is_real(type_)) {
+    double s;
+    std::memcpy(&s, sum, sizeof(s));
+    add_sum(s);
+  } else if (
+      type_ == Datatype::UINT8 || type_ == Datatype::UINT16 ||
+      type_ == Datatype::UINT32 || type_ == Datatype::UINT64) {
+    uint64_t s;
+    std::memcpy(&s, sum, sizeof(s));
+    add_sum(s);
+  } else {
+    int64_t s;
+    std::memcpy(&s, sum, sizeof(s));
+    add_sum(s);
+  }
+
+  switch (type_) {
+    case Datatype::INT8:
+      return update_min_max<int8_t>(*(const int8_t*)min, *(const int8_t*)max);
+    case Datatype::UINT8:
+      return update_min_max<uint8_t>(
+          *(const uint8_t*)min, *(const uint8_t*)max);
+    case Datatype::INT16:
+      return update_min_max<int16_t>(
+          *(const int16_t*)min, *(const int16_t*)max);
+    case Datatype::UINT16:
+      return update_min_max<uint16_t>(
+          *(const uint16_t*)min, *(const uint16_t*)max);
+    case Datatype::INT32:
+      return update_min_max<int>(*(const int*)min, *(const int*)max);
+    case Datatype::UINT32:
+      return update_min_max<unsigned>(
+          *(const unsigned*)min, *(const unsigned*)max);
+    case Datatype::INT64:
+      return update_min_max<int64_t>(
+          *(const int64_t*)min, *(const int64_t*)max);
+    case Datatype::UINT64:
+      return update_min_max<uint64_t>(
+          *(const uint64_t*)min, *(const uint64_t*)max);
+    case Datatype::FLOAT32:
+      return update_min_max<float>(*(const float*)min, *(const float*)max);
+    case Datatype::FLOAT64:
+      return update_min_max<double>(*(const double*)min, *(const double*)max);
+    default:
+      assert(false);
+  }
+}
+
+uint64_t Aggregate::nan_count() const {
+  return nan_count_;
+}
+
+bool Aggregate::needs_values() const {
+  return (ops_ & ~(uint8_t)(1 << (uint8_t)AggregateOp::AGGREGATE_COUNT)) != 0;
+}
+
+bool Aggregate::supports(Datatype type) {
+  return datatype_is_integer(type) || datatype_is_real(type);
+}
+
+Datatype Aggregate::type() const {
+  return type_;
+}
+
+void Aggregate::update(const void* values, uint64_t start, uint64_t end) {
+  switch (type_) {
+    case Datatype::INT8:
+      return update<int8_t>((const int8_t*)values, nullptr, start, end);
+    case Datatype::UINT8:
+      return update<uint8_t>((const uint8_t*)values, nullptr, start, end);
+    case Datatype::INT16:
+      return update<int16_t>((const int16_t*)values, nullptr, start, end);
+    case Datatype::UINT16:
+      return update<uint16_t>((const uint16_t*)values, nullptr, start, end);
+    case Datatype::INT32:
+      return update<int>((const int*)values, nullptr, start, end);
+    case Datatype::UINT32:
+      return update<unsigned>((const unsigned*)values, nullptr, start, end);
+    case Datatype::INT64:
+      return update<int64_t>((const int64_t*)values, nullptr, start, end);
+    case Datatype::UINT64:
+      return update<uint64_t>((const uint64_t*)values, nullptr, start, end);
+    case Datatype::FLOAT32:
+      return update<float>((const float*)values, nullptr, start, end);
+    case Datatype::FLOAT64:
+      return update<double>((const double*)values, nullptr, start, end);
+    default:
+      assert(false);
+  }
+}
+
+void Aggregate::update(
+    const void* values, const uint8_t* bitmap, uint64_t cell_num) {
+  if (cell_num == 0)
+    return;
+
+  auto end = cell_num - 1;
+  switch (type_) {
+    case Datatype::INT8:
+      return update<int8_t>((const int8_t*)values, bitmap, 0, end);
+    case Datatype::UINT8:
+      return update<uint8_t>((const uint8_t*)values, bitmap, 0, end);
+    case Datatype::INT16:
+      return update<int16_t>((const int16_t*)values, bitmap, 0, end);
+    case Datatype::UINT16:
+      return update<uint16_t>((const uint16_t*)values, bitmap, 0, end);
+    case Datatype::INT32:
+      return update<int>((const int*)values, bitmap, 0, end);
+    case Datatype::UINT32:
+      return update<unsigned>((const unsigned*)values, bitmap, 0, end);
+    case Datatype::INT64:
+      return update<int64_t>((const int64_t*)values, bitmap, 0, end);
+    case Datatype::UINT64:
+      return update<uint64_t>((const uint64_t*)values, bitmap, 0, end);
+    case Datatype::FLOAT32:
+      return update<float>((const float*)values, bitmap, 0, end);
+    case Datatype::FLOAT64:
+      return update<double>((const double*)values, bitmap, 0, end);
+    default:
+      assert(false);
+  }
+}
+
+/* ****************************** */
+/*          PRIVATE METHODS       */
+/* ****************************** */
+
+void Aggregate::add_sum(double sum) {
+  sum_float_ += sum;
+}
+
+void Aggregate::add_sum(int64_t sum) {
+  sum_int_ += sum;
+}
+
+void Aggregate::add_sum(uint64_t sum) {
+  sum_uint_ += sum;
+}
+
+double Aggregate::sum_as_double() const {
+  if (datatype_is_real(type_))
+    return sum_float_;
+  if (type_ == Datatype::UINT8 || type_ == Datatype::UINT16 ||
+      type_ == Datatype::UINT32 || type_ == Datatype::UINT64)
+    return (double)sum_uint_;
+  return (double)sum_int_;
+}
+
+template <class T>
+void Aggregate::update(
+    const T* values, const uint8_t* bitmap, uint64_t start, uint64_t end) {
+  typename SumType<T>::type sum = 0;
+  auto min = std::numeric_limits<T>::max();
+  auto max = std::numeric_limits<T>::lowest();
+  uint64_t count = 0, nan_count = 0;
+
+  // NaNs are counted and summed, but excluded from the minimum and maximum
+  for (auto i = start; i <= end; ++i) {
+    if (bitmap != nullptr && !bitmap[i])
+      continue;
+    ++count;
+    sum += values[i];
+    if (is_nan(values[i])) {
+      ++nan_count;
+      continue;
+    }
+    min = std::min(min, values[i]);
+    max = std::max(max, values[i]);
+  }
+
+  if (count == 0)
+    return;
+
+  count_ += count;
+  nan_count_ += nan_count;
+  add_sum(sum);
+  if (nan_count < count)
+    update_min_max<T>(min, max);
+}
+
+template <class T>
+void Aggregate::update_min_max(T min, T max) {
+  // A NaN summary comes from a set of values that are all NaN
+  if (is_nan(min) || is_nan(max))
+    return;
+
+  if (min_.empty()) {
+    min_.resize(sizeof(T));
+    max_.resize(sizeof(T));
+    std::memcpy(&min_[0], &min, sizeof(T));
+    std::memcpy(&max_[0], &max, sizeof(T));
+    return;
+  }
+
+  auto cur_min = (T*)&min_[0];
+  auto cur_max = (T*)&max_[0];
+  *cur_min = std::min(*cur_min, min);
+  *cur_max = std::max(*cur_max, max);
+}
+
+template <class T>
+void Aggregate::merge_min_max(const Aggregate& aggregate) {
+  if (aggregate.min_.empty())
+    return;
+  update_min_max<T>(
+      *(const T*)&aggregate.min_[0], *(const T*)&aggregate.max_[0]);
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,256 @@
+/**
+ * @file   aggregate.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class Aggregate.
+ */
+
+#ifndef TILEDB_AGGREGATE_H
+#define TILEDB_AGGREGATE_H
+
+#include "tiledb/sm/enums/aggregate_op.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/status.h"
+
+#include <cinttypes>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The running aggregates (count, sum, min and max) of the values of an
+ * attribute, from which the results of all the aggregate operators are
+ * computed. Partial aggregates (e.g., one per tile) are combined with
+ * `merge`.
+ *
+ * The sum is kept as `int64_t` for signed integer types, as `uint64_t`
+ * for unsigned integer types and as `double` for real types. NaN values
+ * are counted and summed but skipped by the minimum and maximum, which
+ * are NaN only if all the values are NaN.
+ */
+class Aggregate {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  Aggregate();
+
+  /**
+   * Constructor.
+   *
+   * @param type The type of the aggregated values.
+   */
+  explicit Aggregate(Datatype type);
+
+  /** Destructor. */
+  ~Aggregate();
+
+  /** Copy constructor. */
+  Aggregate(const Aggregate& aggregate) = default;
+
+  /** Move constructor. */
+  Aggregate(Aggregate&& aggregate) = default;
+
+  /** Copy-assign operator. */
+  Aggregate& operator=(const Aggregate& aggregate) = default;
+
+  /** Move-assign operator. */
+  Aggregate& operator=(Aggregate&& aggregate) = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Records that the result of the input operator will be requested. */
+  void add_op(AggregateOp op);
+
+  /**
+   * Adds cells to the count without aggregating their values. Applicable
+   * only if the values are not needed (see `needs_values`).
+   */
+  void add_count(uint64_t cell_num);
+
+  /** Clears the aggregated values, keeping the requested operators. */
+  void clear();
+
+  /** Returns the number of aggregated cells. */
+  uint64_t count() const;
+
+  /**
+   * Retrieves the result of an aggregate operator. The result is a
+   * `uint64_t` for `AGGREGATE_COUNT`, a `double` for `AGGREGATE_MEAN`,
+   * a value of the sum type for `AGGREGATE_SUM`, and a value of the
+   * aggregated type for `AGGREGATE_MIN` and `AGGREGATE_MAX`.
+   *
+   * @param op The aggregate operator.
+   * @param value The result to be retrieved.
+   * @return Status
+   */
+  Status get(AggregateOp op, void* value) const;
+
+  /** Returns `true` if the result of the input operator was requested. */
+  bool has_op(AggregateOp op) const;
+
+  /** Adds the aggregates of the input object to this object. */
+  void merge(const Aggregate& aggregate);
+
+  /**
+   * Adds a summary of a set of values to the aggregates, without visiting
+   * the values. This is used to aggregate tiles from the statistics stored
+   * in the fragment metadata.
+   *
+   * @param count The number of values.
+   * @param nan_count The number of NaN values.
+   * @param min The minimum value, of the aggregated type.
+   * @param max The maximum value, of the aggregated type.
+   * @param sum The sum of the values, of the sum type.
+   */
+  void merge_summary(
+      uint64_t count,
+      uint64_t nan_count,
+      const void* min,
+      const void* max,
+      const void* sum);
+
+  /** Returns the number of aggregated NaN values (always 0 for integers). */
+  uint64_t nan_count() const;
+
+  /**
+   * Returns `true` if any of the requested operators needs the cell values,
+   * i.e., if anything other than the count was requested.
+   */
+  bool needs_values() const;
+
+  /**
+   * Returns `true` if values of the input type can be aggregated, i.e.,
+   * if it is an integer or a real type.
+   */
+  static bool supports(Datatype type);
+
+  /** Returns the type of the aggregated values. */
+  Datatype type() const;
+
+  /**
+   * Aggregates the values in the range of cells `[start, end]`.
+   *
+   * @param values The cell values, of the aggregated type.
+   * @param start The position of the first cell.
+   * @param end The position of the last cell.
+   */
+  void update(const void* values, uint64_t start, uint64_t end);
+
+  /**
+   * Aggregates the values of the cells that are set in the input bitmap.
+   *
+   * @param values The cell values, of the aggregated type.
+   * @param bitmap One byte per cell, set to 1 if the cell is aggregated.
+   * @param cell_num The number of cells.
+   */
+  void update(const void* values, const uint8_t* bitmap, uint64_t cell_num);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The number of aggregated cells. */
+  uint64_t count_;
+
+  /** The maximum value (empty if no non-NaN value has been aggregated). */
+  std::vector<uint8_t> max_;
+
+  /** The minimum value (empty if no non-NaN value has been aggregated). */
+  std::vector<uint8_t> min_;
+
+  /** The number of aggregated NaN values. */
+  uint64_t nan_count_;
+
+  /** A bitmask of the requested operators. */
+  uint8_t ops_;
+
+  /** The sum, for real types. */
+  double sum_float_;
+
+  /** The sum, for signed integer types. */
+  int64_t sum_int_;
+
+  /** The sum, for unsigned integer types. */
+  uint64_t sum_uint_;
+
+  /** The type of the aggregated values. */
+  Datatype type_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Adds to the sum. */
+  void add_sum(double sum);
+
+  /** Adds to the sum. */
+  void add_sum(int64_t sum);
+
+  /** Adds to the sum. */
+  void add_sum(uint64_t sum);
+
+  /** Returns the sum as a `double`. */
+  double sum_as_double() const;
+
+  /**
+   * Aggregates the values of the cells in `[start, end]` that are set in
+   * the input bitmap.
+   *
+   * @tparam T The type of the values.
+   * @param values The cell values.
+   * @param bitmap One byte per cell, or `nullptr` to aggregate all cells.
+   * @param start The position of the first cell.
+   * @param end The position of the last cell.
+   */
+  template <class T>
+  void update(
+      const T* values, const uint8_t* bitmap, uint64_t start, uint64_t end);
+
+  /**
+   * Updates the minimum and maximum with the input values. NaN inputs
+   * are ignored.
+   */
+  template <class T>
+  void update_min_max(T min, T max);
+
+  /** Adds the minimum and maximum of the input aggregate to this one. */
+  template <class T>
+  void merge_min_max(const Aggregate& aggregate);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_AGGREGATE_H
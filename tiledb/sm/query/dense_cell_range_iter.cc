@@ -132,6 +132,11 @@ const T* DenseCellRangeIter<T>::tile_coords() const {
   return &tile_coords_[0];
 }
 
+template <class T>
+const std::vector<T>& DenseCellRangeIter<T>::subarray() const {
+  return subarray_;
+}
+
 template <class T>
 void DenseCellRangeIter<T>::operator++() {
   // If at the end, do nothing
@@ -107,6 +107,9 @@ class DenseCellRangeIter {
   /** Returns the current tile coordinates. */
   const T* tile_coords() const;
 
+  /** Returns the subarray the iterator focuses on. */
+  const std::vector<T>& subarray() const;
+
   /** Advances the iterator to the next range. */
   void operator++();
 
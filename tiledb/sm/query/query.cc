@@ -35,6 +35,7 @@
 #include "tiledb/sm/misc/logger.h"
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
@@ -81,6 +82,29 @@ Query::~Query() = default;
 /*               API              */
 /* ****************************** */
 
+Status Query::add_aggregate(const std::string& attribute, AggregateOp op) {
+  if (type_ == QueryType::WRITE)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot add aggregate; Operation only applicable to read queries"));
+
+  RETURN_NOT_OK(reader_.add_aggregate(attribute, op));
+  status_ = QueryStatus::UNINITIALIZED;
+
+  return Status::Ok();
+}
+
+Status Query::add_range(
+    unsigned dim_idx, const void* start, const void* end) {
+  if (type_ == QueryType::WRITE)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot add range; Operation only applicable to read queries"));
+
+  RETURN_NOT_OK(reader_.add_range(dim_idx, start, end));
+  status_ = QueryStatus::UNINITIALIZED;
+
+  return Status::Ok();
+}
+
 const ArraySchema* Query::array_schema() const {
   if (type_ == QueryType::WRITE)
     return writer_.array_schema();
@@ -115,6 +139,15 @@ std::vector<URI> Query::fragment_uris() const {
   return reader_.fragment_uris();
 }
 
+Status Query::get_aggregate(
+    const std::string& attribute, AggregateOp op, void* value) const {
+  if (type_ == QueryType::WRITE)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot get aggregate; Operation only applicable to read queries"));
+
+  return reader_.get_aggregate(attribute, op, value);
+}
+
 Status Query::get_buffer(
     const char* attribute, void** buffer, uint64_t** buffer_size) const {
   // Normalize attribute
@@ -171,6 +204,19 @@ Status Query::get_buffer(
       normalized, buffer_off, buffer_off_size, buffer_val, buffer_val_size);
 }
 
+Status Query::get_result_views(
+    const char* attribute, const std::vector<ResultView>** views) const {
+  if (type_ == QueryType::WRITE)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot get result views; Operation only applicable to read queries"));
+
+  // Normalize attribute
+  std::string normalized;
+  RETURN_NOT_OK(ArraySchema::attribute_name_normalized(attribute, &normalized));
+
+  return reader_.get_result_views(normalized, views);
+}
+
 bool Query::has_results() const {
   if (status_ == QueryStatus::UNINITIALIZED || type_ == QueryType::WRITE)
     return false;
@@ -227,33 +273,46 @@ Status Query::cancel() {
 Status Query::check_var_attr_offsets(
     const uint64_t* buffer_off,
     const uint64_t* buffer_off_size,
-    const uint64_t* buffer_val_size) {
+    const uint64_t* buffer_val_size) const {
   if (buffer_off == nullptr || buffer_off_size == nullptr ||
       buffer_val_size == nullptr)
     return LOG_STATUS(Status::QueryError("Cannot use null offset buffers."));
 
-  auto num_offsets = *buffer_off_size / sizeof(uint64_t);
+  uint64_t offset_size = writer_.var_offsets_bitsize() / 8;
+  auto offsets = (const unsigned char*)buffer_off;
+  auto read_offset = [offsets, offset_size](uint64_t i) {
+    if (offset_size == sizeof(uint32_t)) {
+      uint32_t offset;
+      std::memcpy(&offset, offsets + i * offset_size, offset_size);
+      return (uint64_t)offset;
+    }
+    uint64_t offset;
+    std::memcpy(&offset, offsets + i * offset_size, offset_size);
+    return offset;
+  };
+
+  auto num_offsets = *buffer_off_size / offset_size;
   if (num_offsets == 0)
     return Status::Ok();
 
-  uint64_t prev_offset = buffer_off[0];
-  if (prev_offset >= *buffer_val_size)
-    return LOG_STATUS(Status::QueryError(
-        "Invalid offsets; offset " + std::to_string(prev_offset) +
-        " specified for buffer of size " + std::to_string(*buffer_val_size)));
-
-  for (uint64_t i = 1; i < num_offsets; i++) {
-    if (buffer_off[i] <= prev_offset)
+  // The extra element, if any, is the size of the data buffer
+  auto extra_element = writer_.var_offsets_extra_element();
+  uint64_t prev_offset = 0;
+  for (uint64_t i = 0; i < num_offsets; i++) {
+    auto offset = read_offset(i);
+    if (i > 0 && offset <= prev_offset)
       return LOG_STATUS(
           Status::QueryError("Invalid offsets; offsets must be given in "
                              "strictly ascending order."));
 
-    if (buffer_off[i] >= *buffer_val_size)
+    bool is_extra = extra_element && i == num_offsets - 1;
+    if (offset > *buffer_val_size ||
+        (offset == *buffer_val_size && !is_extra))
       return LOG_STATUS(Status::QueryError(
-          "Invalid offsets; offset " + std::to_string(buffer_off[i]) +
+          "Invalid offsets; offset " + std::to_string(offset) +
           " specified for buffer of size " + std::to_string(*buffer_val_size)));
 
-    prev_offset = buffer_off[i];
+    prev_offset = offset;
   }
 
   return Status::Ok();
@@ -313,6 +372,15 @@ Status Query::set_buffer(
       attribute, buffer_off, buffer_off_size, buffer_val, buffer_val_size);
 }
 
+Status Query::set_condition(const QueryCondition& condition) {
+  if (type_ == QueryType::WRITE)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot set query condition; Operation only applicable to read "
+        "queries"));
+
+  return reader_.set_condition(condition);
+}
+
 Status Query::set_layout(Layout layout) {
   layout_ = layout;
   if (type_ == QueryType::WRITE)
@@ -320,6 +388,14 @@ Status Query::set_layout(Layout layout) {
   return reader_.set_layout(layout);
 }
 
+Status Query::set_result_views(bool enabled) {
+  if (type_ == QueryType::WRITE)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot set result views; Operation only applicable to read queries"));
+
+  return reader_.set_result_views(enabled);
+}
+
 Status Query::set_subarray(const void* subarray) {
   RETURN_NOT_OK(check_subarray_bounds(subarray));
   if (type_ == QueryType::WRITE) {
@@ -333,6 +409,12 @@ Status Query::set_subarray(const void* subarray) {
   return Status::Ok();
 }
 
+Status Query::set_var_offsets_format(uint32_t bitsize, bool extra_element) {
+  if (type_ == QueryType::WRITE)
+    return writer_.set_var_offsets_format(bitsize, extra_element);
+  return reader_.set_var_offsets_format(bitsize, extra_element);
+}
+
 Status Query::submit() {  // Do nothing if the query is completed or failed
   RETURN_NOT_OK(init());
   return storage_manager_->query_submit(this);
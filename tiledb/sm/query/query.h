@@ -40,6 +40,7 @@
 #include "tiledb/sm/misc/status.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/query/dense_cell_range_iter.h"
+#include "tiledb/sm/query/query_condition.h"
 #include "tiledb/sm/query/reader.h"
 #include "tiledb/sm/query/writer.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
@@ -80,6 +81,30 @@ class Query {
   /*                 API               */
   /* ********************************* */
 
+  /**
+   * Adds an aggregate on an attribute, for a read query on a sparse array.
+   * The query then reduces its results into the aggregate instead of
+   * copying them to buffers.
+   *
+   * @param attribute The attribute.
+   * @param op The aggregate operator.
+   * @return Status
+   */
+  Status add_aggregate(const std::string& attribute, AggregateOp op);
+
+  /**
+   * Adds a range along a dimension of a sparse array, for a read query.
+   * The query results are the cells in the cross product of the ranges of
+   * all dimensions. The dimensions without any added range are constrained
+   * only by the subarray.
+   *
+   * @param dim_idx The index of the dimension.
+   * @param start The range start, of the domain type.
+   * @param end The range end (inclusive), of the domain type.
+   * @return Status
+   */
+  Status add_range(unsigned dim_idx, const void* start, const void* end);
+
   /** Returns the array schema. */
   const ArraySchema* array_schema() const;
 
@@ -170,16 +195,19 @@ class Query {
 
   /**
    * Check the validity of the provided buffer offsets for a variable attribute.
+   * The offsets are given in the format of the write query (see
+   * `sm.var_offsets.bitsize` and `sm.var_offsets.extra_element`), so the
+   * extra element may be equal to the size of the data buffer.
    *
    * @param buffer_off Offset buffer
    * @param buffer_off_size Pointer to size of offset buffer
    * @param buffer_val_size Pointer to size of data buffer
    * @return Status
    */
-  static Status check_var_attr_offsets(
+  Status check_var_attr_offsets(
       const uint64_t* buffer_off,
       const uint64_t* buffer_off_size,
-      const uint64_t* buffer_val_size);
+      const uint64_t* buffer_val_size) const;
 
   /**
    * Finalizes the query, flushing all internal state. Applicable only to global
@@ -193,6 +221,17 @@ class Query {
   /** Returns a vector with the fragment URIs. */
   std::vector<URI> fragment_uris() const;
 
+  /**
+   * Retrieves the result of an aggregate, after a read query completes.
+   *
+   * @param attribute The attribute.
+   * @param op The aggregate operator.
+   * @param value The result to be retrieved.
+   * @return Status
+   */
+  Status get_aggregate(
+      const std::string& attribute, AggregateOp op, void* value) const;
+
   /**
    * Retrieves the buffer of a fixed-sized attribute.
    *
@@ -223,6 +262,19 @@ class Query {
       void** buffer_val,
       uint64_t** buffer_val_size) const;
 
+  /**
+   * Retrieves the result views of a fixed-sized attribute for the last
+   * submission of a read query with result views enabled. The views are
+   * valid until the next submission, unless their handles are kept.
+   *
+   * @param attribute The attribute.
+   * @param views The views to be retrieved. It is `nullptr` if there are no
+   *     views for the attribute.
+   * @return Status
+   */
+  Status get_result_views(
+      const char* attribute, const std::vector<ResultView>** views) const;
+
   /**
    * Returns `true` if the query has results. Applicable only to read
    * queries (it returns `false` for write queries).
@@ -285,6 +337,16 @@ class Query {
       void* buffer_val,
       uint64_t* buffer_val_size);
 
+  /**
+   * Sets the query condition, i.e., a predicate on the attribute values
+   * that the cells of the results must satisfy. This is applicable only to
+   * reads on sparse arrays.
+   *
+   * @param condition The query condition.
+   * @return Status
+   */
+  Status set_condition(const QueryCondition& condition);
+
   /**
    * Sets the cell layout of the query. The function will return an error
    * if the queried array is a key-value store (because it has its default
@@ -292,6 +354,19 @@ class Query {
    */
   Status set_layout(Layout layout);
 
+  /**
+   * Enables or disables result views for a read query. With result views,
+   * the results of the fixed-sized attributes are not copied into the
+   * buffers; instead, they are retrieved as read-only views into memory
+   * owned by TileDB with `get_result_views`. The buffer sizes are still
+   * set to the sizes of the results, and bound the results of each
+   * submission.
+   *
+   * @param enabled `true` to enable result views.
+   * @return Status
+   */
+  Status set_result_views(bool enabled);
+
   /**
    * Sets the query subarray. If it is null, then the subarray will be set to
    * the entire domain.
@@ -301,6 +376,19 @@ class Query {
    */
   Status set_subarray(const void* subarray);
 
+  /**
+   * Sets the format of the offsets of the var-sized attribute buffers,
+   * overriding `sm.var_offsets.bitsize` and `sm.var_offsets.extra_element`.
+   * Internal queries use it to work with 64-bit offsets regardless of
+   * the configuration.
+   *
+   * @param bitsize The size of an offset in bits (`32` or `64`).
+   * @param extra_element If `true`, the offsets end with an extra element
+   *     holding the total size of the values.
+   * @return Status
+   */
+  Status set_var_offsets_format(uint32_t bitsize, bool extra_element);
+
   /** Submits the query to the storage manager. */
   Status submit();
 
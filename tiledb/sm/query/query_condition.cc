@@ -0,0 +1,367 @@
+/**
+ * @file   query_condition.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class QueryCondition.
+ */
+
+#include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/constants.h"
+#include "tiledb/sm/misc/logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+QueryCondition::QueryCondition()
+    : combination_op_(QueryConditionCombinationOp::AND)
+    , op_(QueryConditionOp::EQ) {
+}
+
+QueryCondition::~QueryCondition() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status QueryCondition::apply(
+    const ArraySchema* array_schema,
+    const std::unordered_map<std::string, std::pair<Tile, Tile>>& attr_tiles,
+    uint64_t cell_num,
+    std::vector<uint8_t>* bitmap) const {
+  // Empty condition - all cells qualify
+  if (empty()) {
+    bitmap->assign(cell_num, 1);
+    return Status::Ok();
+  }
+
+  // Combination - evaluate the children and combine their results
+  if (attribute_name_.empty()) {
+    RETURN_NOT_OK(
+        children_[0]->apply(array_schema, attr_tiles, cell_num, bitmap));
+    std::vector<uint8_t> child_bitmap;
+    for (size_t i = 1; i < children_.size(); ++i) {
+      RETURN_NOT_OK(children_[i]->apply(
+          array_schema, attr_tiles, cell_num, &child_bitmap));
+      auto& b = *bitmap;
+      if (combination_op_ == QueryConditionCombinationOp::AND) {
+        for (uint64_t c = 0; c < cell_num; ++c)
+          b[c] &= child_bitmap[c];
+      } else {
+        for (uint64_t c = 0; c < cell_num; ++c)
+          b[c] |= child_bitmap[c];
+      }
+    }
+    return Status::Ok();
+  }
+
+  // Comparison
+  auto it = attr_tiles.find(attribute_name_);
+  if (it == attr_tiles.end() || it->second.first.cell_num() < cell_num)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot apply query condition; Missing tile for attribute " +
+        attribute_name_));
+  bitmap->resize(cell_num);
+  auto values = it->second.first.data();
+  auto b = bitmap->data();
+  switch (array_schema->type(attribute_name_)) {
+    case Datatype::INT8:
+      apply_comparison<int8_t>((const int8_t*)values, cell_num, b);
+      break;
+    case Datatype::UINT8:
+    case Datatype::STRING_ASCII:
+    case Datatype::STRING_UTF8:
+      apply_comparison<uint8_t>((const uint8_t*)values, cell_num, b);
+      break;
+    case Datatype::INT16:
+      apply_comparison<int16_t>((const int16_t*)values, cell_num, b);
+      break;
+    case Datatype::UINT16:
+    case Datatype::STRING_UTF16:
+    case Datatype::STRING_UCS2:
+      apply_comparison<uint16_t>((const uint16_t*)values, cell_num, b);
+      break;
+    case Datatype::INT32:
+      apply_comparison<int>((const int*)values, cell_num, b);
+      break;
+    case Datatype::UINT32:
+    case Datatype::STRING_UTF32:
+    case Datatype::STRING_UCS4:
+      apply_comparison<uint32_t>((const uint32_t*)values, cell_num, b);
+      break;
+    case Datatype::INT64:
+      apply_comparison<int64_t>((const int64_t*)values, cell_num, b);
+      break;
+    case Datatype::UINT64:
+      apply_comparison<uint64_t>((const uint64_t*)values, cell_num, b);
+      break;
+    case Datatype::FLOAT32:
+      apply_comparison<float>((const float*)values, cell_num, b);
+      break;
+    case Datatype::FLOAT64:
+      apply_comparison<double>((const double*)values, cell_num, b);
+      break;
+    case Datatype::CHAR:
+      apply_comparison<char>((const char*)values, cell_num, b);
+      break;
+    default:
+      return LOG_STATUS(Status::QueryError(
+          "Cannot apply query condition; Unsupported type for attribute " +
+          attribute_name_));
+  }
+
+  return Status::Ok();
+}
+
+Status QueryCondition::check(const ArraySchema* array_schema) const {
+  if (empty())
+    return Status::Ok();
+
+  // Combination
+  if (attribute_name_.empty()) {
+    for (const auto& child : children_)
+      RETURN_NOT_OK(child->check(array_schema));
+    return Status::Ok();
+  }
+
+  // Comparison
+  if (attribute_name_ == constants::coords ||
+      array_schema->attribute(attribute_name_) == nullptr)
+    return LOG_STATUS(Status::QueryError(
+        "Invalid query condition; Unknown attribute " + attribute_name_));
+  if (array_schema->var_size(attribute_name_) ||
+      array_schema->cell_val_num(attribute_name_) != 1)
+    return LOG_STATUS(Status::QueryError(
+        "Invalid query condition; Attribute " + attribute_name_ +
+        " must have a single fixed-sized value per cell"));
+  auto type = array_schema->type(attribute_name_);
+  if (type == Datatype::ANY)
+    return LOG_STATUS(Status::QueryError(
+        "Invalid query condition; Unsupported type for attribute " +
+        attribute_name_));
+  if (value_.size() != datatype_size(type))
+    return LOG_STATUS(Status::QueryError(
+        "Invalid query condition; The value size does not match the type "
+        "size of attribute " +
+        attribute_name_));
+
+  return Status::Ok();
+}
+
+Status QueryCondition::combine(
+    const QueryCondition& rhs,
+    QueryConditionCombinationOp combination_op,
+    QueryCondition* combined) const {
+  if (empty() || rhs.empty())
+    return LOG_STATUS(Status::QueryError(
+        "Cannot combine query conditions; The conditions must not be empty"));
+
+  // Flatten chains of the same operator, so that the evaluation does not
+  // recurse deeply
+  QueryCondition result;
+  result.combination_op_ = combination_op;
+  for (const auto* c : {this, &rhs}) {
+    if (c->attribute_name_.empty() && c->combination_op_ == combination_op)
+      result.children_.insert(
+          result.children_.end(), c->children_.begin(), c->children_.end());
+    else
+      result.children_.emplace_back(new QueryCondition(*c));
+  }
+  *combined = std::move(result);
+
+  return Status::Ok();
+}
+
+bool QueryCondition::empty() const {
+  return attribute_name_.empty() && children_.empty();
+}
+
+std::vector<std::string> QueryCondition::field_names() const {
+  std::vector<std::string> field_names;
+  this->field_names(&field_names);
+  return field_names;
+}
+
+Status QueryCondition::init(
+    const std::string& attribute_name,
+    const void* value,
+    uint64_t value_size,
+    QueryConditionOp op) {
+  if (attribute_name.empty())
+    return LOG_STATUS(Status::QueryError(
+        "Cannot initialize query condition; The attribute name is empty"));
+  if (value == nullptr || value_size == 0)
+    return LOG_STATUS(Status::QueryError(
+        "Cannot initialize query condition; The value is empty"));
+
+  attribute_name_ = attribute_name;
+  children_.clear();
+  op_ = op;
+  value_.resize(value_size);
+  std::memcpy(value_.data(), value, value_size);
+
+  return Status::Ok();
+}
+
+bool QueryCondition::may_match(
+    const ArraySchema* array_schema,
+    const FragmentMetadata* meta,
+    uint64_t tile_idx) const {
+  if (empty())
+    return true;
+
+  // Combination
+  if (attribute_name_.empty()) {
+    auto is_and = (combination_op_ == QueryConditionCombinationOp::AND);
+    for (const auto& child : children_) {
+      if (child->may_match(array_schema, meta, tile_idx) != is_and)
+        return !is_and;
+    }
+    return is_and;
+  }
+
+  // Comparison
+  auto min = meta->tile_min(attribute_name_, tile_idx);
+  auto max = meta->tile_max(attribute_name_, tile_idx);
+  if (min == nullptr || max == nullptr)
+    return true;
+  auto has_nan = meta->tile_nan_num(attribute_name_, tile_idx) > 0;
+  switch (array_schema->type(attribute_name_)) {
+    case Datatype::INT8:
+      return may_match_comparison<int8_t>(min, max, has_nan);
+    case Datatype::UINT8:
+      return may_match_comparison<uint8_t>(min, max, has_nan);
+    case Datatype::INT16:
+      return may_match_comparison<int16_t>(min, max, has_nan);
+    case Datatype::UINT16:
+      return may_match_comparison<uint16_t>(min, max, has_nan);
+    case Datatype::INT32:
+      return may_match_comparison<int>(min, max, has_nan);
+    case Datatype::UINT32:
+      return may_match_comparison<uint32_t>(min, max, has_nan);
+    case Datatype::INT64:
+      return may_match_comparison<int64_t>(min, max, has_nan);
+    case Datatype::UINT64:
+      return may_match_comparison<uint64_t>(min, max, has_nan);
+    case Datatype::FLOAT32:
+      return may_match_comparison<float>(min, max, has_nan);
+    case Datatype::FLOAT64:
+      return may_match_comparison<double>(min, max, has_nan);
+    default:
+      return true;
+  }
+}
+
+/* ****************************** */
+/*          PRIVATE METHODS       */
+/* ****************************** */
+
+template <class T>
+void QueryCondition::apply_comparison(
+    const T* values, uint64_t cell_num, uint8_t* bitmap) const {
+  T v;
+  std::memcpy(&v, value_.data(), sizeof(T));
+  switch (op_) {
+    case QueryConditionOp::LT:
+      for (uint64_t c = 0; c < cell_num; ++c)
+        bitmap[c] = values[c] < v;
+      break;
+    case QueryConditionOp::LE:
+      for (uint64_t c = 0; c < cell_num; ++c)
+        bitmap[c] = values[c] <= v;
+      break;
+    case QueryConditionOp::GT:
+      for (uint64_t c = 0; c < cell_num; ++c)
+        bitmap[c] = values[c] > v;
+      break;
+    case QueryConditionOp::GE:
+      for (uint64_t c = 0; c < cell_num; ++c)
+        bitmap[c] = values[c] >= v;
+      break;
+    case QueryConditionOp::EQ:
+      for (uint64_t c = 0; c < cell_num; ++c)
+        bitmap[c] = values[c] == v;
+      break;
+    case QueryConditionOp::NE:
+      for (uint64_t c = 0; c < cell_num; ++c)
+        bitmap[c] = values[c] != v;
+      break;
+  }
+}
+
+template <class T>
+bool QueryCondition::may_match_comparison(
+    const void* min, const void* max, bool has_nan) const {
+  T v, tile_min, tile_max;
+  std::memcpy(&v, value_.data(), sizeof(T));
+  std::memcpy(&tile_min, min, sizeof(T));
+  std::memcpy(&tile_max, max, sizeof(T));
+  switch (op_) {
+    case QueryConditionOp::LT:
+      return tile_min < v;
+    case QueryConditionOp::LE:
+      return tile_min <= v;
+    case QueryConditionOp::GT:
+      return tile_max > v;
+    case QueryConditionOp::GE:
+      return tile_max >= v;
+    case QueryConditionOp::EQ:
+      return tile_min <= v && v <= tile_max;
+    case QueryConditionOp::NE:
+      // A NaN is different from every value, but it is excluded from the
+      // minimum and maximum
+      return has_nan || !(tile_min == v && tile_max == v);
+  }
+
+  return true;
+}
+
+void QueryCondition::field_names(std::vector<std::string>* field_names) const {
+  if (!attribute_name_.empty()) {
+    if (std::find(
+            field_names->begin(), field_names->end(), attribute_name_) ==
+        field_names->end())
+      field_names->push_back(attribute_name_);
+    return;
+  }
+
+  for (const auto& child : children_)
+    child->field_names(field_names);
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,219 @@
+/**
+ * @file   query_condition.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class QueryCondition.
+ */
+
+#ifndef TILEDB_QUERY_CONDITION_H
+#define TILEDB_QUERY_CONDITION_H
+
+#include "tiledb/sm/enums/query_condition_combination_op.h"
+#include "tiledb/sm/enums/query_condition_op.h"
+#include "tiledb/sm/misc/status.h"
+#include "tiledb/sm/tile/tile.h"
+
+#include <cinttypes>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+class ArraySchema;
+class FragmentMetadata;
+
+/**
+ * A predicate on the attribute values of a read query. It is either a
+ * single comparison of a fixed-sized attribute against a value (e.g.,
+ * `a1 > 5`), or a combination of other query conditions with a logical
+ * operator. Cells that do not satisfy the condition are excluded from the
+ * results.
+ */
+class QueryCondition {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. Creates an empty condition, which all cells satisfy. */
+  QueryCondition();
+
+  /** Destructor. */
+  ~QueryCondition();
+
+  /** Copy constructor. */
+  QueryCondition(const QueryCondition& condition) = default;
+
+  /** Move constructor. */
+  QueryCondition(QueryCondition&& condition) = default;
+
+  /** Copy-assign operator. */
+  QueryCondition& operator=(const QueryCondition& condition) = default;
+
+  /** Move-assign operator. */
+  QueryCondition& operator=(QueryCondition&& condition) = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Evaluates the condition on all the cells of a tile.
+   *
+   * @param array_schema The array schema.
+   * @param attr_tiles The tiles of the attributes the condition refers to,
+   *     mapped from the attribute names. The tiles must be unfiltered.
+   * @param cell_num The number of cells in the tiles.
+   * @param bitmap The result, with one byte per cell set to 1 if the cell
+   *     satisfies the condition and 0 otherwise.
+   * @return Status
+   */
+  Status apply(
+      const ArraySchema* array_schema,
+      const std::unordered_map<std::string, std::pair<Tile, Tile>>&
+          attr_tiles,
+      uint64_t cell_num,
+      std::vector<uint8_t>* bitmap) const;
+
+  /**
+   * Checks that the condition is valid for the input array schema, i.e.,
+   * that it refers to existing fixed-sized attributes with a single value
+   * per cell, and that the comparison values have the attribute type size.
+   *
+   * @param array_schema The array schema.
+   * @return Status
+   */
+  Status check(const ArraySchema* array_schema) const;
+
+  /**
+   * Combines this condition with another one.
+   *
+   * @param rhs The condition to combine with.
+   * @param combination_op The logical operator.
+   * @param combined The combined condition.
+   * @return Status
+   */
+  Status combine(
+      const QueryCondition& rhs,
+      QueryConditionCombinationOp combination_op,
+      QueryCondition* combined) const;
+
+  /** Returns `true` if the condition is empty. */
+  bool empty() const;
+
+  /** Returns the names of the attributes the condition refers to. */
+  std::vector<std::string> field_names() const;
+
+  /**
+   * Initializes the condition as a single comparison.
+   *
+   * @param attribute_name The attribute to compare.
+   * @param value The value to compare against.
+   * @param value_size The size of `value` in bytes.
+   * @param op The comparison operator.
+   * @return Status
+   */
+  Status init(
+      const std::string& attribute_name,
+      const void* value,
+      uint64_t value_size,
+      QueryConditionOp op);
+
+  /**
+   * Checks whether any cell of a tile may satisfy the condition, based on
+   * the per-tile statistics of the fragment metadata. It returns `false`
+   * only if no cell of the tile can satisfy the condition, i.e., if it
+   * returns `true` the cells must still be evaluated with `apply`.
+   *
+   * @param array_schema The array schema.
+   * @param meta The metadata of the fragment the tile belongs to.
+   * @param tile_idx The index of the tile in the fragment.
+   * @return `false` if the tile can be skipped.
+   */
+  bool may_match(
+      const ArraySchema* array_schema,
+      const FragmentMetadata* meta,
+      uint64_t tile_idx) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The attribute of a comparison (empty for a combination). */
+  std::string attribute_name_;
+
+  /**
+   * The conditions combined with `combination_op_` (empty for a
+   * comparison). They are immutable, thus shared among the copies.
+   */
+  std::vector<std::shared_ptr<const QueryCondition>> children_;
+
+  /** The logical operator of a combination. */
+  QueryConditionCombinationOp combination_op_;
+
+  /** The operator of a comparison. */
+  QueryConditionOp op_;
+
+  /** The value of a comparison. */
+  std::vector<uint8_t> value_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Evaluates a comparison of type `T` on `cell_num` values,
+   * writing the result into `bitmap`.
+   */
+  template <class T>
+  void apply_comparison(
+      const T* values, uint64_t cell_num, uint8_t* bitmap) const;
+
+  /**
+   * Checks whether any value in `[min, max]`, or a NaN value if `has_nan`
+   * is `true`, may satisfy a comparison of type `T`.
+   */
+  template <class T>
+  bool may_match_comparison(
+      const void* min, const void* max, bool has_nan) const;
+
+  /**
+   * Collects the names of the attributes the condition refers to in
+   * `field_names`, skipping duplicates.
+   */
+  void field_names(std::vector<std::string>* field_names) const;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_QUERY_CONDITION_H
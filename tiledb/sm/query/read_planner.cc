@@ -0,0 +1,110 @@
+/**
+ * @file   read_planner.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class ReadPlanner.
+ */
+
+#include "tiledb/sm/query/read_planner.h"
+#include "tiledb/sm/misc/constants.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+ReadPlanner::ReadPlanner()
+    : max_gap_(constants::read_coalesce_gap)
+    , max_size_(constants::read_coalesce_max_size) {
+}
+
+ReadPlanner::ReadPlanner(uint64_t max_gap, uint64_t max_size)
+    : max_gap_(max_gap)
+    , max_size_(max_size) {
+}
+
+ReadPlanner::~ReadPlanner() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+uint64_t ReadPlanner::max_gap() const {
+  return max_gap_;
+}
+
+uint64_t ReadPlanner::max_size() const {
+  return max_size_;
+}
+
+std::vector<CoalescedRead> ReadPlanner::plan(
+    const std::vector<ByteRange>& ranges) const {
+  std::vector<CoalescedRead> reads;
+  if (ranges.empty())
+    return reads;
+
+  // Sort the ranges on their offsets
+  std::vector<size_t> idx(ranges.size());
+  std::iota(idx.begin(), idx.end(), 0);
+  std::stable_sort(idx.begin(), idx.end(), [&ranges](size_t a, size_t b) {
+    return ranges[a].offset_ < ranges[b].offset_;
+  });
+
+  // Merge each range into the last read, if it is close enough and the
+  // merged read does not get too large
+  for (auto i : idx) {
+    const auto& range = ranges[i];
+    auto range_end = range.offset_ + range.size_;
+    if (!reads.empty()) {
+      auto& read = reads.back();
+      auto read_end = read.offset_ + read.size_;
+      auto merged_end = std::max(read_end, range_end);
+      if (range.offset_ <= read_end + max_gap_ &&
+          merged_end - read.offset_ <= max_size_) {
+        read.size_ = merged_end - read.offset_;
+        read.ranges_.push_back(i);
+        continue;
+      }
+    }
+
+    reads.emplace_back();
+    reads.back().offset_ = range.offset_;
+    reads.back().size_ = range.size_;
+    reads.back().ranges_.push_back(i);
+  }
+
+  return reads;
+}
+
+}  // namespace sm
+}  // namespace tiledb
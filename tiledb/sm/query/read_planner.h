@@ -0,0 +1,134 @@
+/**
+ * @file   read_planner.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ReadPlanner.
+ */
+
+#ifndef TILEDB_READ_PLANNER_H
+#define TILEDB_READ_PLANNER_H
+
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/** A range of bytes in a file. */
+struct ByteRange {
+  /** The offset of the range in the file. */
+  uint64_t offset_;
+  /** The size of the range in bytes. */
+  uint64_t size_;
+
+  /** Constructor. */
+  ByteRange(uint64_t offset, uint64_t size)
+      : offset_(offset)
+      , size_(size) {
+  }
+};
+
+/** A single read request from a file that covers one or more byte ranges. */
+struct CoalescedRead {
+  /** The offset of the read in the file. */
+  uint64_t offset_;
+  /** The number of bytes to read. */
+  uint64_t size_;
+  /**
+   * The indexes of the byte ranges covered by the read (in the input of
+   * `ReadPlanner::plan`), in ascending order of their offsets.
+   */
+  std::vector<size_t> ranges_;
+};
+
+/**
+ * Plans the reads of a set of byte ranges from the same file, by merging
+ * ranges that are contiguous or separated by small gaps into a single
+ * read request. This trades a few wasted bytes for far fewer requests,
+ * which is important on object stores (e.g., one ranged GET per merged
+ * range) and also saves system calls on local filesystems.
+ */
+class ReadPlanner {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. It uses the default gap and maximum read size. */
+  ReadPlanner();
+
+  /**
+   * Constructor.
+   *
+   * @param max_gap The maximum number of bytes between two byte ranges that
+   *     may be read (and discarded) in order to merge them.
+   * @param max_size The maximum size of a merged read. A single byte range
+   *     larger than this is still read with a single request.
+   */
+  ReadPlanner(uint64_t max_gap, uint64_t max_size);
+
+  /** Destructor. */
+  ~ReadPlanner();
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the maximum gap between two merged byte ranges. */
+  uint64_t max_gap() const;
+
+  /** Returns the maximum size of a merged read. */
+  uint64_t max_size() const;
+
+  /**
+   * Merges the input byte ranges into read requests.
+   *
+   * @param ranges The byte ranges to read, all from the same file. They
+   *     need not be sorted.
+   * @return The read requests, in ascending order of their offsets. Each
+   *     input range is covered by exactly one read.
+   */
+  std::vector<CoalescedRead> plan(const std::vector<ByteRange>& ranges) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The maximum gap between two merged byte ranges. */
+  uint64_t max_gap_;
+
+  /** The maximum size of a merged read. */
+  uint64_t max_size_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_READ_PLANNER_H
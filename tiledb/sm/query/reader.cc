@@ -32,6 +32,7 @@
 
 #include "tiledb/sm/query/reader.h"
 #include "tiledb/sm/misc/comparators.h"
+#include "tiledb/sm/misc/copy_kernels.h"
 #include "tiledb/sm/misc/logger.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/stats.h"
@@ -40,7 +41,12 @@
 #include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/sm/tile/tile_io.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <limits>
+#include <queue>
+#include <unordered_set>
 
 namespace tiledb {
 namespace sm {
@@ -76,6 +82,31 @@ inline IterT skip_invalid_elements(IterT it, const IterT& end) {
   }
   return it;
 }
+
+/**
+ * Returns the index of the first of the input sorted, disjoint
+ * `[low, high]` ranges whose high bound is not smaller than the input
+ * value, or `range_num` if there is none.
+ *
+ * @tparam T The range type.
+ * @param ranges The ranges, stored as contiguous `[low, high]` pairs.
+ * @param range_num The number of ranges.
+ * @param value The value to search for.
+ * @return The range index.
+ */
+template <class T>
+inline uint64_t lower_bound_range(
+    const T* ranges, uint64_t range_num, T value) {
+  uint64_t low = 0, high = range_num;
+  while (low < high) {
+    auto mid = low + (high - low) / 2;
+    if (ranges[2 * mid + 1] < value)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  return low;
+}
 }  // namespace
 
 /* ****************************** */
@@ -87,10 +118,19 @@ Reader::Reader() {
   array_schema_ = nullptr;
   storage_manager_ = nullptr;
   layout_ = Layout::ROW_MAJOR;
+  read_inflight_size_ = constants::read_inflight_size;
+  read_prefetch_partitions_ = constants::read_prefetch_partitions;
+  read_prefetch_memory_budget_ = constants::read_prefetch_memory_budget;
+  memory_budget_ = constants::memory_budget;
+  memory_budget_var_ = constants::memory_budget_var;
   read_state_.cur_subarray_partition_ = nullptr;
   read_state_.subarray_ = nullptr;
   read_state_.initialized_ = false;
   read_state_.overflowed_ = false;
+  copy_state_.copied_cell_num_ = 0;
+  result_views_enabled_ = false;
+  var_offsets_bitsize_ = constants::var_offsets_bitsize;
+  var_offsets_extra_element_ = constants::var_offsets_extra_element;
 }
 
 Reader::~Reader() {
@@ -101,6 +141,93 @@ Reader::~Reader() {
 /*               API              */
 /* ****************************** */
 
+Status Reader::add_aggregate(const std::string& attribute, AggregateOp op) {
+  if (array_schema_->dense())
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot add aggregate; Aggregates are supported only for sparse "
+        "arrays"));
+
+  // Check the attribute
+  auto is_coords = (attribute == constants::coords);
+  if (!is_coords && array_schema_->attribute(attribute) == nullptr)
+    return LOG_STATUS(Status::ReaderError(
+        std::string("Cannot add aggregate; Invalid attribute '") + attribute +
+        "'"));
+  auto type = array_schema_->type(attribute);
+  if (op != AggregateOp::AGGREGATE_COUNT &&
+      (is_coords || array_schema_->var_size(attribute) ||
+       array_schema_->cell_val_num(attribute) != 1 ||
+       !Aggregate::supports(type)))
+    return LOG_STATUS(Status::ReaderError(
+        std::string("Cannot add aggregate; Attribute '") + attribute +
+        "' must be numeric, fixed-sized and have a single value per cell"));
+
+  // Reset the read state, so that the new aggregate is taken into account
+  // when the query is initialized again
+  RETURN_NOT_OK(reset_read_state());
+
+  auto it = aggregates_.find(attribute);
+  if (it == aggregates_.end()) {
+    it = aggregates_.emplace(attribute, Aggregate(type)).first;
+    if (std::find(attributes_.begin(), attributes_.end(), attribute) ==
+        attributes_.end())
+      attributes_.push_back(attribute);
+  }
+  it->second.add_op(op);
+
+  return Status::Ok();
+}
+
+Status Reader::add_range(
+    unsigned dim_idx, const void* start, const void* end) {
+  if (array_schema_->dense())
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot add range; Ranges are supported only for sparse arrays"));
+  if (dim_idx >= array_schema_->dim_num())
+    return LOG_STATUS(
+        Status::ReaderError("Cannot add range; Invalid dimension index"));
+  if (start == nullptr || end == nullptr)
+    return LOG_STATUS(
+        Status::ReaderError("Cannot add range; Invalid range bounds"));
+
+  auto coords_type = array_schema_->coords_type();
+  switch (coords_type) {
+    case Datatype::INT8:
+      return add_range<int8_t>(
+          dim_idx, (const int8_t*)start, (const int8_t*)end);
+    case Datatype::UINT8:
+      return add_range<uint8_t>(
+          dim_idx, (const uint8_t*)start, (const uint8_t*)end);
+    case Datatype::INT16:
+      return add_range<int16_t>(
+          dim_idx, (const int16_t*)start, (const int16_t*)end);
+    case Datatype::UINT16:
+      return add_range<uint16_t>(
+          dim_idx, (const uint16_t*)start, (const uint16_t*)end);
+    case Datatype::INT32:
+      return add_range<int>(dim_idx, (const int*)start, (const int*)end);
+    case Datatype::UINT32:
+      return add_range<unsigned>(
+          dim_idx, (const unsigned*)start, (const unsigned*)end);
+    case Datatype::INT64:
+      return add_range<int64_t>(
+          dim_idx, (const int64_t*)start, (const int64_t*)end);
+    case Datatype::UINT64:
+      return add_range<uint64_t>(
+          dim_idx, (const uint64_t*)start, (const uint64_t*)end);
+    case Datatype::FLOAT32:
+      return add_range<float>(dim_idx, (const float*)start, (const float*)end);
+    case Datatype::FLOAT64:
+      return add_range<double>(
+          dim_idx, (const double*)start, (const double*)end);
+    default:
+      return LOG_STATUS(
+          Status::ReaderError("Cannot add range; Unsupported domain type"));
+  }
+
+  return Status::Ok();
+}
+
 const ArraySchema* Reader::array_schema() const {
   return array_schema_;
 }
@@ -118,7 +245,8 @@ AttributeBuffer Reader::buffer(const std::string& attribute) const {
 
 bool Reader::incomplete() const {
   return read_state_.overflowed_ ||
-         read_state_.cur_subarray_partition_ != nullptr;
+         read_state_.cur_subarray_partition_ != nullptr ||
+         !prefetched_partitions_.empty();
 }
 
 unsigned Reader::fragment_num() const {
@@ -133,6 +261,38 @@ std::vector<URI> Reader::fragment_uris() const {
   return uris;
 }
 
+Status Reader::get_aggregate(
+    const std::string& attribute, AggregateOp op, void* value) const {
+  auto it = aggregates_.find(attribute);
+  if (it == aggregates_.end() || !it->second.has_op(op))
+    return LOG_STATUS(Status::ReaderError(
+        std::string("Cannot get aggregate; No such aggregate on attribute '") +
+        attribute + "'"));
+
+  return it->second.get(op, value);
+}
+
+Status Reader::get_result_views(
+    const std::string& attribute,
+    const std::vector<ResultView>** views) const {
+  if (!result_views_enabled_)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot get result views; Result views are not enabled"));
+  if (attr_buffers_.find(attribute) == attr_buffers_.end())
+    return LOG_STATUS(Status::ReaderError(
+        std::string("Cannot get result views; No buffer set for attribute '") +
+        attribute + "'"));
+  if (array_schema_->var_size(attribute))
+    return LOG_STATUS(Status::ReaderError(
+        std::string("Cannot get result views; Attribute '") + attribute +
+        "' is var-sized"));
+
+  auto it = result_views_.find(attribute);
+  *views = (it == result_views_.end()) ? nullptr : &it->second;
+
+  return Status::Ok();
+}
+
 Status Reader::get_buffer(
     const std::string& attribute, void** buffer, uint64_t** buffer_size) const {
   auto it = attr_buffers_.find(attribute);
@@ -177,20 +337,56 @@ Status Reader::init() {
   if (array_schema_ == nullptr)
     return LOG_STATUS(
         Status::ReaderError("Cannot initialize query; Array metadata not set"));
-  if (attr_buffers_.empty())
+  if (attr_buffers_.empty() && aggregates_.empty())
     return LOG_STATUS(
         Status::ReaderError("Cannot initialize query; Buffers not set"));
+  if (!attr_buffers_.empty() && !aggregates_.empty())
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot initialize query; Aggregate queries do not accept buffers"));
   if (attributes_.empty())
     return LOG_STATUS(
         Status::ReaderError("Cannot initialize query; Attributes not set"));
+  // The dense read paths compute cell positions, which are undefined
+  // under the Hilbert cell order
+  if (array_schema_->dense() &&
+      array_schema_->cell_order() == Layout::HILBERT)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot initialize query; The Hilbert cell order is applicable only "
+        "to sparse arrays"));
 
   if (read_state_.subarray_ == nullptr)
     RETURN_NOT_OK(set_subarray(nullptr));
+  RETURN_NOT_OK(set_subarray_to_ranges());
+
+  // Get configuration parameters
+  auto sm_params = storage_manager_->config().sm_params();
+  read_inflight_size_ = sm_params.read_inflight_size_;
+  read_prefetch_partitions_ = sm_params.read_prefetch_partitions_;
+  read_prefetch_memory_budget_ = sm_params.read_prefetch_memory_budget_;
+  memory_budget_ = sm_params.memory_budget_;
+  memory_budget_var_ = sm_params.memory_budget_var_;
+  read_planner_ = ReadPlanner(
+      sm_params.read_coalesce_gap_, sm_params.read_coalesce_max_size_);
 
   optimize_layout_for_1D();
 
-  if (!fragment_metadata_.empty())
-    RETURN_NOT_OK(init_read_state());
+  if (!fragment_metadata_.empty()) {
+    if (aggregates_.empty()) {
+      RETURN_NOT_OK(init_read_state());
+    } else {
+      // An aggregate query processes the whole subarray at once
+      auto subarray_size = 2 * array_schema_->coords_size();
+      read_state_.cur_subarray_partition_ = std::malloc(subarray_size);
+      if (read_state_.cur_subarray_partition_ == nullptr)
+        return LOG_STATUS(Status::ReaderError(
+            "Cannot initialize query; Memory allocation failed"));
+      std::memcpy(
+          read_state_.cur_subarray_partition_,
+          read_state_.subarray_,
+          subarray_size);
+      read_state_.initialized_ = true;
+    }
+  }
 
   return Status::Ok();
 }
@@ -208,121 +404,41 @@ Layout Reader::layout() const {
 Status Reader::next_subarray_partition() {
   STATS_FUNC_IN(reader_next_subarray_partition);
 
-  auto domain = array_schema_->domain();
   read_state_.unsplittable_ = false;
 
   // Handle case of overflow - the current partition must be split
   if (read_state_.overflowed_) {
-    void *subarray_1 = nullptr, *subarray_2 = nullptr;
-    Status st = domain->split_subarray(
-        read_state_.cur_subarray_partition_, layout_, &subarray_1, &subarray_2);
-    if (subarray_1 != nullptr && subarray_2 != nullptr) {
-      read_state_.subarray_partitions_.push_front(subarray_2);
-      read_state_.subarray_partitions_.push_front(subarray_1);
-    } else {  // Unsplittable partition
-      read_state_.unsplittable_ = true;
-      return Status::Ok();
+    auto st = read_state_.partitioner_.split_current(
+        &read_state_.unsplittable_);
+    if (!st.ok()) {
+      clear_read_state();
+      return st;
     }
+    if (read_state_.unsplittable_)
+      return Status::Ok();
   }
 
-  if (read_state_.subarray_partitions_.empty()) {
+  if (read_state_.partitioner_.done()) {
     std::free(read_state_.cur_subarray_partition_);
     read_state_.cur_subarray_partition_ = nullptr;
     return Status::Ok();
   }
 
-  // Prepare buffer sizes map
-  std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>
-      buffer_sizes_map;
-  for (const auto& it : attr_buffers_) {
-    buffer_sizes_map[it.first] = std::pair<uint64_t, uint64_t>(
-        it.second.original_buffer_size_, it.second.original_buffer_var_size_);
-  }
-
-  // Loop until a new partition whose result fit in the buffers is found
-  std::unordered_map<std::string, std::pair<double, double>> est_buffer_sizes;
+  // Get the next partition whose result fits in the buffers
+  assert(read_state_.cur_subarray_partition_ != nullptr);
   bool found = false;
-  void* next_partition = nullptr;
-  do {
-    // Pop next partition
-    next_partition = read_state_.subarray_partitions_.front();
-    read_state_.subarray_partitions_.pop_front();
-
-    // Get estimated buffer sizes
-    for (const auto& attr_it : buffer_sizes_map)
-      est_buffer_sizes[attr_it.first] = std::pair<double, double>(0, 0);
-    auto st = storage_manager_->array_compute_est_read_buffer_sizes(
-        array_schema_, fragment_metadata_, next_partition, &est_buffer_sizes);
-
-    if (!st.ok()) {
-      std::free(next_partition);
-      clear_read_state();
-      return st;
-    }
-
-    // Handle case of no results
-    auto no_results = true;
-    for (auto& item : est_buffer_sizes) {
-      if (item.second.first != 0) {
-        no_results = false;
-        break;
-      }
-    }
-    if (no_results) {
-      std::free(next_partition);
-      next_partition = nullptr;
-      continue;
-    }
-
-    // Handle case of split
-    auto must_split = false;
-    for (auto& item : est_buffer_sizes) {
-      auto buffer_size = buffer_sizes_map.find(item.first)->second.first;
-      auto buffer_var_size = buffer_sizes_map.find(item.first)->second.second;
-      auto var_size = array_schema_->var_size(item.first);
-      if (uint64_t(round(item.second.first)) > buffer_size ||
-          (var_size && uint64_t(round(item.second.second)) > buffer_var_size)) {
-        must_split = true;
-        break;
-      }
-    }
-    if (must_split) {
-      void *subarray_1 = nullptr, *subarray_2 = nullptr;
-      st = domain->split_subarray(
-          next_partition, layout_, &subarray_1, &subarray_2);
-      if (!st.ok()) {
-        std::free(next_partition);
-        clear_read_state();
-        return st;
-      }
-
-      // Not splittable, return the original subarray as result
-      if (subarray_1 == nullptr || subarray_2 == nullptr) {
-        found = true;
-        read_state_.unsplittable_ = true;
-      } else {
-        read_state_.subarray_partitions_.push_front(subarray_2);
-        read_state_.subarray_partitions_.push_front(subarray_1);
-      }
-    } else {
-      found = true;
-    }
-  } while (!found && !read_state_.subarray_partitions_.empty());
+  auto st = read_state_.partitioner_.next(
+      read_state_.cur_subarray_partition_, &found, &read_state_.unsplittable_);
+  if (!st.ok()) {
+    clear_read_state();
+    return st;
+  }
 
-  // Set the current subarray
-  if (found) {
-    assert(read_state_.cur_subarray_partition_ != nullptr);
-    std::memcpy(
-        read_state_.cur_subarray_partition_,
-        next_partition,
-        2 * array_schema_->coords_size());
-  } else {
+  if (!found) {
     std::free(read_state_.cur_subarray_partition_);
     read_state_.cur_subarray_partition_ = nullptr;
   }
 
-  std::free(next_partition);
-
   return Status::Ok();
 
   STATS_FUNC_OUT(reader_next_subarray_partition);
@@ -340,16 +456,27 @@ Status Reader::read() {
   STATS_FUNC_IN(reader_read);
 
   if (fragment_metadata_.empty() ||
-      read_state_.cur_subarray_partition_ == nullptr) {
+      (read_state_.cur_subarray_partition_ == nullptr &&
+       prefetched_partitions_.empty())) {
     zero_out_buffer_sizes();
     return Status::Ok();
   }
 
+  if (!aggregates_.empty())
+    return aggregate_read();
+
+  if (!prefetched_partitions_.empty() || prefetch_partition_num() > 0)
+    return prefetch_read();
+
   bool no_results;
   do {
     read_state_.overflowed_ = false;
     reset_buffer_sizes();
 
+    // The tiles handed over to result views belong to a previous partition
+    if (!copy_pending())
+      view_tiles_.clear();
+
     // Perform dense or sparse read if there are fragments
     if (array_schema_->dense()) {
       RETURN_NOT_OK(dense_read());
@@ -363,6 +490,11 @@ Status Reader::read() {
     if (read_state_.overflowed_)
       zero_out_buffer_sizes();
 
+    // The rest of the results of the current partition did not fit
+    // in the buffers; the next read will resume copying them
+    if (copy_pending())
+      return Status::Ok();
+
     // Advance to the next subarray partition
     RETURN_NOT_OK(next_subarray_partition());
 
@@ -392,6 +524,18 @@ void Reader::set_array_schema(const ArraySchema* array_schema) {
     layout_ = Layout::GLOBAL_ORDER;
 }
 
+Status Reader::set_condition(const QueryCondition& condition) {
+  if (array_schema_->dense())
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot set query condition; Query conditions are applicable only "
+        "to sparse arrays"));
+
+  RETURN_NOT_OK(condition.check(array_schema_));
+  condition_ = condition;
+
+  return Status::Ok();
+}
+
 Status Reader::set_buffer(
     const std::string& attribute, void* buffer, uint64_t* buffer_size) {
   // Check buffer
@@ -496,13 +640,32 @@ Status Reader::set_layout(Layout layout) {
     return LOG_STATUS(Status::ReaderError(
         "Cannot set layout; The array is defined as a key-value store"));
 
+  // The Hilbert layout is applicable only to the cell order
+  if (layout == Layout::HILBERT)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot set layout; The Hilbert layout is applicable only to the "
+        "cell order of sparse arrays"));
+
   layout_ = layout;
 
   return Status::Ok();
 }
 
+Status Reader::set_result_views(bool enabled) {
+  if (read_state_.initialized_)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot set result views; The query is already initialized"));
+
+  result_views_enabled_ = enabled;
+
+  return Status::Ok();
+}
+
 void Reader::set_storage_manager(StorageManager* storage_manager) {
   storage_manager_ = storage_manager;
+  auto sm_params = storage_manager_->config().sm_params();
+  var_offsets_bitsize_ = sm_params.var_offsets_bitsize_;
+  var_offsets_extra_element_ = sm_params.var_offsets_extra_element_;
 }
 
 Status Reader::set_subarray(const void* subarray) {
@@ -526,6 +689,20 @@ Status Reader::set_subarray(const void* subarray) {
   return Status::Ok();
 }
 
+Status Reader::set_var_offsets_format(uint32_t bitsize, bool extra_element) {
+  if (read_state_.initialized_)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot set var offsets format; Query already initialized"));
+  if (bitsize != 32 && bitsize != 64)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot set var offsets format; Invalid offset bitsize"));
+
+  var_offsets_bitsize_ = bitsize;
+  var_offsets_extra_element_ = extra_element;
+
+  return Status::Ok();
+}
+
 void* Reader::subarray() const {
   return read_state_.subarray_;
 }
@@ -534,10 +711,410 @@ void* Reader::subarray() const {
 /*          PRIVATE METHODS       */
 /* ****************************** */
 
+Status Reader::aggregate_read() {
+  auto coords_type = array_schema_->coords_type();
+  switch (coords_type) {
+    case Datatype::INT8:
+      return aggregate_read<int8_t>();
+    case Datatype::UINT8:
+      return aggregate_read<uint8_t>();
+    case Datatype::INT16:
+      return aggregate_read<int16_t>();
+    case Datatype::UINT16:
+      return aggregate_read<uint16_t>();
+    case Datatype::INT32:
+      return aggregate_read<int>();
+    case Datatype::UINT32:
+      return aggregate_read<unsigned>();
+    case Datatype::INT64:
+      return aggregate_read<int64_t>();
+    case Datatype::UINT64:
+      return aggregate_read<uint64_t>();
+    case Datatype::FLOAT32:
+      return aggregate_read<float>();
+    case Datatype::FLOAT64:
+      return aggregate_read<double>();
+    default:
+      return LOG_STATUS(
+          Status::ReaderError("Cannot read; Unsupported domain type"));
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status Reader::aggregate_read() {
+  STATS_FUNC_IN(reader_aggregate_read);
+
+  for (auto& it : aggregates_)
+    it.second.clear();
+
+  // Get overlapping tile indexes
+  OverlappingTileVec tiles;
+  RETURN_CANCEL_OR_ERROR(compute_overlapping_tiles<T>(&tiles));
+  skip_tiles_by_condition<T>(&tiles);
+
+  // Only the tiles that may hold cells with the same coordinates as other
+  // tiles need to be deduplicated; the rest are aggregated independently
+  OverlappingTileVec conflicting_tiles;
+  split_conflicting_tiles<T>(&tiles, &conflicting_tiles);
+  RETURN_CANCEL_OR_ERROR(aggregate_tiles<T>(&tiles));
+  RETURN_CANCEL_OR_ERROR(aggregate_conflicting_tiles<T>(&conflicting_tiles));
+
+  // The whole subarray has been processed
+  std::free(read_state_.cur_subarray_partition_);
+  read_state_.cur_subarray_partition_ = nullptr;
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_aggregate_read);
+}
+
+template <class T>
+Status Reader::aggregate_conflicting_tiles(OverlappingTileVec* tiles) {
+  if (tiles->empty())
+    return Status::Ok();
+
+  // Read the coordinates, the aggregated attributes and the attributes of
+  // the query condition
+  std::vector<std::string> read_attributes = {constants::coords};
+  for (const auto& it : aggregates_) {
+    if (it.second.needs_values())
+      read_attributes.push_back(it.first);
+  }
+  for (const auto& attr : condition_.field_names()) {
+    if (std::find(read_attributes.begin(), read_attributes.end(), attr) ==
+        read_attributes.end())
+      read_attributes.push_back(attr);
+  }
+  uint64_t cell_size = array_schema_->coords_size();
+  for (size_t i = 1; i < read_attributes.size(); ++i)
+    cell_size += array_schema_->cell_size(read_attributes[i]);
+
+  // Pack the conflict groups into batches that fit in the in-flight
+  // budget (a group that does not fit forms a batch on its own). The
+  // tiles keep their relative order, so that the tiles of each fragment
+  // remain sorted in the global order.
+  std::vector<size_t> groups;
+  compute_conflict_groups<T>(*tiles, &groups);
+  auto tile_num = tiles->size();
+  std::unordered_map<size_t, uint64_t> group_sizes;
+  for (size_t i = 0; i < tile_num; ++i) {
+    const auto& tile = (*tiles)[i];
+    group_sizes[groups[i]] +=
+        fragment_metadata_[tile->fragment_idx_]->cell_num(tile->tile_idx_) *
+        cell_size;
+  }
+  std::unordered_map<size_t, size_t> group_batches;
+  std::vector<uint64_t> batch_sizes;
+  for (size_t i = 0; i < tile_num; ++i) {
+    if (group_batches.count(groups[i]) != 0)
+      continue;
+    auto group_size = group_sizes[groups[i]];
+    if (batch_sizes.empty() ||
+        batch_sizes.back() + group_size > read_inflight_size_)
+      batch_sizes.push_back(0);
+    batch_sizes.back() += group_size;
+    group_batches[groups[i]] = batch_sizes.size() - 1;
+  }
+  std::vector<OverlappingTileVec> batches(batch_sizes.size());
+  for (size_t i = 0; i < tile_num; ++i)
+    batches[group_batches[groups[i]]].push_back(std::move((*tiles)[i]));
+  tiles->clear();
+
+  for (auto& batch : batches) {
+    RETURN_CANCEL_OR_ERROR(read_all_tiles(read_attributes, &batch));
+
+    // Compute the deduplicated result cell ranges
+    OverlappingCoordsList<T> coords;
+    RETURN_CANCEL_OR_ERROR(compute_overlapping_coords<T>(batch, &coords));
+    std::unique_ptr<T[]> tile_coords(nullptr);
+    RETURN_CANCEL_OR_ERROR(compute_tile_coords<T>(&tile_coords, &coords));
+    RETURN_CANCEL_OR_ERROR(merge_coords<T>(&coords));
+    tile_coords.reset(nullptr);
+    OverlappingCellRangeList cell_ranges;
+    RETURN_CANCEL_OR_ERROR(compute_cell_ranges(coords, &cell_ranges));
+    RETURN_CANCEL_OR_ERROR(apply_query_condition(&cell_ranges));
+
+    // Aggregate the cell ranges
+    for (auto& it : aggregates_) {
+      auto& aggregate = it.second;
+      for (const auto& cr : cell_ranges) {
+        if (aggregate.needs_values()) {
+          const auto& t = cr.tile_->attr_tiles_.find(it.first)->second.first;
+          aggregate.update(t.data(), cr.start_, cr.end_);
+        } else {
+          aggregate.add_count(cr.end_ - cr.start_ + 1);
+        }
+      }
+    }
+
+    // Release the tiles of the batch
+    batch.clear();
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status Reader::aggregate_tile(
+    const OverlappingTile* tile,
+    bool from_metadata,
+    const PartitionRanges<T>& ranges,
+    std::vector<Aggregate>* aggregates,
+    const std::vector<std::string>& aggregate_names) const {
+  const auto& meta = fragment_metadata_[tile->fragment_idx_];
+  auto cell_num = meta->cell_num(tile->tile_idx_);
+  auto agg_num = aggregate_names.size();
+
+  // Aggregate the tile from its statistics
+  if (from_metadata) {
+    for (size_t i = 0; i < agg_num; ++i) {
+      auto& aggregate = (*aggregates)[i];
+      const auto& name = aggregate_names[i];
+      if (aggregate.needs_values())
+        aggregate.merge_summary(
+            cell_num,
+            meta->tile_nan_num(name, tile->tile_idx_),
+            meta->tile_min(name, tile->tile_idx_),
+            meta->tile_max(name, tile->tile_idx_),
+            meta->tile_sum(name, tile->tile_idx_));
+      else
+        aggregate.add_count(cell_num);
+    }
+    return Status::Ok();
+  }
+
+  // All the cells of a fully overlapping tile are results, unless they
+  // are filtered by the query condition
+  std::vector<uint8_t> bitmap;
+  if (tile->full_overlap_) {
+    if (condition_.empty()) {
+      for (size_t i = 0; i < agg_num; ++i) {
+        auto& aggregate = (*aggregates)[i];
+        if (aggregate.needs_values()) {
+          const auto& t =
+              tile->attr_tiles_.find(aggregate_names[i])->second.first;
+          aggregate.update(t.data(), (uint64_t)0, cell_num - 1);
+        } else {
+          aggregate.add_count(cell_num);
+        }
+      }
+      return Status::Ok();
+    }
+    bitmap.assign(cell_num, 1);
+  } else {
+    compute_coords_bitmap<T>(tile, ranges, &bitmap);
+  }
+
+  // Apply the query condition
+  if (!condition_.empty()) {
+    std::vector<uint8_t> condition_bitmap;
+    RETURN_NOT_OK(condition_.apply(
+        array_schema_, tile->attr_tiles_, cell_num, &condition_bitmap));
+    for (uint64_t c = 0; c < cell_num; ++c)
+      bitmap[c] &= condition_bitmap[c];
+  }
+
+  uint64_t result_num = 0;
+  for (uint64_t c = 0; c < cell_num; ++c)
+    result_num += bitmap[c];
+  for (size_t i = 0; i < agg_num; ++i) {
+    auto& aggregate = (*aggregates)[i];
+    if (aggregate.needs_values()) {
+      const auto& t = tile->attr_tiles_.find(aggregate_names[i])->second.first;
+      aggregate.update(t.data(), &bitmap[0], cell_num);
+    } else {
+      aggregate.add_count(result_num);
+    }
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status Reader::aggregate_tiles(OverlappingTileVec* tiles) {
+  if (tiles->empty())
+    return Status::Ok();
+
+  // For easy reference
+  auto ranges = compute_partition_ranges<T>();
+  std::vector<std::string> aggregate_names;
+  std::vector<Aggregate> empty_aggregates;
+  std::vector<std::string> value_attributes;
+  for (const auto& it : aggregates_) {
+    aggregate_names.push_back(it.first);
+    empty_aggregates.push_back(it.second);
+    empty_aggregates.back().clear();
+    if (it.second.needs_values())
+      value_attributes.push_back(it.first);
+  }
+  for (const auto& attr : condition_.field_names()) {
+    if (std::find(value_attributes.begin(), value_attributes.end(), attr) ==
+        value_attributes.end())
+      value_attributes.push_back(attr);
+  }
+  std::vector<std::string> coords_attributes = {constants::coords};
+  coords_attributes.insert(
+      coords_attributes.end(),
+      value_attributes.begin(),
+      value_attributes.end());
+  uint64_t cell_size = array_schema_->coords_size();
+  for (const auto& attr : value_attributes)
+    cell_size += array_schema_->cell_size(attr);
+
+  // Process the tiles in batches
+  auto tile_num = tiles->size();
+  size_t batch_start = 0;
+  uint64_t metadata_tile_num = 0;
+  while (batch_start < tile_num) {
+    // Form the next batch. The fully overlapping tiles do not need their
+    // coordinates, and they are not read at all if there is no query
+    // condition and the fragment stores the statistics of the aggregated
+    // attributes.
+    OverlappingTileVec full_tiles, partial_tiles;
+    std::vector<OverlappingTile*> batch;
+    std::vector<uint8_t> from_metadata;
+    uint64_t batch_size = 0;
+    size_t batch_end = batch_start;
+    while (batch_end < tile_num &&
+           (batch_end == batch_start || batch_size < read_inflight_size_)) {
+      auto& tile = (*tiles)[batch_end++];
+      const auto& meta = fragment_metadata_[tile->fragment_idx_];
+      auto tile_from_metadata = tile->full_overlap_ && condition_.empty();
+      for (const auto& attr : value_attributes)
+        tile_from_metadata = tile_from_metadata && meta->has_tile_stats(attr);
+      batch.push_back(tile.get());
+      from_metadata.push_back(tile_from_metadata);
+      if (tile_from_metadata) {
+        ++metadata_tile_num;
+        continue;
+      }
+      batch_size += meta->cell_num(tile->tile_idx_) * cell_size;
+      if (!tile->full_overlap_)
+        partial_tiles.push_back(std::move(tile));
+      else
+        full_tiles.push_back(std::move(tile));
+    }
+    RETURN_CANCEL_OR_ERROR(read_all_tiles(value_attributes, &full_tiles));
+    RETURN_CANCEL_OR_ERROR(read_all_tiles(coords_attributes, &partial_tiles));
+
+    // Aggregate the tiles of the batch in parallel
+    std::vector<std::vector<Aggregate>> tile_aggregates(
+        batch.size(), empty_aggregates);
+    auto statuses = parallel_for(0, batch.size(), [&](uint64_t i) {
+      return aggregate_tile<T>(
+          batch[i],
+          from_metadata[i],
+          ranges,
+          &tile_aggregates[i],
+          aggregate_names);
+    });
+    for (const auto& st : statuses)
+      RETURN_CANCEL_OR_ERROR(st);
+    for (const auto& aggregates : tile_aggregates) {
+      for (size_t i = 0; i < aggregate_names.size(); ++i)
+        aggregates_[aggregate_names[i]].merge(aggregates[i]);
+    }
+
+    // Release the tiles of the batch
+    for (size_t i = batch_start; i < batch_end; ++i)
+      (*tiles)[i].reset(nullptr);
+    batch_start = batch_end;
+  }
+
+  STATS_COUNTER_ADD(
+      reader_num_tiles_aggregated_from_metadata, metadata_tile_num);
+
+  return Status::Ok();
+}
+
+template <class T>
+Status Reader::add_range(unsigned dim_idx, const T* start, const T* end) {
+  auto dim_domain =
+      (const T*)array_schema_->domain()->dimension(dim_idx)->domain();
+  if (*start > *end)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot add range; Range lower bound is larger than upper bound"));
+  if (*start < dim_domain[0] || *end > dim_domain[1])
+    return LOG_STATUS(
+        Status::ReaderError("Cannot add range; Range out of bounds"));
+
+  // Reset the read state, so that the new range is taken into account
+  // when the query is initialized again
+  RETURN_NOT_OK(reset_read_state());
+
+  ranges_.resize(array_schema_->dim_num());
+  auto& ranges = ranges_[dim_idx];
+  auto offset = ranges.size();
+  ranges.resize(offset + 2 * sizeof(T));
+  std::memcpy(&ranges[offset], start, sizeof(T));
+  std::memcpy(&ranges[offset + sizeof(T)], end, sizeof(T));
+
+  return Status::Ok();
+}
+
+Status Reader::apply_query_condition(
+    OverlappingCellRangeList* cell_ranges) const {
+  STATS_FUNC_IN(reader_apply_query_condition);
+
+  if (condition_.empty() || cell_ranges->empty())
+    return Status::Ok();
+
+  // Evaluate the condition once per tile, and keep the parts of the cell
+  // ranges that consist of cells satisfying it
+  std::unordered_map<const OverlappingTile*, std::vector<uint8_t>> bitmaps;
+  OverlappingCellRangeList result_ranges;
+  uint64_t filtered_cell_num = 0;
+  for (const auto& cr : *cell_ranges) {
+    if (cr.tile_ == nullptr) {
+      result_ranges.push_back(cr);
+      continue;
+    }
+
+    auto it = bitmaps.find(cr.tile_);
+    if (it == bitmaps.end()) {
+      const auto& t =
+          cr.tile_->attr_tiles_.find(constants::coords)->second.first;
+      it = bitmaps.emplace(cr.tile_, std::vector<uint8_t>()).first;
+      RETURN_NOT_OK(condition_.apply(
+          array_schema_, cr.tile_->attr_tiles_, t.cell_num(), &it->second));
+    }
+
+    const auto& bitmap = it->second;
+    auto pos = cr.start_;
+    while (pos <= cr.end_) {
+      if (!bitmap[pos]) {
+        ++filtered_cell_num;
+        ++pos;
+        continue;
+      }
+      auto start = pos;
+      while (pos <= cr.end_ && bitmap[pos])
+        ++pos;
+      result_ranges.emplace_back(cr.tile_, start, pos - 1);
+    }
+  }
+  cell_ranges->swap(result_ranges);
+
+  STATS_COUNTER_ADD(reader_num_cells_filtered_by_condition, filtered_cell_num);
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_apply_query_condition);
+}
+
+void Reader::clear_prefetched_partitions() {
+  for (auto& partition : prefetched_partitions_) {
+    if (partition->task_.valid())
+      partition->task_.wait();
+  }
+  prefetched_partitions_.clear();
+}
+
 void Reader::clear_read_state() {
-  for (auto p : read_state_.subarray_partitions_)
-    std::free(p);
-  read_state_.subarray_partitions_.clear();
+  clear_prefetched_partitions();
+  read_state_.partitioner_.clear();
 
   std::free(read_state_.subarray_);
   read_state_.subarray_ = nullptr;
@@ -546,6 +1123,11 @@ void Reader::clear_read_state() {
 
   read_state_.initialized_ = false;
   read_state_.overflowed_ = false;
+
+  copy_state_.cell_ranges_.clear();
+  copy_state_.copied_cell_num_ = 0;
+  copy_state_.tiles_.clear();
+  view_tiles_.clear();
 }
 
 template <class T>
@@ -593,6 +1175,111 @@ Status Reader::compute_cell_ranges(
   STATS_FUNC_OUT(reader_compute_cell_ranges);
 }
 
+template <class T>
+Status Reader::compute_cell_ranges(
+    const OverlappingTileVec& tiles,
+    OverlappingCellRangeList* cell_ranges) const {
+  STATS_FUNC_IN(reader_compute_cell_ranges);
+
+  auto ranges = compute_partition_ranges<T>();
+  std::vector<uint8_t> bitmap;
+
+  for (const auto& tile : tiles) {
+    const auto& t = tile->attr_tiles_.find(constants::coords)->second.first;
+    auto coords_num = t.cell_num();
+    if (coords_num == 0)
+      continue;
+
+    // All the cells of a fully overlapping tile are results
+    if (tile->full_overlap_) {
+      cell_ranges->emplace_back(tile.get(), 0, coords_num - 1);
+      continue;
+    }
+
+    // Append a range for every run of set bits
+    compute_coords_bitmap<T>(tile.get(), ranges, &bitmap);
+    uint64_t i = 0;
+    while (i < coords_num) {
+      if (!bitmap[i]) {
+        ++i;
+        continue;
+      }
+      auto start = i;
+      while (i < coords_num && bitmap[i])
+        ++i;
+      cell_ranges->emplace_back(tile.get(), start, i - 1);
+    }
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_compute_cell_ranges);
+}
+
+template <class T>
+void Reader::compute_conflict_groups(
+    const OverlappingTileVec& tiles, std::vector<size_t>* groups) const {
+  // For easy reference
+  auto dim_num = array_schema_->dim_num();
+  auto rect_size = 2 * dim_num;
+  auto tile_num = tiles.size();
+
+  // Compute the bounding box of the partition ranges
+  auto bbox = ranges_bounding_box(compute_partition_ranges<T>());
+
+  // Clip the tile MBRs to the bounding box
+  std::vector<T> mbrs(tile_num * rect_size);
+  for (size_t i = 0; i < tile_num; ++i) {
+    const auto& tile = tiles[i];
+    auto mbr = (const T*)fragment_metadata_[tile->fragment_idx_]
+                   ->mbrs()[tile->tile_idx_];
+    auto clipped = &mbrs[i * rect_size];
+    for (unsigned d = 0; d < dim_num; ++d) {
+      clipped[2 * d] = std::max(mbr[2 * d], bbox[2 * d]);
+      clipped[2 * d + 1] = std::min(mbr[2 * d + 1], bbox[2 * d + 1]);
+    }
+  }
+
+  // Union the overlapping tiles of different fragments, sweeping the
+  // tiles in the order of the lower bound of their first dimension
+  std::vector<size_t> parent(tile_num);
+  std::vector<size_t> order(tile_num);
+  for (size_t i = 0; i < tile_num; ++i)
+    parent[i] = order[i] = i;
+  auto find = [&parent](size_t i) -> size_t {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return mbrs[a * rect_size] < mbrs[b * rect_size];
+  });
+  for (size_t a = 0; a < tile_num; ++a) {
+    auto i = order[a];
+    auto mbr_i = &mbrs[i * rect_size];
+    for (size_t b = a + 1; b < tile_num; ++b) {
+      auto j = order[b];
+      auto mbr_j = &mbrs[j * rect_size];
+      if (mbr_j[0] > mbr_i[1])
+        break;
+      if (tiles[i]->fragment_idx_ == tiles[j]->fragment_idx_)
+        continue;
+      bool overlaps = true;
+      for (unsigned d = 1; d < dim_num && overlaps; ++d)
+        overlaps = mbr_j[2 * d] <= mbr_i[2 * d + 1] &&
+                   mbr_i[2 * d] <= mbr_j[2 * d + 1];
+      if (overlaps)
+        parent[find(i)] = find(j);
+    }
+  }
+
+  groups->resize(tile_num);
+  for (size_t i = 0; i < tile_num; ++i)
+    (*groups)[i] = find(i);
+}
+
 template <class T>
 Status Reader::compute_dense_cell_ranges(
     const T* tile_coords,
@@ -735,6 +1422,54 @@ Status Reader::compute_dense_cell_ranges(
   STATS_FUNC_OUT(reader_compute_dense_cell_ranges);
 }
 
+template <class T>
+Status Reader::compute_dense_cell_ranges(
+    const T* tile_coords,
+    DenseTileRuns* runs,
+    uint64_t start,
+    uint64_t end,
+    std::list<DenseCellRange<T>>* dense_cell_ranges) const {
+  STATS_FUNC_IN(reader_compute_dense_cell_ranges);
+
+  // For easy reference
+  const auto& starts = runs->starts_;
+  const auto& ends = runs->ends_;
+  const auto& fragments = runs->fragments_;
+  auto run_num = starts.size();
+  auto& r = runs->next_;
+
+  // Skip the runs that end before the range
+  while (r < run_num && ends[r] < start)
+    ++r;
+
+  // Cut the range by the runs it intersects, padding the gaps between
+  // them with empty ranges
+  while (r < run_num && starts[r] <= end) {
+    if (starts[r] > start) {
+      dense_cell_ranges->emplace_back(
+          -1, tile_coords, start, starts[r] - 1, nullptr, nullptr);
+      start = starts[r];
+    }
+    auto new_end = MIN(end, ends[r]);
+    dense_cell_ranges->emplace_back(
+        fragments[r], tile_coords, start, new_end, nullptr, nullptr);
+    start = new_end + 1;
+    if (new_end < ends[r])
+      return Status::Ok();
+    ++r;
+  }
+
+  // Insert an empty cell range if the input range has not been filled
+  if (start <= end) {
+    dense_cell_ranges->emplace_back(
+        -1, tile_coords, start, end, nullptr, nullptr);
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_compute_dense_cell_ranges);
+}
+
 template <class T>
 Status Reader::compute_dense_overlapping_tiles_and_cell_ranges(
     const std::list<DenseCellRange<T>>& dense_cell_ranges,
@@ -874,77 +1609,556 @@ Status Reader::compute_dense_overlapping_tiles_and_cell_ranges(
     overlapping_cell_ranges->emplace_back(cur_tile, start, end);
 
   return Status::Ok();
-
-  STATS_FUNC_OUT(reader_compute_dense_overlapping_tiles_and_cell_ranges);
-}  // namespace sm
+
+  STATS_FUNC_OUT(reader_compute_dense_overlapping_tiles_and_cell_ranges);
+}  // namespace sm
+
+template <class T>
+Status Reader::compute_dense_tile_runs(
+    const std::vector<DenseCellRangeIter<T>>& frag_its,
+    DenseTileRuns* runs) const {
+  STATS_FUNC_IN(reader_compute_dense_tile_runs);
+
+  // For easy reference
+  auto domain = array_schema_->domain();
+  auto dim_num = domain->dim_num();
+  auto dom = (const T*)domain->domain();
+  auto tile_extents = (const T*)domain->tile_extents();
+  auto row_major = (array_schema_->cell_order() == Layout::ROW_MAJOR);
+
+  // Order the dimensions from the slowest to the fastest varying in the
+  // cell order, and compute their cell position strides within a tile
+  std::vector<unsigned> dims(dim_num);
+  std::vector<uint64_t> strides(dim_num);
+  for (unsigned i = 0; i < dim_num; ++i)
+    dims[i] = row_major ? i : dim_num - 1 - i;
+  uint64_t stride = 1;
+  for (auto i = (int)dim_num - 1; i >= 0; --i) {
+    strides[dims[i]] = stride;
+    stride *= (uint64_t)tile_extents[dims[i]];
+  }
+
+  // Collect the range boundaries of all fragments. A range `[s, e]` of
+  // fragment `f` is opened at `s` with `f + 1` and closed at `e + 1`
+  // with `-(f + 1)`.
+  std::vector<std::pair<uint64_t, int>> events;
+  std::vector<uint64_t> lo(dim_num), hi(dim_num), cur(dim_num);
+  auto fragment_num = (int)frag_its.size();
+  for (int f = 0; f < fragment_num; ++f) {
+    const auto& it = frag_its[f];
+    if (it.end())
+      continue;
+
+    // Normalize the fragment subarray in the tile
+    const auto& subarray = it.subarray();
+    for (unsigned d = 0; d < dim_num; ++d) {
+      T norm = subarray[2 * d] - dom[2 * d];
+      lo[d] = (uint64_t)(norm - (norm / tile_extents[d]) * tile_extents[d]);
+      hi[d] = lo[d] + (uint64_t)(subarray[2 * d + 1] - subarray[2 * d]);
+    }
+
+    // The fastest varying dimensions that the subarray spans entirely are
+    // merged into the ranges along the slowest of them
+    auto last = (int)dim_num - 1;
+    while (last > 0 && lo[dims[last]] == 0 &&
+           hi[dims[last]] + 1 == (uint64_t)tile_extents[dims[last]])
+      --last;
+    auto range_dim = dims[last];
+    auto range_len = (hi[range_dim] - lo[range_dim] + 1) * strides[range_dim];
+
+    // Visit the ranges by stepping through the slower dimensions
+    for (auto i = 0; i < last; ++i)
+      cur[dims[i]] = lo[dims[i]];
+    while (true) {
+      uint64_t start = lo[range_dim] * strides[range_dim];
+      for (auto i = 0; i < last; ++i)
+        start += cur[dims[i]] * strides[dims[i]];
+      events.emplace_back(start, f + 1);
+      events.emplace_back(start + range_len, -(f + 1));
+
+      auto i = last - 1;
+      for (; i >= 0; --i) {
+        if (++cur[dims[i]] <= hi[dims[i]])
+          break;
+        cur[dims[i]] = lo[dims[i]];
+      }
+      if (i < 0)
+        break;
+    }
+  }
+  std::sort(events.begin(), events.end());
+
+  // Sweep over the boundaries, keeping track of the fragments that cover
+  // the current position. A new run starts wherever the most recent
+  // covering fragment changes.
+  std::vector<uint8_t> active(fragment_num, 0);
+  int owner = -1;
+  bool open = false;
+  auto& starts = runs->starts_;
+  auto& ends = runs->ends_;
+  auto& fragments = runs->fragments_;
+  for (size_t e = 0; e < events.size();) {
+    auto pos = events[e].first;
+    for (; e < events.size() && events[e].first == pos; ++e) {
+      auto f = std::abs(events[e].second) - 1;
+      if (events[e].second > 0) {
+        active[f] = 1;
+        owner = std::max(owner, f);
+      } else {
+        active[f] = 0;
+        while (owner >= 0 && !active[owner])
+          --owner;
+      }
+    }
+
+    // The open run continues if its fragment still has precedence
+    if (open && fragments.back() == owner)
+      continue;
+
+    // Close the open run and open a new one
+    if (open)
+      ends.back() = pos - 1;
+    open = (owner != -1);
+    if (open) {
+      starts.push_back(pos);
+      ends.push_back(pos);
+      fragments.push_back(owner);
+    }
+  }
+  assert(!open);
+
+  runs->next_ = 0;
+  runs->computed_ = true;
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_compute_dense_tile_runs);
+}
+
+template <class T>
+Status Reader::compute_overlapping_coords(
+    const OverlappingTileVec& tiles, OverlappingCoordsList<T>* coords) const {
+  STATS_FUNC_IN(reader_compute_overlapping_coords);
+
+  auto ranges = compute_partition_ranges<T>();
+  for (const auto& tile : tiles) {
+    if (tile->full_overlap_) {
+      RETURN_NOT_OK(get_all_coords<T>(tile.get(), coords));
+    } else {
+      RETURN_NOT_OK(compute_overlapping_coords<T>(tile.get(), ranges, coords));
+    }
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_compute_overlapping_coords);
+}
+
+template <class T>
+Status Reader::compute_overlapping_coords(
+    const OverlappingTile* tile,
+    const PartitionRanges<T>& ranges,
+    OverlappingCoordsList<T>* coords) const {
+  auto dim_num = array_schema_->dim_num();
+  const auto& t = tile->attr_tiles_.find(constants::coords)->second.first;
+  auto coords_num = t.cell_num();
+  auto c = (T*)t.data();
+
+  std::vector<uint8_t> bitmap;
+  compute_coords_bitmap<T>(tile, ranges, &bitmap);
+  for (uint64_t i = 0; i < coords_num; ++i) {
+    if (bitmap[i])
+      coords->emplace_back(tile, &c[i * dim_num], i);
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status Reader::compute_overlapping_tiles(OverlappingTileVec* tiles) const {
+  STATS_FUNC_IN(reader_compute_overlapping_tiles);
+
+  // For easy reference
+  auto ranges = compute_partition_ranges<T>();
+  auto bbox = ranges_bounding_box(ranges);
+  auto fragment_num = fragment_metadata_.size();
+
+  // The tiles also hold the attributes the query condition refers to
+  auto attributes = attributes_;
+  for (const auto& attr : condition_.field_names()) {
+    if (std::find(attributes.begin(), attributes.end(), attr) ==
+        attributes.end())
+      attributes.push_back(attr);
+  }
+
+  // No cell can be a result if a dimension has no ranges
+  tiles->clear();
+  if (bbox.empty())
+    return Status::Ok();
+
+  // Find overlapping tile indexes for each fragment
+  for (unsigned i = 0; i < fragment_num; ++i) {
+    // Applicable only to sparse fragments
+    if (fragment_metadata_[i]->dense())
+      continue;
+
+    // Query the R-tree with the bounding box of the ranges and keep the
+    // (tile id, full overlap) pairs of the tiles that overlap the ranges.
+    // A tile that partially overlaps the bounding box cannot be contained
+    // in the ranges.
+    std::vector<std::pair<uint64_t, bool>> tile_ids;
+    const auto& mbrs = fragment_metadata_[i]->mbrs();
+    auto overlap = fragment_metadata_[i]->rtree().get_tile_overlap(&bbox[0]);
+    for (const auto& t : overlap.tiles_) {
+      if (overlaps_ranges(ranges, (const T*)mbrs[t.first]))
+        tile_ids.emplace_back(t.first, false);
+    }
+    for (const auto& tr : overlap.tile_ranges_) {
+      for (uint64_t j = tr.first; j <= tr.second; ++j) {
+        auto mbr = (const T*)mbrs[j];
+        if (overlaps_ranges(ranges, mbr))
+          tile_ids.emplace_back(j, contained_in_ranges(ranges, mbr));
+      }
+    }
+
+    // Add the tiles in ascending order of their ids
+    std::sort(tile_ids.begin(), tile_ids.end());
+    for (const auto& t : tile_ids)
+      tiles->emplace_back(
+          new OverlappingTile(i, t.first, attributes, t.second));
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_compute_overlapping_tiles);
+}
+
+template <class T>
+void Reader::compute_coords_bitmap(
+    const OverlappingTile* tile,
+    const PartitionRanges<T>& ranges,
+    std::vector<uint8_t>* bitmap) const {
+  // For easy reference
+  auto dim_num = array_schema_->dim_num();
+  const auto& t = tile->attr_tiles_.find(constants::coords)->second.first;
+  auto coords_num = t.cell_num();
+  auto coords = (const T*)t.data();
+  bitmap->resize(coords_num);
+
+  // Common case of a single range per dimension
+  bool single_rect = true;
+  for (unsigned d = 0; d < dim_num; ++d)
+    single_rect = single_rect && ranges[d].size() == 2;
+  if (single_rect) {
+    std::vector<T> rect(2 * dim_num);
+    for (unsigned d = 0; d < dim_num; ++d) {
+      rect[2 * d] = ranges[d][0];
+      rect[2 * d + 1] = ranges[d][1];
+    }
+    utils::geometry::coords_in_rect<T>(
+        coords, coords_num, &rect[0], dim_num, bitmap->data());
+    return;
+  }
+
+  // A cell is a result if its coordinate falls in a range along every
+  // dimension. Only the ranges that overlap the tile MBR are searched.
+  std::fill(bitmap->begin(), bitmap->end(), 1);
+  auto mbr = (const T*)fragment_metadata_[tile->fragment_idx_]
+                 ->mbrs()[tile->tile_idx_];
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto r = ranges[d].data();
+    auto range_num = ranges[d].size() / 2;
+    auto first = lower_bound_range(r, range_num, mbr[2 * d]);
+    auto last = first;
+    while (last < range_num && r[2 * last] <= mbr[2 * d + 1])
+      ++last;
+    r += 2 * first;
+    range_num = last - first;
+    for (uint64_t i = 0; i < coords_num; ++i) {
+      if (!(*bitmap)[i])
+        continue;
+      auto c = coords[i * dim_num + d];
+      auto k = lower_bound_range(r, range_num, c);
+      (*bitmap)[i] = k < range_num && r[2 * k] <= c;
+    }
+  }
+}
+
+template <class T>
+Reader::PartitionRanges<T> Reader::compute_partition_ranges() const {
+  auto dim_num = array_schema_->dim_num();
+  auto partition = (const T*)read_state_.cur_subarray_partition_;
+  PartitionRanges<T> ranges(dim_num);
+  std::vector<std::pair<T, T>> dim_ranges;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto low = partition[2 * d], high = partition[2 * d + 1];
+    if (ranges_.empty() || ranges_[d].empty()) {
+      ranges[d] = {low, high};
+      continue;
+    }
+
+    // Clip the added ranges to the partition, then sort them and merge
+    // the overlapping ones
+    auto r = (const T*)&ranges_[d][0];
+    auto range_num = ranges_[d].size() / (2 * sizeof(T));
+    dim_ranges.clear();
+    for (uint64_t i = 0; i < range_num; ++i) {
+      if (r[2 * i] <= high && r[2 * i + 1] >= low)
+        dim_ranges.emplace_back(
+            std::max(r[2 * i], low), std::min(r[2 * i + 1], high));
+    }
+    std::sort(dim_ranges.begin(), dim_ranges.end());
+    auto& merged = ranges[d];
+    for (const auto& range : dim_ranges) {
+      if (!merged.empty() && range.first <= merged.back()) {
+        merged.back() = std::max(merged.back(), range.second);
+      } else {
+        merged.push_back(range.first);
+        merged.push_back(range.second);
+      }
+    }
+  }
+
+  return ranges;
+}
+
+template <class T>
+std::vector<T> Reader::ranges_bounding_box(
+    const PartitionRanges<T>& ranges) const {
+  std::vector<T> bbox;
+  for (const auto& r : ranges) {
+    if (r.empty())
+      return std::vector<T>();
+    bbox.push_back(r.front());
+    bbox.push_back(r.back());
+  }
+
+  return bbox;
+}
+
+template <class T>
+bool Reader::overlaps_ranges(
+    const PartitionRanges<T>& ranges, const T* rect) const {
+  auto dim_num = array_schema_->dim_num();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto r = ranges[d].data();
+    auto range_num = ranges[d].size() / 2;
+    auto k = lower_bound_range(r, range_num, rect[2 * d]);
+    if (k == range_num || r[2 * k] > rect[2 * d + 1])
+      return false;
+  }
+
+  return true;
+}
+
+template <class T>
+bool Reader::contained_in_ranges(
+    const PartitionRanges<T>& ranges, const T* rect) const {
+  auto dim_num = array_schema_->dim_num();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto r = ranges[d].data();
+    auto range_num = ranges[d].size() / 2;
+    auto k = lower_bound_range(r, range_num, rect[2 * d]);
+    if (k == range_num || r[2 * k] > rect[2 * d] ||
+        r[2 * k + 1] < rect[2 * d + 1])
+      return false;
+  }
+
+  return true;
+}
+
+Status Reader::set_subarray_to_ranges() {
+  auto coords_type = array_schema_->coords_type();
+  switch (coords_type) {
+    case Datatype::INT8:
+      return set_subarray_to_ranges<int8_t>();
+    case Datatype::UINT8:
+      return set_subarray_to_ranges<uint8_t>();
+    case Datatype::INT16:
+      return set_subarray_to_ranges<int16_t>();
+    case Datatype::UINT16:
+      return set_subarray_to_ranges<uint16_t>();
+    case Datatype::INT32:
+      return set_subarray_to_ranges<int>();
+    case Datatype::UINT32:
+      return set_subarray_to_ranges<unsigned>();
+    case Datatype::INT64:
+      return set_subarray_to_ranges<int64_t>();
+    case Datatype::UINT64:
+      return set_subarray_to_ranges<uint64_t>();
+    case Datatype::FLOAT32:
+      return set_subarray_to_ranges<float>();
+    case Datatype::FLOAT64:
+      return set_subarray_to_ranges<double>();
+    default:
+      return LOG_STATUS(Status::ReaderError(
+          "Cannot set subarray to ranges; Unsupported domain type"));
+  }
+
+  return Status::Ok();
+}
 
 template <class T>
-Status Reader::compute_overlapping_coords(
-    const OverlappingTileVec& tiles, OverlappingCoordsList<T>* coords) const {
-  STATS_FUNC_IN(reader_compute_overlapping_coords);
+Status Reader::set_subarray_to_ranges() {
+  if (ranges_.empty())
+    return Status::Ok();
 
-  for (const auto& tile : tiles) {
-    if (tile->full_overlap_) {
-      RETURN_NOT_OK(get_all_coords<T>(tile.get(), coords));
-    } else {
-      RETURN_NOT_OK(compute_overlapping_coords<T>(tile.get(), coords));
+  // The subarray becomes the bounding box of the ranges. A dimension
+  // without added ranges is constrained by the subarray.
+  auto dim_num = array_schema_->dim_num();
+  auto subarray = (T*)read_state_.subarray_;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (ranges_[d].empty())
+      continue;
+    auto r = (const T*)&ranges_[d][0];
+    auto range_num = ranges_[d].size() / (2 * sizeof(T));
+    subarray[2 * d] = r[0];
+    subarray[2 * d + 1] = r[1];
+    for (uint64_t i = 1; i < range_num; ++i) {
+      subarray[2 * d] = std::min(subarray[2 * d], r[2 * i]);
+      subarray[2 * d + 1] = std::max(subarray[2 * d + 1], r[2 * i + 1]);
     }
   }
 
   return Status::Ok();
-
-  STATS_FUNC_OUT(reader_compute_overlapping_coords);
 }
 
 template <class T>
-Status Reader::compute_overlapping_coords(
-    const OverlappingTile* tile, OverlappingCoordsList<T>* coords) const {
-  auto dim_num = array_schema_->dim_num();
-  const auto& t = tile->attr_tiles_.find(constants::coords)->second.first;
-  auto coords_num = t.cell_num();
-  auto subarray = (T*)read_state_.cur_subarray_partition_;
-  auto c = (T*)t.data();
+bool Reader::overlaps_fragments(
+    const OverlappingTile* tile,
+    const PartitionRanges<T>& ranges,
+    const std::vector<unsigned>& fragments) const {
+  if (fragments.empty())
+    return false;
 
-  for (uint64_t i = 0, pos = 0; i < coords_num; ++i, pos += dim_num) {
-    if (utils::geometry::coords_in_rect<T>(&c[pos], &subarray[0], dim_num))
-      coords->emplace_back(tile, &c[pos], i);
+  // For easy reference
+  auto dim_num = array_schema_->dim_num();
+  auto rect_size = 2 * dim_num;
+  const auto& meta = fragment_metadata_[tile->fragment_idx_];
+  auto mbr = (const T*)meta->mbrs()[tile->tile_idx_];
+
+  // Clip the MBR to the bounding box of the ranges
+  auto bbox = ranges_bounding_box(ranges);
+  if (bbox.empty())
+    return false;
+  std::vector<T> query(rect_size), overlap(rect_size);
+  bool overlaps;
+  utils::geometry::overlap(&bbox[0], mbr, dim_num, &query[0], &overlaps);
+  if (!overlaps)
+    return false;
+
+  // A tile of another fragment overlaps if the part of the clipped MBR
+  // that it covers falls in the ranges
+  std::vector<uint64_t> tile_ids;
+  for (auto f : fragments) {
+    const auto& mbrs = fragment_metadata_[f]->mbrs();
+    auto tile_overlap =
+        fragment_metadata_[f]->rtree().get_tile_overlap(&query[0]);
+    tile_ids.clear();
+    for (const auto& t : tile_overlap.tiles_)
+      tile_ids.push_back(t.first);
+    for (const auto& tr : tile_overlap.tile_ranges_) {
+      for (uint64_t j = tr.first; j <= tr.second; ++j)
+        tile_ids.push_back(j);
+    }
+    for (auto id : tile_ids) {
+      utils::geometry::overlap(
+          (const T*)mbrs[id], &query[0], dim_num, &overlap[0], &overlaps);
+      if (overlaps && overlaps_ranges(ranges, &overlap[0]))
+        return true;
+    }
   }
 
-  return Status::Ok();
+  return false;
 }
 
 template <class T>
-Status Reader::compute_overlapping_tiles(OverlappingTileVec* tiles) const {
-  STATS_FUNC_IN(reader_compute_overlapping_tiles);
+void Reader::skip_tiles_by_condition(OverlappingTileVec* tiles) const {
+  if (condition_.empty() || tiles->empty())
+    return;
 
   // For easy reference
-  auto subarray = (T*)read_state_.cur_subarray_partition_;
-  auto dim_num = array_schema_->dim_num();
-  auto fragment_num = fragment_metadata_.size();
-  bool full_overlap;
-
-  // Find overlapping tile indexes for each fragment
-  tiles->clear();
-  for (unsigned i = 0; i < fragment_num; ++i) {
-    // Applicable only to sparse fragments
-    if (fragment_metadata_[i]->dense())
-      continue;
+  auto ranges = compute_partition_ranges<T>();
+  std::vector<unsigned> fragments;
+  for (const auto& tile : *tiles) {
+    if (fragments.empty() || fragments.back() != tile->fragment_idx_)
+      fragments.push_back(tile->fragment_idx_);
+  }
 
-    auto mbrs = fragment_metadata_[i]->mbrs();
-    auto mbr_num = (uint64_t)mbrs.size();
-    for (uint64_t j = 0; j < mbr_num; ++j) {
-      if (utils::geometry::overlap(
-              &subarray[0], (const T*)(mbrs[j]), dim_num, &full_overlap)) {
-        auto tile = std::unique_ptr<OverlappingTile>(
-            new OverlappingTile(i, j, attributes_, full_overlap));
-        tiles->push_back(std::move(tile));
+  // A tile whose statistics show that none of its cells satisfies the
+  // condition can be skipped, unless its cells overwrite cells of older
+  // fragments (which would otherwise show up in the results)
+  OverlappingTileVec kept_tiles;
+  uint64_t skipped_num = 0;
+  for (auto& tile : *tiles) {
+    const auto& meta = fragment_metadata_[tile->fragment_idx_];
+    if (!condition_.may_match(array_schema_, meta, tile->tile_idx_)) {
+      std::vector<unsigned> older_fragments;
+      for (auto f : fragments) {
+        if (f < tile->fragment_idx_)
+          older_fragments.push_back(f);
+      }
+      if (!overlaps_fragments<T>(tile.get(), ranges, older_fragments)) {
+        ++skipped_num;
+        continue;
       }
     }
+    kept_tiles.push_back(std::move(tile));
   }
+  tiles->swap(kept_tiles);
 
-  return Status::Ok();
+  STATS_COUNTER_ADD(reader_num_tiles_skipped_by_condition, skipped_num);
+}
 
-  STATS_FUNC_OUT(reader_compute_overlapping_tiles);
+void Reader::skip_tiles_without_results(
+    const OverlappingCellRangeList& cell_ranges,
+    OverlappingTileVec* tiles) const {
+  std::unordered_set<const OverlappingTile*> result_tiles;
+  for (const auto& cr : cell_ranges)
+    result_tiles.insert(cr.tile_);
+
+  // The kept tiles do not move, since the cell ranges point to them
+  OverlappingTileVec kept_tiles;
+  uint64_t skipped_num = 0;
+  for (auto& tile : *tiles) {
+    if (result_tiles.count(tile.get()) == 0) {
+      ++skipped_num;
+      continue;
+    }
+    kept_tiles.push_back(std::move(tile));
+  }
+  tiles->swap(kept_tiles);
+
+  STATS_COUNTER_ADD(reader_num_tiles_skipped_by_coords, skipped_num);
+}
+
+template <class T>
+void Reader::split_conflicting_tiles(
+    OverlappingTileVec* tiles, OverlappingTileVec* conflicting_tiles) const {
+  if (single_fragment(*tiles))
+    return;
+
+  // For easy reference
+  auto ranges = compute_partition_ranges<T>();
+  std::vector<unsigned> fragments;
+  for (const auto& tile : *tiles) {
+    if (fragments.empty() || fragments.back() != tile->fragment_idx_)
+      fragments.push_back(tile->fragment_idx_);
+  }
+
+  // A tile conflicts if the part of its MBR inside the subarray overlaps
+  // with any tile of another fragment
+  OverlappingTileVec independent_tiles;
+  for (auto& tile : *tiles) {
+    auto other_fragments = fragments;
+    other_fragments.erase(std::find(
+        other_fragments.begin(), other_fragments.end(), tile->fragment_idx_));
+    if (overlaps_fragments<T>(tile.get(), ranges, other_fragments))
+      conflicting_tiles->push_back(std::move(tile));
+    else
+      independent_tiles.push_back(std::move(tile));
+  }
+  tiles->swap(independent_tiles);
 }
 
 template <class T>
@@ -985,7 +2199,9 @@ Status Reader::compute_tile_coords(
 }
 
 Status Reader::copy_cells(
-    const std::string& attribute, const OverlappingCellRangeList& cell_ranges) {
+    const std::string& attribute,
+    const OverlappingCellRangeList& cell_ranges,
+    const std::vector<OverlappingTileVec*>& tiles) {
   // Early exit for empty cell range list.
   if (cell_ranges.empty()) {
     zero_out_buffer_sizes();
@@ -994,11 +2210,229 @@ Status Reader::copy_cells(
 
   if (array_schema_->var_size(attribute))
     return copy_var_cells(attribute, cell_ranges);
-  return copy_fixed_cells(attribute, cell_ranges);
+  return copy_fixed_cells(attribute, cell_ranges, tiles);
+}
+
+bool Reader::copy_pending() const {
+  return !copy_state_.cell_ranges_.empty();
+}
+
+template <class T>
+Status Reader::copy_partition_cells(
+    OverlappingCellRangeList* cell_ranges, TilePipeline* pipeline) {
+  // Early exit for empty cell range list.
+  if (cell_ranges->empty()) {
+    zero_out_buffer_sizes();
+    return Status::Ok();
+  }
+
+  // The cells are copied first for the attributes whose tiles are ready,
+  // and then for the attributes streamed by the pipeline, in its order.
+  // Without a pipeline, the copy resumes from the copy state.
+  std::vector<std::string> copy_attributes;
+  std::vector<OverlappingTileVec*> tiles;
+  size_t ready_attr_num = attributes_.size();
+  if (pipeline == nullptr) {
+    copy_attributes = attributes_;
+    for (auto& state_tiles : copy_state_.tiles_)
+      tiles.push_back(&state_tiles);
+  } else {
+    tiles = pipeline->tiles_;
+    const auto& streamed = pipeline->attributes_;
+    for (const auto& attr : attributes_) {
+      if (std::find(streamed.begin(), streamed.end(), attr) == streamed.end())
+        copy_attributes.push_back(attr);
+    }
+    ready_attr_num = copy_attributes.size();
+    copy_attributes.insert(
+        copy_attributes.end(), streamed.begin(), streamed.end());
+
+    // The tiles of the var-sized attributes (which come first in the
+    // pipeline) are needed to compute the cells that fit
+    size_t var_attr_num = 0;
+    while (var_attr_num < streamed.size() &&
+           array_schema_->var_size(streamed[var_attr_num]))
+      ++var_attr_num;
+    RETURN_CANCEL_OR_ERROR(wait_tile_pipeline(pipeline, var_attr_num));
+  }
+
+  // Compute the number of cells that fit in all the buffers
+  auto dense = array_schema_->dense();
+  uint64_t cell_num = 0;
+  for (const auto& cr : *cell_ranges)
+    cell_num += cr.end_ - cr.start_ + 1;
+  auto fitting_cell_num = cell_num;
+  for (const auto& attr : attributes_)
+    fitting_cell_num =
+        compute_fitting_cell_num(attr, *cell_ranges, fitting_cell_num);
+
+  // Not even a single cell fits. If this is a new partition, the
+  // overflow will lead to splitting it. Otherwise, the state is kept
+  // so that the copy can be resumed with larger buffers.
+  if (fitting_cell_num == 0) {
+    if (copy_pending())
+      zero_out_buffer_sizes();
+    else
+      read_state_.overflowed_ = true;
+    return Status::Ok();
+  }
+
+  // Split the cell ranges at the last cell that fits
+  OverlappingCellRangeList remaining;
+  if (fitting_cell_num < cell_num) {
+    uint64_t cells = 0;
+    size_t i = 0;
+    for (; i < cell_ranges->size(); ++i) {
+      auto& cr = (*cell_ranges)[i];
+      auto range_cell_num = cr.end_ - cr.start_ + 1;
+      if (cells + range_cell_num > fitting_cell_num) {
+        auto split = cr.start_ + (fitting_cell_num - cells);
+        if (split > cr.start_) {
+          remaining.emplace_back(cr.tile_, split, cr.end_);
+          cr.end_ = split - 1;
+          ++i;
+        }
+        break;
+      }
+      cells += range_cell_num;
+    }
+    remaining.insert(
+        remaining.end(), cell_ranges->begin() + i, cell_ranges->end());
+    cell_ranges->erase(cell_ranges->begin() + i, cell_ranges->end());
+  }
+
+  // Copy cells
+  for (size_t i = 0; i < copy_attributes.size(); ++i) {
+    if (read_state_.overflowed_)
+      break;
+
+    // Dense coordinates are not stored in tiles
+    const auto& attr = copy_attributes[i];
+    if (dense && attr == constants::coords)
+      continue;
+
+    // Wait for the tiles of a streamed attribute
+    if (i >= ready_attr_num)
+      RETURN_CANCEL_OR_ERROR(
+          wait_tile_pipeline(pipeline, i - ready_attr_num + 1));
+
+    RETURN_CANCEL_OR_ERROR(copy_cells(attr, *cell_ranges, tiles));
+
+    // Release the tiles of a streamed attribute, unless they are needed
+    // to resume copying
+    if (i >= ready_attr_num && remaining.empty())
+      RETURN_CANCEL_OR_ERROR(
+          release_tile_pipeline_attribute(pipeline, i - ready_attr_num));
+  }
+
+  // Fill coordinates if the user requested them
+  if (!read_state_.overflowed_ && dense && has_coords())
+    RETURN_CANCEL_OR_ERROR(
+        fill_coords<T>(copy_state_.copied_cell_num_, fitting_cell_num));
+
+  // Update the copy state
+  copy_state_.cell_ranges_ = std::move(remaining);
+  if (copy_pending()) {
+    copy_state_.copied_cell_num_ += fitting_cell_num;
+  } else {
+    copy_state_.copied_cell_num_ = 0;
+    copy_state_.tiles_.clear();
+  }
+
+  return Status::Ok();
+}
+
+uint64_t Reader::compute_fitting_cell_num(
+    const std::string& attribute,
+    const OverlappingCellRangeList& cell_ranges,
+    uint64_t max_cell_num) const {
+  // For easy reference
+  auto it = attr_buffers_.find(attribute);
+  assert(it != attr_buffers_.end());
+  auto buffer_size = *(it->second.buffer_size_);
+
+  // Fixed-sized attribute - viewed results are bounded by the memory budget
+  if (!array_schema_->var_size(attribute)) {
+    auto cell_size = array_schema_->cell_size(attribute);
+    if (has_result_views(attribute))
+      buffer_size = memory_budget_;
+    return std::min(max_cell_num, buffer_size / cell_size);
+  }
+
+  // Var-sized attribute - both the offsets and the values must fit
+  auto buffer_var_size = *(it->second.buffer_var_size_);
+  auto fill_size = datatype_size(array_schema_->type(attribute));
+  auto offset_num = buffer_size / (var_offsets_bitsize_ / 8);
+  if (var_offsets_extra_element_)
+    offset_num = (offset_num > 0) ? offset_num - 1 : 0;
+  max_cell_num = std::min(max_cell_num, offset_num);
+  uint64_t cell_num = 0, total_var_size = 0;
+  for (const auto& cr : cell_ranges) {
+    // Get tile information, if the range is nonempty.
+    uint64_t* tile_offsets = nullptr;
+    uint64_t tile_cell_num = 0;
+    uint64_t tile_var_size = 0;
+    if (cr.tile_ != nullptr) {
+      const auto& tile_pair = cr.tile_->attr_tiles_.find(attribute)->second;
+      tile_offsets = (uint64_t*)tile_pair.first.data();
+      tile_cell_num = tile_pair.first.cell_num();
+      tile_var_size = tile_pair.second.size();
+    }
+
+    for (auto cell_idx = cr.start_; cell_idx <= cr.end_; cell_idx++) {
+      if (cell_num == max_cell_num)
+        return cell_num;
+
+      uint64_t cell_var_size = 0;
+      if (cr.tile_ == nullptr) {
+        cell_var_size = fill_size;
+      } else {
+        cell_var_size =
+            (cell_idx != tile_cell_num - 1) ?
+                tile_offsets[cell_idx + 1] - tile_offsets[cell_idx] :
+                tile_var_size - (tile_offsets[cell_idx] - tile_offsets[0]);
+      }
+      if (total_var_size + cell_var_size > buffer_var_size)
+        return cell_num;
+
+      total_var_size += cell_var_size;
+      ++cell_num;
+    }
+  }
+
+  return cell_num;
+}
+
+Status Reader::copy_prefetched_partition(PrefetchedPartition* partition) {
+  for (auto& it : attr_buffers_) {
+    auto& attr_buffer = it.second;
+    const auto& staging = partition->buffers_[it.first];
+    if (staging.buffer_size_ > attr_buffer.original_buffer_size_ ||
+        (attr_buffer.buffer_var_ != nullptr &&
+         staging.buffer_var_size_ > attr_buffer.original_buffer_var_size_))
+      return LOG_STATUS(Status::ReaderError(
+          std::string("Cannot copy prefetched results for attribute '") +
+          it.first + "'; User buffers are smaller than when the read started"));
+
+    std::memcpy(
+        attr_buffer.buffer_, staging.buffer_.data(), staging.buffer_size_);
+    *attr_buffer.buffer_size_ = staging.buffer_size_;
+    if (attr_buffer.buffer_var_ != nullptr) {
+      std::memcpy(
+          attr_buffer.buffer_var_,
+          staging.buffer_var_.data(),
+          staging.buffer_var_size_);
+      *attr_buffer.buffer_var_size_ = staging.buffer_var_size_;
+    }
+  }
+
+  return Status::Ok();
 }
 
 Status Reader::copy_fixed_cells(
-    const std::string& attribute, const OverlappingCellRangeList& cell_ranges) {
+    const std::string& attribute,
+    const OverlappingCellRangeList& cell_ranges,
+    const std::vector<OverlappingTileVec*>& tiles) {
   STATS_FUNC_IN(reader_copy_fixed_cells);
 
   // For easy reference
@@ -1022,38 +2456,65 @@ Status Reader::copy_fixed_cells(
     buffer_offset += bytes_to_copy;
   }
 
-  // Handle overflow
-  if (buffer_offset > *buffer_size) {
+  // Handle overflow. Viewed results are bounded by the memory budget
+  // instead of the buffer size.
+  auto viewed = has_result_views(attribute);
+  if (buffer_offset > (viewed ? memory_budget_ : *buffer_size)) {
     read_state_.overflowed_ = true;
     return Status::Ok();
   }
 
-  // Copy cell ranges in parallel.
-  auto statuses = parallel_for(0, num_cr, [&](uint64_t i) {
-    const auto& cr = cell_ranges[i];
-    uint64_t offset = cr_offsets[i];
-    // Check for overflow
-    auto bytes_to_copy = (cr.end_ - cr.start_ + 1) * cell_size;
-    assert(offset + bytes_to_copy <= *buffer_size);
-
-    // Copy
-    if (cr.tile_ == nullptr) {  // Empty range
-      auto fill_num = bytes_to_copy / fill_size;
-      for (uint64_t j = 0; j < fill_num; ++j) {
-        std::memcpy(buffer + offset, fill_value, fill_size);
-        offset += fill_size;
-      }
+  if (viewed)
+    return create_result_views(attribute, cell_ranges, tiles);
+
+  // Copies `bytes` bytes starting at cell `start` of the input tile (or
+  // the fill value if the tile is null) to `offset` in the buffer.
+  auto copy = [&](uint64_t offset,
+                  const OverlappingTile* tile,
+                  uint64_t start,
+                  uint64_t bytes) {
+    if (tile == nullptr) {  // Empty range
+      copy_kernels::fill(buffer + offset, bytes, fill_value, fill_size);
     } else {  // Non-empty range
-      const auto& tile = cr.tile_->attr_tiles_.find(attribute)->second.first;
-      auto data = (unsigned char*)tile.data();
-      std::memcpy(buffer + offset, data + cr.start_ * cell_size, bytes_to_copy);
+      const auto& attr_tile = tile->attr_tiles_.find(attribute)->second.first;
+      auto data = (unsigned char*)attr_tile.data();
+      std::memcpy(buffer + offset, data + start * cell_size, bytes);
     }
+  };
+
+  // Tiny cell ranges do not amortize the cost of a parallel task. Copy
+  // them serially instead, coalescing consecutive ranges that are either
+  // contiguous in the same tile or all empty into a single copy.
+  if (buffer_offset < num_cr * constants::copy_parallel_min_range_size) {
+    uint64_t i = 0;
+    while (i < num_cr) {
+      auto offset = cr_offsets[i];
+      const auto& first = cell_ranges[i];
+      auto end = first.end_;
+      auto bytes = (first.end_ - first.start_ + 1) * cell_size;
+      for (++i; i < num_cr; ++i) {
+        const auto& cr = cell_ranges[i];
+        if (cr.tile_ != first.tile_ ||
+            (cr.tile_ != nullptr && cr.start_ != end + 1))
+          break;
+        end = cr.end_;
+        bytes += (cr.end_ - cr.start_ + 1) * cell_size;
+      }
+      copy(offset, first.tile_, first.start_, bytes);
+    }
+  } else {
+    // Copy cell ranges in parallel.
+    auto statuses = parallel_for(0, num_cr, [&](uint64_t i) {
+      const auto& cr = cell_ranges[i];
+      auto bytes_to_copy = (cr.end_ - cr.start_ + 1) * cell_size;
+      assert(cr_offsets[i] + bytes_to_copy <= *buffer_size);
+      copy(cr_offsets[i], cr.tile_, cr.start_, bytes_to_copy);
+      return Status::Ok();
+    });
 
-    return Status::Ok();
-  });
-
-  for (auto st : statuses)
-    RETURN_NOT_OK(st);
+    for (auto st : statuses)
+      RETURN_NOT_OK(st);
+  }
 
   // Update buffer offsets
   *(attr_buffers_[attribute].buffer_size_) = buffer_offset;
@@ -1074,7 +2535,7 @@ Status Reader::copy_var_cells(
   auto buffer_var = (unsigned char*)it->second.buffer_var_;
   auto buffer_size = it->second.buffer_size_;
   auto buffer_var_size = it->second.buffer_var_size_;
-  uint64_t offset_size = constants::cell_var_offset_size;
+  uint64_t offset_size = var_offsets_bitsize_ / 8;
   auto type = array_schema_->type(attribute);
   auto fill_size = datatype_size(type);
   auto fill_value = constants::fill_value(type);
@@ -1093,11 +2554,20 @@ Status Reader::copy_var_cells(
       &total_var_size));
 
   // Check for overflow and return early (without copying) in that case.
-  if (total_offset_size > *buffer_size || total_var_size > *buffer_var_size) {
+  auto extra_offset_size = var_offsets_extra_element_ ? offset_size : 0;
+  if (total_offset_size + extra_offset_size > *buffer_size ||
+      total_var_size > *buffer_var_size) {
     read_state_.overflowed_ = true;
     return Status::Ok();
   }
 
+  // 32-bit offsets cannot address more than 4GB of values
+  if (offset_size == sizeof(uint32_t) &&
+      total_var_size > std::numeric_limits<uint32_t>::max())
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot copy var-sized cells; The values do not fit in the range of "
+        "32-bit offsets"));
+
   // Copy cell ranges in parallel.
   const auto num_cr = cell_ranges.size();
   auto statuses = parallel_for(0, num_cr, [&](uint64_t cr_idx) {
@@ -1128,7 +2598,12 @@ Status Reader::copy_var_cells(
       auto var_dest = buffer_var + var_offset;
 
       // Copy offset
-      std::memcpy(offset_dest, &var_offset, offset_size);
+      if (offset_size == sizeof(uint32_t)) {
+        auto var_offset_32 = (uint32_t)var_offset;
+        std::memcpy(offset_dest, &var_offset_32, offset_size);
+      } else {
+        std::memcpy(offset_dest, &var_offset, offset_size);
+      }
 
       // Copy variable-sized value
       if (cr.tile_ == nullptr) {
@@ -1152,6 +2627,17 @@ Status Reader::copy_var_cells(
   for (auto st : statuses)
     RETURN_NOT_OK(st);
 
+  // Append the total size of the values as the extra offset
+  if (var_offsets_extra_element_) {
+    if (offset_size == sizeof(uint32_t)) {
+      auto total_var_size_32 = (uint32_t)total_var_size;
+      std::memcpy(buffer + total_offset_size, &total_var_size_32, offset_size);
+    } else {
+      std::memcpy(buffer + total_offset_size, &total_var_size, offset_size);
+    }
+    total_offset_size += offset_size;
+  }
+
   // Update buffer offsets
   *(attr_buffers_[attribute].buffer_size_) = total_offset_size;
   *(attr_buffers_[attribute].buffer_var_size_) = total_var_size;
@@ -1163,6 +2649,81 @@ Status Reader::copy_var_cells(
   STATS_FUNC_OUT(reader_copy_var_cells);
 }
 
+Status Reader::create_result_views(
+    const std::string& attribute,
+    const OverlappingCellRangeList& cell_ranges,
+    const std::vector<OverlappingTileVec*>& tiles) {
+  // For easy reference
+  auto cell_size = array_schema_->cell_size(attribute);
+  auto type = array_schema_->type(attribute);
+  auto fill_size = datatype_size(type);
+  auto fill_value = constants::fill_value(type);
+  assert(fill_value != nullptr);
+
+  // The cell ranges only point to const tiles, so the tiles that are
+  // handed over are looked up among the tiles owned by this reader
+  std::unordered_map<const OverlappingTile*, OverlappingTile*> owned_tiles;
+  for (auto tile_vec : tiles) {
+    for (auto& tile : *tile_vec)
+      owned_tiles[tile.get()] = tile.get();
+  }
+
+  // All the empty ranges point into a single fill buffer, as large as the
+  // largest empty range
+  uint64_t fill_bytes = 0;
+  for (const auto& cr : cell_ranges) {
+    if (cr.tile_ == nullptr)
+      fill_bytes = std::max(fill_bytes, (cr.end_ - cr.start_ + 1) * cell_size);
+  }
+  std::shared_ptr<std::vector<unsigned char>> fill;
+  if (fill_bytes > 0) {
+    fill = std::make_shared<std::vector<unsigned char>>(fill_bytes);
+    for (uint64_t offset = 0; offset < fill_bytes; offset += fill_size)
+      std::memcpy(&(*fill)[offset], fill_value, fill_size);
+  }
+
+  auto& views = result_views_[attribute];
+  views.clear();
+  uint64_t size = 0;
+  for (const auto& cr : cell_ranges) {
+    auto bytes = (cr.end_ - cr.start_ + 1) * cell_size;
+    const unsigned char* data;
+    std::shared_ptr<void> handle;
+    if (cr.tile_ == nullptr) {  // Empty range
+      data = fill->data();
+      handle = fill;
+    } else {  // Non-empty range
+      // The decoded tile is handed over to the views the first time a
+      // view points into it
+      auto& tile = view_tiles_[std::make_pair(cr.tile_, attribute)];
+      if (tile == nullptr) {
+        auto owned_it = owned_tiles.find(cr.tile_);
+        if (owned_it == owned_tiles.end())
+          return LOG_STATUS(Status::ReaderError(
+              "Cannot create result views; Tile not owned by the reader"));
+        auto& attr_tiles = owned_it->second->attr_tiles_;
+        auto attr_it = attr_tiles.find(attribute);
+        tile = std::make_shared<Tile>(std::move(attr_it->second.first));
+      }
+      data = (const unsigned char*)tile->data() + cr.start_ * cell_size;
+      handle = tile;
+    }
+
+    // Extend the last view if the range continues it
+    if (!views.empty() && views.back().handle_ == handle &&
+        (const unsigned char*)views.back().data_ + views.back().size_ == data)
+      views.back().size_ += bytes;
+    else
+      views.emplace_back(data, bytes, std::move(handle));
+    size += bytes;
+  }
+
+  *(attr_buffers_[attribute].buffer_size_) = size;
+  STATS_COUNTER_ADD(reader_num_fixed_cell_bytes_viewed, size);
+
+  return Status::Ok();
+}
+
 Status Reader::compute_var_cell_destinations(
     const std::string& attribute,
     const OverlappingCellRangeList& cell_ranges,
@@ -1172,7 +2733,7 @@ Status Reader::compute_var_cell_destinations(
     uint64_t* total_var_size) const {
   // For easy reference
   auto num_cr = cell_ranges.size();
-  auto offset_size = constants::cell_var_offset_size;
+  uint64_t offset_size = var_offsets_bitsize_ / 8;
   auto type = array_schema_->type(attribute);
   auto fill_size = datatype_size(type);
 
@@ -1284,6 +2845,10 @@ template <class T>
 Status Reader::dense_read() {
   STATS_FUNC_IN(reader_dense_read);
 
+  // Resume copying the results of the current partition
+  if (copy_pending())
+    return copy_partition_cells<T>(&copy_state_.cell_ranges_);
+
   // For easy reference
   auto domain = array_schema_->domain();
   auto subarray_len = 2 * array_schema_->dim_num();
@@ -1292,15 +2857,18 @@ Status Reader::dense_read() {
   for (size_t i = 0; i < subarray_len; ++i)
     subarray[i] = ((T*)read_state_.cur_subarray_partition_)[i];
 
+  // Transform whole tiles into the results, if possible
+  bool done;
+  RETURN_CANCEL_OR_ERROR(dense_read_transform<T>(subarray, &done));
+  if (done)
+    return Status::Ok();
+
   // Get overlapping sparse tile indexes
   OverlappingTileVec sparse_tiles;
   RETURN_CANCEL_OR_ERROR(compute_overlapping_tiles<T>(&sparse_tiles));
 
-  // Read sparse tiles
-  RETURN_CANCEL_OR_ERROR(read_all_tiles(&sparse_tiles));
-
-  // Filter sparse tiles
-  RETURN_CANCEL_OR_ERROR(filter_all_tiles(&sparse_tiles));
+  // Read the coordinate tiles of the sparse fragments
+  RETURN_CANCEL_OR_ERROR(read_all_tiles({constants::coords}, &sparse_tiles));
 
   // Compute the read coordinates for all sparse fragments
   OverlappingCoordsList<T> coords;
@@ -1310,9 +2878,11 @@ Status Reader::dense_read() {
   std::unique_ptr<T[]> tile_coords(nullptr);
   RETURN_CANCEL_OR_ERROR(compute_tile_coords<T>(&tile_coords, &coords));
 
-  // Sort and dedup the coordinates (not applicable to the global order
-  // layout for a single fragment)
-  if (!(fragment_metadata_.size() == 1 && layout_ == Layout::GLOBAL_ORDER)) {
+  // Sort and dedup the coordinates. The fragments are already sorted in
+  // the global order, so for that layout it suffices to merge them.
+  if (layout_ == Layout::GLOBAL_ORDER) {
+    RETURN_CANCEL_OR_ERROR(merge_coords<T>(&coords));
+  } else {
     RETURN_CANCEL_OR_ERROR(sort_coords<T>(&coords));
     RETURN_CANCEL_OR_ERROR(dedup_coords<T>(&coords));
   }
@@ -1326,19 +2896,39 @@ Status Reader::dense_read() {
   RETURN_CANCEL_OR_ERROR(init_tile_fragment_dense_cell_range_iters(
       &dense_frag_its, &overlapping_tile_idx_coords));
 
-  // Get the cell ranges
+  // Get the cell ranges. If the query layout is the cell order, the cell
+  // ranges of each tile are requested in increasing positions, so they
+  // are cut from runs resolved once per tile
+  auto layout =
+      (layout_ == Layout::GLOBAL_ORDER) ? array_schema_->cell_order() : layout_;
+  auto same_layout = (layout == array_schema_->cell_order());
+  std::vector<DenseTileRuns> tile_runs(same_layout ? dense_frag_its.size() : 0);
   std::list<DenseCellRange<T>> dense_cell_ranges;
   DenseCellRangeIter<T> it(domain, subarray, layout_);
   RETURN_CANCEL_OR_ERROR(it.begin());
   while (!it.end()) {
     auto o_it = overlapping_tile_idx_coords.find(it.tile_idx());
     assert(o_it != overlapping_tile_idx_coords.end());
-    RETURN_CANCEL_OR_ERROR(compute_dense_cell_ranges<T>(
-        &(o_it->second.second)[0],
-        dense_frag_its[o_it->second.first],
-        it.range_start(),
-        it.range_end(),
-        &dense_cell_ranges));
+    auto tile_coords = &(o_it->second.second)[0];
+    auto& frag_its = dense_frag_its[o_it->second.first];
+    if (same_layout) {
+      auto& runs = tile_runs[o_it->second.first];
+      if (!runs.computed_)
+        RETURN_CANCEL_OR_ERROR(compute_dense_tile_runs<T>(frag_its, &runs));
+      RETURN_CANCEL_OR_ERROR(compute_dense_cell_ranges<T>(
+          tile_coords,
+          &runs,
+          it.range_start(),
+          it.range_end(),
+          &dense_cell_ranges));
+    } else {
+      RETURN_CANCEL_OR_ERROR(compute_dense_cell_ranges<T>(
+          tile_coords,
+          frag_its,
+          it.range_start(),
+          it.range_end(),
+          &dense_cell_ranges));
+    }
     ++it;
   }
 
@@ -1351,32 +2941,167 @@ Status Reader::dense_read() {
   dense_cell_ranges.clear();
   overlapping_tile_idx_coords.clear();
 
-  // Read dense tiles
-  RETURN_CANCEL_OR_ERROR(read_all_tiles(&dense_tiles, false));
+  // Stream the attribute tiles of both the sparse and dense fragments
+  TilePipeline pipeline;
+  RETURN_CANCEL_OR_ERROR(init_tile_pipeline(
+      pipeline_attributes(), {&sparse_tiles, &dense_tiles}, &pipeline));
+
+  // Copy cells, as the attribute tiles become ready, and fill coordinates
+  RETURN_CANCEL_OR_ERROR(
+      copy_partition_cells<T>(&overlapping_cell_ranges, &pipeline));
+
+  // Keep the tiles if the rest of the results will be copied later
+  if (copy_pending()) {
+    copy_state_.tiles_.push_back(std::move(sparse_tiles));
+    copy_state_.tiles_.push_back(std::move(dense_tiles));
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_dense_read);
+}
+
+template <class T>
+Status Reader::dense_read_transform(
+    const std::vector<T>& subarray, bool* done) {
+  STATS_FUNC_IN(reader_dense_read_transform);
+
+  *done = false;
+  if ((layout_ != Layout::ROW_MAJOR && layout_ != Layout::COL_MAJOR) ||
+      !condition_.empty() || result_views_enabled_)
+    return Status::Ok();
+
+  // For easy reference
+  auto domain = array_schema_->domain();
+  auto dim_num = domain->dim_num();
+  auto fragment_num = (int)fragment_metadata_.size();
+  auto cell_num = domain->cell_num<T>(&subarray[0]);
+
+  // All the results must fit in the buffers
+  for (const auto& attr : attributes_) {
+    if (array_schema_->var_size(attr))
+      return Status::Ok();
+    auto buffer_size = *(attr_buffers_.find(attr)->second.buffer_size_);
+    if (cell_num * array_schema_->cell_size(attr) > buffer_size)
+      return Status::Ok();
+  }
+
+  // Find the single dense fragment that provides the results of each
+  // overlapping space tile
+  std::vector<T> tile_domain(2 * dim_num), tile_coords(dim_num);
+  domain->get_tile_domain(&subarray[0], &tile_domain[0]);
+  for (unsigned i = 0; i < dim_num; ++i)
+    tile_coords[i] = tile_domain[2 * i];
+  auto tile_num = domain->tile_num<T>(&subarray[0]);
+  std::vector<T> tile_subarray(2 * dim_num), subarray_in_tile(2 * dim_num);
+  std::vector<std::vector<T>> tile_lows, rects;
+  OverlappingTileVec tiles;
+  bool tile_overlap, contains, in;
+  for (uint64_t i = 0; i < tile_num; ++i) {
+    domain->get_tile_subarray(&tile_coords[0], &tile_subarray[0]);
+    utils::geometry::overlap(
+        &subarray[0],
+        &tile_subarray[0],
+        dim_num,
+        &subarray_in_tile[0],
+        &tile_overlap);
+    assert(tile_overlap);
+
+    // The most recent fragment overlapping the tile must cover it
+    int owner = -1;
+    for (int f = fragment_num - 1; f >= 0 && owner == -1; --f) {
+      auto frag_domain = (const T*)fragment_metadata_[f]->non_empty_domain();
+      if (!utils::geometry::overlap(
+              frag_domain, &subarray_in_tile[0], dim_num, &contains))
+        continue;
+      if (!fragment_metadata_[f]->dense() || !contains)
+        return Status::Ok();
+      owner = f;
+    }
+    if (owner == -1)
+      return Status::Ok();
+
+    auto tile_idx = fragment_metadata_[owner]->get_tile_pos(&tile_coords[0]);
+    tiles.emplace_back(
+        new OverlappingTile((unsigned)owner, tile_idx, attributes_, true));
+    rects.push_back(subarray_in_tile);
+    std::vector<T> tile_low(dim_num);
+    for (unsigned d = 0; d < dim_num; ++d)
+      tile_low[d] = tile_subarray[2 * d];
+    tile_lows.push_back(std::move(tile_low));
 
-  // Filter dense tiles
-  RETURN_CANCEL_OR_ERROR(filter_all_tiles(&dense_tiles, false));
+    domain->get_next_tile_coords(&tile_domain[0], &tile_coords[0], &in);
+  }
 
-  // Copy cells
-  for (const auto& attr : attributes_) {
-    if (read_state_.overflowed_)
-      break;
+  // Compute the strides (in cells) of the tiles in the cell order, and
+  // of the results in the query layout
+  std::vector<uint64_t> tile_strides(dim_num), result_strides(dim_num);
+  auto tile_extents = (const T*)domain->tile_extents();
+  auto cell_order = array_schema_->cell_order();
+  uint64_t tile_stride = 1, result_stride = 1;
+  for (unsigned i = 0; i < dim_num; ++i) {
+    auto t = (cell_order == Layout::ROW_MAJOR) ? dim_num - i - 1 : i;
+    auto r = (layout_ == Layout::ROW_MAJOR) ? dim_num - i - 1 : i;
+    tile_strides[t] = tile_stride;
+    tile_stride *= (uint64_t)tile_extents[t];
+    result_strides[r] = result_stride;
+    result_stride *= (uint64_t)(subarray[2 * r + 1] - subarray[2 * r] + 1);
+  }
+
+  // Stream the attribute tiles and transform them into the results
+  TilePipeline pipeline;
+  RETURN_CANCEL_OR_ERROR(
+      init_tile_pipeline(pipeline_attributes(), {&tiles}, &pipeline));
+  const auto& streamed = pipeline.attributes_;
+  for (size_t a = 0; a < streamed.size(); ++a) {
+    RETURN_CANCEL_OR_ERROR(wait_tile_pipeline(&pipeline, a + 1));
+    const auto& attr = streamed[a];
+    auto buffer = (unsigned char*)attr_buffers_.find(attr)->second.buffer_;
+    auto cell_size = array_schema_->cell_size(attr);
+    auto statuses = parallel_for(0, tiles.size(), [&](uint64_t i) {
+      const auto& rect = rects[i];
+      const auto& tile_low = tile_lows[i];
+      uint64_t src_pos = 0, dst_pos = 0;
+      std::vector<uint64_t> extents(dim_num);
+      for (unsigned d = 0; d < dim_num; ++d) {
+        src_pos += (uint64_t)(rect[2 * d] - tile_low[d]) * tile_strides[d];
+        dst_pos += (uint64_t)(rect[2 * d] - subarray[2 * d]) *
+                   result_strides[d];
+        extents[d] = (uint64_t)(rect[2 * d + 1] - rect[2 * d] + 1);
+      }
+      const auto& tile = tiles[i]->attr_tiles_.find(attr)->second.first;
+      copy_kernels::copy_box(
+          (const unsigned char*)tile.data() + src_pos * cell_size,
+          tile_strides,
+          buffer + dst_pos * cell_size,
+          result_strides,
+          extents,
+          cell_size);
+      return Status::Ok();
+    });
+    for (auto st : statuses)
+      RETURN_NOT_OK(st);
 
-    if (attr != constants::coords)  // Skip coordinates
-      RETURN_CANCEL_OR_ERROR(copy_cells(attr, overlapping_cell_ranges));
+    RETURN_CANCEL_OR_ERROR(release_tile_pipeline_attribute(&pipeline, a));
+    *(attr_buffers_[attr].buffer_size_) = cell_num * cell_size;
+    STATS_COUNTER_ADD(
+        reader_num_fixed_cell_bytes_copied, cell_num * cell_size);
   }
 
   // Fill coordinates if the user requested them
-  if (!read_state_.overflowed_ && has_coords())
-    RETURN_CANCEL_OR_ERROR(fill_coords<T>());
+  if (has_coords())
+    RETURN_CANCEL_OR_ERROR(fill_coords<T>(0, cell_num));
 
+  STATS_COUNTER_ADD(reader_num_tiles_transformed, tiles.size());
+  *done = true;
   return Status::Ok();
 
-  STATS_FUNC_OUT(reader_dense_read);
+  STATS_FUNC_OUT(reader_dense_read_transform);
 }
 
 template <class T>
-Status Reader::fill_coords() {
+typename std::enable_if<std::is_integral<T>::value, Status>::type
+Reader::fill_coords(uint64_t start, uint64_t num) {
   STATS_FUNC_IN(reader_fill_coords);
 
   // For easy reference
@@ -1387,18 +3112,33 @@ Status Reader::fill_coords() {
   auto coords_buff_size = *(it->second.buffer_size_);
   auto domain = array_schema_->domain();
   auto cell_order = array_schema_->cell_order();
-  auto subarray_len = 2 * array_schema_->dim_num();
+  auto dim_num = array_schema_->dim_num();
+  auto subarray_len = 2 * dim_num;
   auto coords_size = array_schema_->coords_size();
+  auto row_slabs =
+      layout_ == Layout::ROW_MAJOR ||
+      (layout_ == Layout::GLOBAL_ORDER && cell_order == Layout::ROW_MAJOR);
   std::vector<T> subarray;
   subarray.resize(subarray_len);
   for (size_t i = 0; i < subarray_len; ++i)
     subarray[i] = ((T*)read_state_.cur_subarray_partition_)[i];
 
   // Iterate over all coordinates, retrieved in cell slabs
+  std::vector<T> slab_start(dim_num);
+  uint64_t cell_pos = 0, end = start + num;
   DenseCellRangeIter<T> cell_it(domain, subarray, layout_);
   RETURN_CANCEL_OR_ERROR(cell_it.begin());
-  while (!cell_it.end()) {
-    auto coords_num = cell_it.range_end() - cell_it.range_start() + 1;
+  while (!cell_it.end() && cell_pos < end) {
+    auto slab_cell_num = cell_it.range_end() - cell_it.range_start() + 1;
+
+    // Skip the cells whose coordinates have already been filled
+    if (cell_pos + slab_cell_num <= start) {
+      cell_pos += slab_cell_num;
+      ++cell_it;
+      continue;
+    }
+    auto skip = (start > cell_pos) ? start - cell_pos : 0;
+    auto coords_num = std::min(slab_cell_num - skip, end - cell_pos - skip);
 
     // Check for overflow
     if (coords_num * coords_size + coords_buff_offset > coords_buff_size) {
@@ -1406,13 +3146,17 @@ Status Reader::fill_coords() {
       return Status::Ok();
     }
 
-    if (layout_ == Layout::ROW_MAJOR ||
-        (layout_ == Layout::GLOBAL_ORDER && cell_order == Layout::ROW_MAJOR))
+    std::memcpy(&slab_start[0], cell_it.coords_start(), coords_size);
+    if (row_slabs) {
+      slab_start[dim_num - 1] += skip;
       fill_coords_row_slab(
-          cell_it.coords_start(), coords_num, coords_buff, &coords_buff_offset);
-    else
+          &slab_start[0], coords_num, coords_buff, &coords_buff_offset);
+    } else {
+      slab_start[0] += skip;
       fill_coords_col_slab(
-          cell_it.coords_start(), coords_num, coords_buff, &coords_buff_offset);
+          &slab_start[0], coords_num, coords_buff, &coords_buff_offset);
+    }
+    cell_pos += slab_cell_num;
     ++cell_it;
   }
 
@@ -1472,87 +3216,86 @@ void Reader::fill_coords_col_slab(
   }
 }
 
-Status Reader::filter_all_tiles(
-    OverlappingTileVec* tiles, bool ensure_coords) const {
-  if (tiles->empty())
-    return Status::Ok();
-
-  // Prepare attributes
-  std::set<std::string> all_attributes;
-  for (const auto& attr : attributes_) {
-    if (array_schema_->dense() && attr == constants::coords)
-      continue;  // Skip coords in dense case - no actual tiles to filter
-    all_attributes.insert(attr);
-  }
-
-  // Make sure the coordinate tiles are filtered if specified.
-  if (ensure_coords)
-    all_attributes.insert(constants::coords);
-
-  // Filter the tiles in parallel over the attributes.
-  auto statuses = parallel_for_each(
-      all_attributes.begin(),
-      all_attributes.end(),
-      [this, &tiles](const std::string& attr) {
-        RETURN_CANCEL_OR_ERROR(filter_tiles(attr, tiles));
-        return Status::Ok();
-      });
-
-  for (const auto& st : statuses)
-    RETURN_CANCEL_OR_ERROR(st);
-
-  return Status::Ok();
-}
-
-Status Reader::filter_tiles(
-    const std::string& attribute, OverlappingTileVec* tiles) const {
-  STATS_FUNC_IN(reader_filter_tiles);
+Status Reader::fetch_tiles(
+    const std::string& attribute,
+    const std::vector<OverlappingTile*>& tiles,
+    std::list<Buffer>* buffers) const {
+  STATS_FUNC_IN(reader_fetch_tiles);
 
+  // For easy reference
   auto var_size = array_schema_->var_size(attribute);
-  auto num_tiles = static_cast<uint64_t>(tiles->size());
-  auto statuses = parallel_for(0, num_tiles, [&, this](uint64_t i) {
-    auto& tile = (*tiles)[i];
-    auto it = tile->attr_tiles_.find(attribute);
-    // Skip non-existent attributes (e.g. coords in the dense case).
-    if (it == tile->attr_tiles_.end())
-      return Status::Ok();
-
-    // Get information about the tile in its fragment
-    auto& fragment = fragment_metadata_[tile->fragment_idx_];
-    auto tile_attr_uri = fragment->attr_uri(attribute);
-    auto tile_attr_offset = fragment->file_offset(attribute, tile->tile_idx_);
-
-    auto& tile_pair = it->second;
+  auto& fragment = fragment_metadata_[tiles.front()->fragment_idx_];
+
+  // Try the cache first, and collect the byte ranges of the tiles that
+  // must be read from storage
+  std::vector<ByteRange> ranges, var_ranges;
+  std::vector<Tile*> range_tiles, var_range_tiles;
+  bool cache_hit;
+  for (auto tile : tiles) {
+    assert(tile->fragment_idx_ == tiles.front()->fragment_idx_);
+    auto& tile_pair = tile->attr_tiles_.find(attribute)->second;
     auto& t = tile_pair.first;
     auto& t_var = tile_pair.second;
-
-    if (!t.filtered()) {
-      // Decompress, etc.
-      RETURN_NOT_OK(filter_tile(attribute, &t, var_size));
-      RETURN_NOT_OK(storage_manager_->write_to_cache(
-          tile_attr_uri, tile_attr_offset, t.buffer()));
+    auto tile_attr_uri = fragment->attr_uri(attribute);
+    auto tile_attr_offset = fragment->file_offset(attribute, tile->tile_idx_);
+    auto tile_size = fragment->tile_size(attribute, tile->tile_idx_);
+    auto tile_persisted_size =
+        fragment->persisted_tile_size(attribute, tile->tile_idx_);
+
+    RETURN_NOT_OK(storage_manager_->read_from_cache(
+        tile_attr_uri, tile_attr_offset, t.buffer(), tile_size, &cache_hit));
+    if (cache_hit) {
+      t.set_filtered(true);
+      STATS_COUNTER_ADD(reader_attr_tile_cache_hits, 1);
+    } else {
+      ranges.emplace_back(tile_attr_offset, tile_persisted_size);
+      range_tiles.push_back(&t);
+      STATS_COUNTER_ADD_IF(
+          !var_size, reader_num_fixed_cell_bytes_read, tile_persisted_size);
     }
 
-    if (var_size && !t_var.filtered()) {
+    if (var_size) {
       auto tile_attr_var_uri = fragment->attr_var_uri(attribute);
       auto tile_attr_var_offset =
           fragment->file_var_offset(attribute, tile->tile_idx_);
+      auto tile_var_size = fragment->tile_var_size(attribute, tile->tile_idx_);
+      auto tile_var_persisted_size =
+          fragment->persisted_tile_var_size(attribute, tile->tile_idx_);
 
-      // Decompress, etc.
-      RETURN_NOT_OK(filter_tile(attribute, &t_var, false));
-      RETURN_NOT_OK(storage_manager_->write_to_cache(
-          tile_attr_var_uri, tile_attr_var_offset, t_var.buffer()));
+      RETURN_NOT_OK(storage_manager_->read_from_cache(
+          tile_attr_var_uri,
+          tile_attr_var_offset,
+          t_var.buffer(),
+          tile_var_size,
+          &cache_hit));
+      if (cache_hit) {
+        t_var.set_filtered(true);
+        STATS_COUNTER_ADD(reader_attr_tile_cache_hits, 1);
+      } else {
+        var_ranges.emplace_back(tile_attr_var_offset, tile_var_persisted_size);
+        var_range_tiles.push_back(&t_var);
+        STATS_COUNTER_ADD(
+            reader_num_var_cell_bytes_read,
+            fragment->persisted_tile_size(attribute, tile->tile_idx_));
+        STATS_COUNTER_ADD(
+            reader_num_var_cell_bytes_read, tile_var_persisted_size);
+      }
     }
+  }
 
-    return Status::Ok();
-  });
-
-  for (const auto& st : statuses)
-    RETURN_CANCEL_OR_ERROR(st);
+  // Read the rest of the tiles from storage
+  RETURN_NOT_OK(read_tile_ranges(
+      fragment->attr_uri(attribute), ranges, range_tiles, buffers));
+  if (var_size)
+    RETURN_NOT_OK(read_tile_ranges(
+        fragment->attr_var_uri(attribute),
+        var_ranges,
+        var_range_tiles,
+        buffers));
 
   return Status::Ok();
 
-  STATS_FUNC_OUT(reader_filter_tiles);
+  STATS_FUNC_OUT(reader_fetch_tiles);
 }
 
 Status Reader::filter_tile(
@@ -1660,6 +3403,37 @@ bool Reader::has_coords() const {
   return attr_buffers_.find(constants::coords) != attr_buffers_.end();
 }
 
+bool Reader::has_result_views(const std::string& attribute) const {
+  // Dense coordinates are not stored in tiles and are always filled in
+  return result_views_enabled_ && !array_schema_->var_size(attribute) &&
+         !(array_schema_->dense() && attribute == constants::coords);
+}
+
+Status Reader::init_prefetched_partition(PrefetchedPartition* partition) {
+  // The reader shares the array, fragments and constraints of this reader,
+  // but covers only the current partition
+  auto reader = new Reader();
+  partition->reader_.reset(reader);
+  reader->set_storage_manager(storage_manager_);
+  reader->set_array(array_);
+  reader->set_array_schema(array_schema_);
+  reader->set_fragment_metadata(fragment_metadata_);
+  reader->layout_ = layout_;
+  reader->condition_ = condition_;
+  reader->ranges_ = ranges_;
+
+  RETURN_NOT_OK(set_staging_buffers(partition));
+  RETURN_NOT_OK(reader->set_subarray(read_state_.cur_subarray_partition_));
+  RETURN_NOT_OK(reader->init());
+
+  // The partition reader reads directly into the staging buffers
+  reader->read_prefetch_partitions_ = 0;
+  reader->var_offsets_bitsize_ = var_offsets_bitsize_;
+  reader->var_offsets_extra_element_ = var_offsets_extra_element_;
+
+  return Status::Ok();
+}
+
 Status Reader::init_read_state() {
   auto subarray_size = 2 * array_schema_->coords_size();
   read_state_.cur_subarray_partition_ = std::malloc(subarray_size);
@@ -1667,13 +3441,36 @@ Status Reader::init_read_state() {
     return LOG_STATUS(Status::ReaderError(
         "Cannot initialize read state; Memory allocation failed"));
 
-  auto first_partition = std::malloc(subarray_size);
-  if (first_partition == nullptr)
-    return LOG_STATUS(Status::ReaderError(
-        "Cannot initialize read state; Memory allocation failed"));
+  // Prepare buffer sizes map. The partitioner estimates the offsets as
+  // 64-bit values without the extra element, so the size of an offsets
+  // buffer is converted to the size of the offsets it fits in that format.
+  // Viewed results are not copied into the buffers, so the memory budget
+  // takes the place of their buffer size.
+  std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>
+      buffer_sizes_map;
+  uint64_t offset_size = var_offsets_bitsize_ / 8;
+  for (const auto& it : attr_buffers_) {
+    auto buffer_size = it.second.original_buffer_size_;
+    if (has_result_views(it.first)) {
+      buffer_size = memory_budget_;
+    } else if (array_schema_->var_size(it.first)) {
+      auto offset_num = buffer_size / offset_size;
+      if (var_offsets_extra_element_)
+        offset_num = (offset_num > 0) ? offset_num - 1 : 0;
+      buffer_size = offset_num * constants::cell_var_offset_size;
+    }
+    buffer_sizes_map[it.first] = std::pair<uint64_t, uint64_t>(
+        buffer_size, it.second.original_buffer_var_size_);
+  }
 
-  std::memcpy(first_partition, read_state_.subarray_, subarray_size);
-  read_state_.subarray_partitions_.push_back(first_partition);
+  read_state_.partitioner_.set_memory_budget(
+      memory_budget_, memory_budget_var_);
+  RETURN_NOT_OK(read_state_.partitioner_.init(
+      array_schema_,
+      fragment_metadata_,
+      read_state_.subarray_,
+      layout_,
+      buffer_sizes_map));
 
   RETURN_NOT_OK(next_subarray_partition());
 
@@ -1813,151 +3610,385 @@ Status Reader::init_tile_fragment_dense_cell_range_iters(
   STATS_FUNC_OUT(reader_init_tile_fragment_dense_cell_range_iters);
 }
 
+Status Reader::init_tile_pipeline(
+    const std::vector<std::string>& attributes,
+    const std::vector<OverlappingTileVec*>& tiles,
+    TilePipeline* pipeline) const {
+  pipeline->attributes_ = attributes;
+  pipeline->tiles_ = tiles;
+  pipeline->budget_ = std::min(read_inflight_size_, memory_budget_);
+  pipeline->unfiltered_bytes_.assign(attributes.size(), 0);
+
+  return issue_tile_fetches(pipeline);
+}
+
+Status Reader::issue_tile_fetches(TilePipeline* pipeline) const {
+  auto thread_pool = storage_manager_->reader_thread_pool();
+  auto attr_num = pipeline->attributes_.size();
+  while (pipeline->next_attr_ < attr_num) {
+    // Move on to the next tile vector or attribute
+    if (pipeline->next_vec_ == pipeline->tiles_.size()) {
+      ++pipeline->next_attr_;
+      pipeline->next_vec_ = 0;
+      continue;
+    }
+    auto tiles = pipeline->tiles_[pipeline->next_vec_];
+    if (pipeline->next_tile_ == tiles->size()) {
+      ++pipeline->next_vec_;
+      pipeline->next_tile_ = 0;
+      continue;
+    }
+
+    // Group the next tiles of the same fragment into a single fetch, so
+    // that their reads can be coalesced
+    const auto& attribute = pipeline->attributes_[pipeline->next_attr_];
+    auto var_size = array_schema_->var_size(attribute);
+    std::vector<OverlappingTile*> group;
+    uint64_t group_bytes = 0;
+    while (pipeline->next_tile_ < tiles->size()) {
+      auto tile = (*tiles)[pipeline->next_tile_].get();
+      if (!group.empty() && tile->fragment_idx_ != group[0]->fragment_idx_)
+        break;
+      auto it = tile->attr_tiles_.find(attribute);
+      if (it == tile->attr_tiles_.end()) {
+        return LOG_STATUS(Status::ReaderError(
+            "Invalid tile map for attribute " + attribute));
+      }
+      auto& fragment = fragment_metadata_[tile->fragment_idx_];
+      auto bytes = fragment->persisted_tile_size(attribute, tile->tile_idx_);
+      if (var_size)
+        bytes += fragment->persisted_tile_var_size(attribute, tile->tile_idx_);
+
+      // Stop if the tile does not fit in the group or the in-flight budget
+      if (!group.empty() && group_bytes + bytes > read_planner_.max_size())
+        break;
+      if ((!group.empty() || !pipeline->fetches_.empty()) &&
+          pipeline->inflight_bytes_ + group_bytes + bytes > pipeline->budget_)
+        break;
+
+      // Initialize the tile(s)
+      auto& t = it->second.first;
+      auto& t_var = it->second.second;
+      auto format_version = fragment->format_version();
+      if (!var_size) {
+        RETURN_NOT_OK(init_tile(format_version, attribute, &t));
+      } else {
+        RETURN_NOT_OK(init_tile(format_version, attribute, &t, &t_var));
+      }
+
+      group.push_back(tile);
+      group_bytes += bytes;
+      ++pipeline->next_tile_;
+    }
+
+    // Defer the fetches that do not fit in the in-flight budget
+    if (group.empty()) {
+      STATS_COUNTER_ADD(reader_num_tile_pipeline_stalls, 1);
+      break;
+    }
+
+    // Enqueue the fetch in the reader thread pool
+    std::unique_ptr<std::list<Buffer>> buffers(new std::list<Buffer>());
+    auto buffers_ptr = buffers.get();
+    auto task = thread_pool->enqueue([&attribute, group, buffers_ptr, this]() {
+      return fetch_tiles(attribute, group, buffers_ptr);
+    });
+    pipeline->inflight_bytes_ += group_bytes;
+    STATS_GAUGE_ADD(reader_inflight_tile_bytes, group_bytes);
+    STATS_COUNTER_ADD(reader_num_attr_tiles_touched, group.size());
+    pipeline->fetches_.push_back(TilePipeline::Fetch{pipeline->next_attr_,
+                                                     std::move(group),
+                                                     group_bytes,
+                                                     std::move(buffers),
+                                                     std::move(task)});
+  }
+
+  return Status::Ok();
+}
+
 void Reader::optimize_layout_for_1D() {
   if (array_schema_->dim_num() == 1)
     layout_ = Layout::GLOBAL_ORDER;
 }
 
-Status Reader::read_all_tiles(
-    OverlappingTileVec* tiles, bool ensure_coords) const {
-  STATS_FUNC_IN(reader_read_all_tiles);
+template <class T>
+Status Reader::merge_coords(OverlappingCoordsList<T>* coords) const {
+  STATS_FUNC_IN(reader_merge_coords);
+
+  // The overlapping tiles are computed per fragment in ascending tile
+  // order, therefore the coordinates of each fragment form a contiguous
+  // run that is already sorted in the global order
+  std::vector<std::pair<uint64_t, uint64_t>> runs;
+  auto coords_num = (uint64_t)coords->size();
+  for (uint64_t i = 0; i < coords_num; ++i) {
+    if (i == 0 || (*coords)[i].tile_->fragment_idx_ !=
+                      (*coords)[i - 1].tile_->fragment_idx_)
+      runs.emplace_back(i, i + 1);
+    else
+      runs.back().second = i + 1;
+  }
 
-  // Shortcut for empty tile vec
-  if (tiles->empty())
+  // Nothing to merge
+  if (runs.size() <= 1)
     return Status::Ok();
 
-  // Prepare attributes
-  std::set<std::string> all_attributes;
+  // Under the Hilbert cell order, compute the Hilbert keys once, rather
+  // than on every comparison
+  auto domain = array_schema_->domain();
+  std::vector<uint64_t> hilbert_keys;
+  if (domain->cell_order() == Layout::HILBERT) {
+    hilbert_keys.resize(coords_num);
+    for (uint64_t i = 0; i < coords_num; ++i)
+      hilbert_keys[i] = domain->hilbert_key((*coords)[i].coords_);
+  }
+
+  // Returns `true` if the i-th coordinates precede the j-th ones
+  GlobalCmp<T> cmp(domain);
+  auto less = [&](uint64_t i, uint64_t j) {
+    const auto& coords_i = (*coords)[i];
+    const auto& coords_j = (*coords)[j];
+    if (hilbert_keys.empty())
+      return cmp(coords_i, coords_j);
+    auto tile_cmp = domain->tile_order_cmp_tile_coords<T>(
+        coords_i.tile_coords_, coords_j.tile_coords_);
+    if (tile_cmp != 0)
+      return tile_cmp == -1;
+    return domain->hilbert_order_cmp(
+               coords_i.coords_,
+               hilbert_keys[i],
+               coords_j.coords_,
+               hilbert_keys[j]) == -1;
+  };
+
+  // Heap on the run heads, with the smallest coordinates on top. Among
+  // equal coordinates, the most recent fragment comes first.
+  auto heap_cmp = [&](uint64_t a, uint64_t b) {
+    auto i = runs[a].first;
+    auto j = runs[b].first;
+    if (less(j, i))
+      return true;
+    if (less(i, j))
+      return false;
+    return (*coords)[i].tile_->fragment_idx_ <
+           (*coords)[j].tile_->fragment_idx_;
+  };
+  std::priority_queue<uint64_t, std::vector<uint64_t>, decltype(heap_cmp)>
+      heap(heap_cmp);
+  for (uint64_t r = 0; r < runs.size(); ++r)
+    heap.push(r);
+
+  // Merge the runs, skipping the coordinates that are equal to the last
+  // merged ones (i.e., the ones of older fragments)
+  auto coords_size = array_schema_->coords_size();
+  OverlappingCoordsList<T> merged;
+  merged.reserve(coords_num);
+  while (!heap.empty()) {
+    auto r = heap.top();
+    heap.pop();
+    const auto& c = (*coords)[runs[r].first];
+    if (merged.empty() ||
+        std::memcmp(merged.back().coords_, c.coords_, coords_size) != 0)
+      merged.push_back(c);
+    if (++runs[r].first < runs[r].second)
+      heap.push(r);
+  }
+  coords->swap(merged);
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_merge_coords);
+}
+
+std::vector<std::string> Reader::pipeline_attributes() const {
+  // The tiles of the query condition attributes are read upfront
+  auto condition_attributes = condition_.field_names();
+  auto streamed = [&](const std::string& attr) {
+    return attr != constants::coords &&
+           std::find(
+               condition_attributes.begin(),
+               condition_attributes.end(),
+               attr) == condition_attributes.end();
+  };
+
+  std::vector<std::string> attributes;
+  for (const auto& attr : attributes_) {
+    if (streamed(attr) && array_schema_->var_size(attr))
+      attributes.push_back(attr);
+  }
   for (const auto& attr : attributes_) {
-    if (array_schema_->dense() && attr == constants::coords)
-      continue;  // Skip coords in dense case - no actual tiles to read
-    all_attributes.insert(attr);
+    if (streamed(attr) && !array_schema_->var_size(attr))
+      attributes.push_back(attr);
   }
 
-  // Make sure the coordinate tiles are read if specified.
-  if (ensure_coords)
-    all_attributes.insert(constants::coords);
+  return attributes;
+}
 
-  // Read the tiles asynchronously.
-  std::vector<std::future<Status>> tasks;
-  for (const auto& attr : all_attributes)
-    RETURN_CANCEL_OR_ERROR(read_tiles(attr, tiles, &tasks));
+uint64_t Reader::prefetch_partition_num() const {
+  if (read_prefetch_partitions_ == 0 || !aggregates_.empty() ||
+      result_views_enabled_)
+    return 0;
+
+  // Every prefetched partition stages as many bytes as the user buffers
+  uint64_t staging_size = 0;
+  for (const auto& it : attr_buffers_)
+    staging_size +=
+        it.second.original_buffer_size_ + it.second.original_buffer_var_size_;
+  if (staging_size == 0)
+    return read_prefetch_partitions_;
+
+  return std::min(
+      read_prefetch_partitions_, read_prefetch_memory_budget_ / staging_size);
+}
 
-  // Wait for the reads to finish and check statuses.
-  auto statuses =
-      storage_manager_->reader_thread_pool()->wait_all_status(tasks);
-  for (const auto& st : statuses)
-    RETURN_CANCEL_OR_ERROR(st);
+Status Reader::prefetch_partitions() {
+  auto partition_num = prefetch_partition_num();
+  if (partition_num == 0)
+    return Status::Ok();
 
-  return Status::Ok();
+  // The partitions are read by a dedicated pool, since the partition
+  // readers themselves wait on the reader thread pool
+  if (prefetch_thread_pool_ == nullptr) {
+    prefetch_thread_pool_.reset(new ThreadPool());
+    RETURN_NOT_OK(prefetch_thread_pool_->init(partition_num));
+  }
 
-  STATS_FUNC_OUT(reader_read_all_tiles);
+  while (prefetched_partitions_.size() < partition_num &&
+         read_state_.cur_subarray_partition_ != nullptr) {
+    std::unique_ptr<PrefetchedPartition> partition(new PrefetchedPartition());
+    RETURN_NOT_OK(init_prefetched_partition(partition.get()));
+    auto reader = partition->reader_.get();
+    partition->task_ =
+        prefetch_thread_pool_->enqueue([reader]() { return reader->read(); });
+    prefetched_partitions_.push_back(std::move(partition));
+    STATS_COUNTER_ADD(reader_num_prefetched_partitions, 1);
+
+    // This reader never overflows, it only hands out the partitions
+    read_state_.overflowed_ = false;
+    RETURN_NOT_OK(next_subarray_partition());
+  }
+
+  return Status::Ok();
 }
 
-Status Reader::read_tiles(
-    const std::string& attribute,
-    OverlappingTileVec* tiles,
-    std::vector<std::future<Status>>* tasks) const {
-  // For each tile, read from its fragment.
-  bool var_size = array_schema_->var_size(attribute);
-  auto num_tiles = static_cast<uint64_t>(tiles->size());
-
-  for (uint64_t i = 0; i < num_tiles; i++) {
-    auto& tile = (*tiles)[i];
-    auto it = tile->attr_tiles_.find(attribute);
-    if (it == tile->attr_tiles_.end()) {
-      return LOG_STATUS(
-          Status::ReaderError("Invalid tile map for attribute " + attribute));
+Status Reader::prefetch_read() {
+  do {
+    RETURN_NOT_OK(prefetch_partitions());
+    if (prefetched_partitions_.empty()) {
+      zero_out_buffer_sizes();
+      return Status::Ok();
     }
 
-    // Initialize the tile(s)
-    auto& tile_pair = it->second;
-    auto& t = tile_pair.first;
-    auto& t_var = tile_pair.second;
-    auto& fragment = fragment_metadata_[tile->fragment_idx_];
-    auto format_version = fragment->format_version();
-    if (!var_size) {
-      RETURN_NOT_OK(init_tile(format_version, attribute, &t));
+    // Hand over the results of the oldest partition
+    auto partition = prefetched_partitions_.front().get();
+    RETURN_NOT_OK(wait_prefetched_partition(partition));
+    RETURN_NOT_OK(copy_prefetched_partition(partition));
+
+    // Continue reading the partition in the background if it has more
+    // results, otherwise discard it
+    auto reader = partition->reader_.get();
+    if (!reader->incomplete()) {
+      prefetched_partitions_.pop_front();
     } else {
-      RETURN_NOT_OK(init_tile(format_version, attribute, &t, &t_var));
+      // The results of the partition do not fit in the buffers and the
+      // partition cannot be split further. The flags are checked before
+      // the next read of the partition is enqueued, which modifies them.
+      auto unsplittable_overflow = reader->read_state_.overflowed_ &&
+                                   reader->read_state_.unsplittable_;
+
+      RETURN_NOT_OK(set_staging_buffers(partition));
+      partition->task_ =
+          prefetch_thread_pool_->enqueue([reader]() { return reader->read(); });
+      if (unsplittable_overflow)
+        return Status::Ok();
     }
+  } while (no_results() && incomplete());
 
-    // Enqueue the read task in the Reader thread pool.
-    auto task = storage_manager_->reader_thread_pool()->enqueue([&attribute,
-                                                                 &tile,
-                                                                 &t,
-                                                                 &t_var,
-                                                                 var_size,
-                                                                 this]() {
-      // Get information about the tile in its fragment
-      auto& fragment = fragment_metadata_[tile->fragment_idx_];
-      auto tile_attr_uri = fragment->attr_uri(attribute);
-      auto tile_attr_offset = fragment->file_offset(attribute, tile->tile_idx_);
-      auto tile_size = fragment->tile_size(attribute, tile->tile_idx_);
-      auto tile_persisted_size =
-          fragment->persisted_tile_size(attribute, tile->tile_idx_);
-
-      // Try the cache first.
-      bool cache_hit;
-      RETURN_NOT_OK(storage_manager_->read_from_cache(
-          tile_attr_uri, tile_attr_offset, t.buffer(), tile_size, &cache_hit));
-      if (cache_hit) {
-        t.set_filtered(true);
-        STATS_COUNTER_ADD(reader_attr_tile_cache_hits, 1);
-      } else {
-        // Read from disk if it missed.
-        RETURN_NOT_OK(storage_manager_->read(
-            tile_attr_uri, tile_attr_offset, t.buffer(), tile_persisted_size));
-        STATS_COUNTER_ADD(reader_num_tile_bytes_read, tile_persisted_size);
-      }
+  // Keep reading ahead while the user consumes the results
+  return prefetch_partitions();
+}
 
-      if (var_size) {
-        auto tile_attr_var_uri = fragment->attr_var_uri(attribute);
-        auto tile_attr_var_offset =
-            fragment->file_var_offset(attribute, tile->tile_idx_);
-        auto tile_var_size =
-            fragment->tile_var_size(attribute, tile->tile_idx_);
-        auto tile_var_persisted_size =
-            fragment->persisted_tile_var_size(attribute, tile->tile_idx_);
-
-        RETURN_NOT_OK(storage_manager_->read_from_cache(
-            tile_attr_var_uri,
-            tile_attr_var_offset,
-            t_var.buffer(),
-            tile_var_size,
-            &cache_hit));
-
-        if (cache_hit) {
-          t_var.set_filtered(true);
-          STATS_COUNTER_ADD(reader_attr_tile_cache_hits, 1);
-        } else {
-          RETURN_NOT_OK(storage_manager_->read(
-              tile_attr_var_uri,
-              tile_attr_var_offset,
-              t_var.buffer(),
-              tile_var_persisted_size));
-          STATS_COUNTER_ADD(
-              reader_num_tile_bytes_read, tile_var_persisted_size);
-          STATS_COUNTER_ADD(reader_num_var_cell_bytes_read, t.size());
-          STATS_COUNTER_ADD(reader_num_var_cell_bytes_read, t_var.size());
-        }
-      } else {
-        STATS_COUNTER_ADD_IF(
-            !cache_hit, reader_num_fixed_cell_bytes_read, t.size());
-      }
+Status Reader::read_all_tiles(
+    const std::vector<std::string>& attributes,
+    OverlappingTileVec* tiles) const {
+  STATS_FUNC_IN(reader_read_all_tiles);
 
-      return Status::Ok();
-    });
+  // Shortcut for empty tile vec
+  if (tiles->empty())
+    return Status::Ok();
 
-    tasks->push_back(std::move(task));
+  // Stream the tiles and wait for all of them. The caller keeps all the
+  // tiles, so the budget of each attribute is released (without freeing
+  // its tiles) once it is ready, and only paces the fetches.
+  TilePipeline pipeline;
+  RETURN_CANCEL_OR_ERROR(init_tile_pipeline(attributes, {tiles}, &pipeline));
+  for (size_t a = 0; a < attributes.size(); ++a) {
+    RETURN_CANCEL_OR_ERROR(wait_tile_pipeline(&pipeline, a + 1));
+    pipeline.inflight_bytes_ -= pipeline.unfiltered_bytes_[a];
+    pipeline.unfiltered_bytes_[a] = 0;
+    RETURN_CANCEL_OR_ERROR(issue_tile_fetches(&pipeline));
   }
 
-  STATS_COUNTER_ADD(reader_num_attr_tiles_touched, num_tiles);
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_read_all_tiles);
+}
+
+Status Reader::read_tile_ranges(
+    const URI& uri,
+    const std::vector<ByteRange>& ranges,
+    const std::vector<Tile*>& tiles,
+    std::list<Buffer>* buffers) const {
+  assert(ranges.size() == tiles.size());
+  auto reads = read_planner_.plan(ranges);
+  for (const auto& read : reads) {
+    // Issue a single read for all the ranges it covers
+    buffers->emplace_back();
+    auto buff = &buffers->back();
+    RETURN_NOT_OK(storage_manager_->read(uri, read.offset_, buff, read.size_));
+    STATS_COUNTER_ADD(reader_num_tile_bytes_read, read.size_);
+    STATS_COUNTER_ADD(reader_num_tile_reads, 1);
+
+    // Point the tiles to their slices of the read buffer
+    for (auto r : read.ranges_) {
+      Buffer slice(
+          buff->data(ranges[r].offset_ - read.offset_), ranges[r].size_, false);
+      RETURN_NOT_OK(tiles[r]->buffer()->swap(slice));
+    }
+  }
 
   return Status::Ok();
 }
 
+Status Reader::release_tile_pipeline_attribute(
+    TilePipeline* pipeline, size_t attr_idx) const {
+  // Swap the tiles with empty ones instead of erasing them from the map,
+  // which is concurrently looked up by the fetch tasks
+  const auto& attribute = pipeline->attributes_[attr_idx];
+  for (auto tiles : pipeline->tiles_) {
+    for (auto& tile : *tiles) {
+      auto it = tile->attr_tiles_.find(attribute);
+      if (it != tile->attr_tiles_.end())
+        it->second = std::pair<Tile, Tile>();
+    }
+  }
+
+  pipeline->inflight_bytes_ -= pipeline->unfiltered_bytes_[attr_idx];
+  pipeline->unfiltered_bytes_[attr_idx] = 0;
+  return issue_tile_fetches(pipeline);
+}
+
+Status Reader::reset_read_state() {
+  if (!read_state_.initialized_)
+    return Status::Ok();
+
+  auto subarray_size = 2 * array_schema_->coords_size();
+  std::vector<uint8_t> subarray(subarray_size);
+  std::memcpy(&subarray[0], read_state_.subarray_, subarray_size);
+  return set_subarray(&subarray[0]);
+}
+
 void Reader::reset_buffer_sizes() {
+  result_views_.clear();
   for (auto& it : attr_buffers_) {
     *(it.second.buffer_size_) = it.second.original_buffer_size_;
     if (it.second.buffer_var_size_ != nullptr)
@@ -1965,20 +3996,83 @@ void Reader::reset_buffer_sizes() {
   }
 }
 
+Status Reader::set_staging_buffers(PrefetchedPartition* partition) {
+  auto reader = partition->reader_.get();
+  for (const auto& attr : attributes_) {
+    const auto& attr_buffer = attr_buffers_[attr];
+    auto& staging = partition->buffers_[attr];
+    staging.buffer_size_ = attr_buffer.original_buffer_size_;
+    staging.buffer_.resize(std::max<uint64_t>(staging.buffer_size_, 1));
+    if (attr_buffer.buffer_var_ == nullptr) {
+      RETURN_NOT_OK(reader->set_buffer(
+          attr, staging.buffer_.data(), &staging.buffer_size_));
+    } else {
+      staging.buffer_var_size_ = attr_buffer.original_buffer_var_size_;
+      staging.buffer_var_.resize(
+          std::max<uint64_t>(staging.buffer_var_size_, 1));
+      RETURN_NOT_OK(reader->set_buffer(
+          attr,
+          (uint64_t*)staging.buffer_.data(),
+          &staging.buffer_size_,
+          staging.buffer_var_.data(),
+          &staging.buffer_var_size_));
+    }
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+bool Reader::layout_is_global_order() const {
+  if (layout_ == Layout::GLOBAL_ORDER)
+    return true;
+
+  // Tiles and cells follow the same order along a single dimension, unless
+  // the cell order is the Hilbert order
+  auto domain = array_schema_->domain();
+  auto cell_order = array_schema_->cell_order();
+  if (cell_order == Layout::HILBERT)
+    return false;
+  auto dim_num = domain->dim_num();
+  if (dim_num == 1)
+    return true;
+
+  // Otherwise, the partition must lie in a single space tile
+  if (layout_ != cell_order)
+    return false;
+  if (domain->null_tile_extents())
+    return true;
+  auto partition = (const T*)read_state_.cur_subarray_partition_;
+  auto dom = (const T*)domain->domain();
+  auto tile_extents = (const T*)domain->tile_extents();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto start = (uint64_t)((partition[2 * d] - dom[2 * d]) / tile_extents[d]);
+    auto end =
+        (uint64_t)((partition[2 * d + 1] - dom[2 * d]) / tile_extents[d]);
+    if (start != end)
+      return false;
+  }
+
+  return true;
+}
+
+bool Reader::single_fragment(const OverlappingTileVec& tiles) const {
+  for (const auto& tile : tiles) {
+    if (tile->fragment_idx_ != tiles.front()->fragment_idx_)
+      return false;
+  }
+  return true;
+}
+
 template <class T>
 Status Reader::sort_coords(OverlappingCoordsList<T>* coords) const {
   STATS_FUNC_IN(reader_sort_coords);
 
-  if (layout_ == Layout::GLOBAL_ORDER) {
-    auto domain = array_schema_->domain();
-    parallel_sort(coords->begin(), coords->end(), GlobalCmp<T>(domain));
-  } else {
-    auto dim_num = array_schema_->dim_num();
-    if (layout_ == Layout::ROW_MAJOR)
-      parallel_sort(coords->begin(), coords->end(), RowCmp<T>(dim_num));
-    else if (layout_ == Layout::COL_MAJOR)
-      parallel_sort(coords->begin(), coords->end(), ColCmp<T>(dim_num));
-  }
+  auto dim_num = array_schema_->dim_num();
+  if (layout_ == Layout::ROW_MAJOR)
+    parallel_sort(coords->begin(), coords->end(), RowCmp<T>(dim_num));
+  else if (layout_ == Layout::COL_MAJOR)
+    parallel_sort(coords->begin(), coords->end(), ColCmp<T>(dim_num));
 
   return Status::Ok();
 
@@ -2020,50 +4114,189 @@ template <class T>
 Status Reader::sparse_read() {
   STATS_FUNC_IN(reader_sparse_read);
 
-  // Get overlapping tile indexes
+  // Resume copying the results of the current partition
+  if (copy_pending())
+    return copy_partition_cells<T>(&copy_state_.cell_ranges_);
+
+  // Get overlapping tile indexes, skipping the tiles whose cells cannot
+  // satisfy the query condition
   OverlappingTileVec tiles;
   RETURN_CANCEL_OR_ERROR(compute_overlapping_tiles<T>(&tiles));
+  skip_tiles_by_condition<T>(&tiles);
+
+  // Read the coordinate tiles, along with the tiles of the attributes the
+  // query condition is evaluated on
+  auto condition_attributes = condition_.field_names();
+  std::vector<std::string> read_attributes = {constants::coords};
+  read_attributes.insert(
+      read_attributes.end(),
+      condition_attributes.begin(),
+      condition_attributes.end());
+  RETURN_CANCEL_OR_ERROR(read_all_tiles(read_attributes, &tiles));
+
+  // If all the tiles lie fully in the subarray and there is no condition,
+  // all the tiles have results (unless their cells are overwritten).
+  // Start streaming their attribute tiles right away, so that fetching
+  // and unfiltering them overlaps with processing the coordinates.
+  // Otherwise, the attribute tiles are fetched after the coordinates are
+  // checked, only for the tiles with results.
+  bool late_materialization = !condition_.empty();
+  for (const auto& tile : tiles)
+    late_materialization = late_materialization || !tile->full_overlap_;
+  TilePipeline pipeline;
+  if (!late_materialization) {
+    RETURN_CANCEL_OR_ERROR(
+        init_tile_pipeline(pipeline_attributes(), {&tiles}, &pipeline));
+  }
 
-  // Read tiles
-  RETURN_CANCEL_OR_ERROR(read_all_tiles(&tiles));
+  // If all the tiles belong to the same fragment, the results of a read
+  // whose layout is the global order are already sorted and there is
+  // nothing to dedup. Therefore, the cell ranges can be computed directly
+  // from the bitmaps of the tiles.
+  OverlappingCellRangeList cell_ranges;
+  if (layout_is_global_order<T>() && single_fragment(tiles)) {
+    RETURN_CANCEL_OR_ERROR(compute_cell_ranges<T>(tiles, &cell_ranges));
+  } else {
+    // Compute the read coordinates for all fragments
+    OverlappingCoordsList<T> coords;
+    RETURN_CANCEL_OR_ERROR(compute_overlapping_coords<T>(tiles, &coords));
+
+    // Compute the tile coordinates for all overlapping coordinates (for
+    // sorting).
+    std::unique_ptr<T[]> tile_coords(nullptr);
+    RETURN_CANCEL_OR_ERROR(compute_tile_coords<T>(&tile_coords, &coords));
+
+    // Sort and dedup the coordinates. The fragments are already sorted in
+    // the global order, so for that layout it suffices to merge them.
+    if (layout_ == Layout::GLOBAL_ORDER) {
+      RETURN_CANCEL_OR_ERROR(merge_coords<T>(&coords));
+    } else {
+      RETURN_CANCEL_OR_ERROR(sort_coords<T>(&coords));
+      RETURN_CANCEL_OR_ERROR(dedup_coords<T>(&coords));
+    }
+    tile_coords.reset(nullptr);
 
-  // Filter tiles
-  RETURN_CANCEL_OR_ERROR(filter_all_tiles(&tiles));
+    // Compute the maximal cell ranges
+    RETURN_CANCEL_OR_ERROR(compute_cell_ranges(coords, &cell_ranges));
+  }
 
-  // Compute the read coordinates for all fragments
-  OverlappingCoordsList<T> coords;
-  RETURN_CANCEL_OR_ERROR(compute_overlapping_coords<T>(tiles, &coords));
+  // Drop the cells that do not satisfy the query condition
+  RETURN_CANCEL_OR_ERROR(apply_query_condition(&cell_ranges));
 
-  // Compute the tile coordinates for all overlapping coordinates (for sorting).
-  std::unique_ptr<T[]> tile_coords(nullptr);
-  RETURN_CANCEL_OR_ERROR(compute_tile_coords<T>(&tile_coords, &coords));
+  // Stream the attribute tiles of the tiles with results only
+  if (late_materialization) {
+    skip_tiles_without_results(cell_ranges, &tiles);
+    RETURN_CANCEL_OR_ERROR(
+        init_tile_pipeline(pipeline_attributes(), {&tiles}, &pipeline));
+  }
 
-  // Sort and dedup the coordinates (not applicable to the global order
-  // layout for a single fragment)
-  if (!(fragment_metadata_.size() == 1 && layout_ == Layout::GLOBAL_ORDER)) {
-    RETURN_CANCEL_OR_ERROR(sort_coords<T>(&coords));
-    RETURN_CANCEL_OR_ERROR(dedup_coords<T>(&coords));
+  // Copy cells, as the attribute tiles become ready
+  RETURN_CANCEL_OR_ERROR(copy_partition_cells<T>(&cell_ranges, &pipeline));
+
+  // Keep the tiles if the rest of the results will be copied later
+  if (copy_pending())
+    copy_state_.tiles_.push_back(std::move(tiles));
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_sparse_read);
+}
+
+Status Reader::unfilter_tile(
+    const std::string& attribute, OverlappingTile* tile) const {
+  STATS_FUNC_IN(reader_unfilter_tile);
+
+  // Get information about the tile in its fragment
+  auto var_size = array_schema_->var_size(attribute);
+  auto& fragment = fragment_metadata_[tile->fragment_idx_];
+  auto& tile_pair = tile->attr_tiles_.find(attribute)->second;
+  auto& t = tile_pair.first;
+  auto& t_var = tile_pair.second;
+
+  if (!t.filtered()) {
+    auto tile_attr_uri = fragment->attr_uri(attribute);
+    auto tile_attr_offset = fragment->file_offset(attribute, tile->tile_idx_);
+
+    // Decompress, etc.
+    RETURN_NOT_OK(filter_tile(attribute, &t, var_size));
+    RETURN_NOT_OK(storage_manager_->write_to_cache(
+        tile_attr_uri, tile_attr_offset, t.buffer()));
   }
-  tile_coords.reset(nullptr);
 
-  // Compute the maximal cell ranges
-  OverlappingCellRangeList cell_ranges;
-  RETURN_CANCEL_OR_ERROR(compute_cell_ranges(coords, &cell_ranges));
-  coords.clear();
+  if (var_size && !t_var.filtered()) {
+    auto tile_attr_var_uri = fragment->attr_var_uri(attribute);
+    auto tile_attr_var_offset =
+        fragment->file_var_offset(attribute, tile->tile_idx_);
 
-  // Copy cells
-  for (const auto& attr : attributes_) {
-    if (read_state_.overflowed_)
-      break;
-    RETURN_CANCEL_OR_ERROR(copy_cells(attr, cell_ranges));
+    // Decompress, etc.
+    RETURN_NOT_OK(filter_tile(attribute, &t_var, false));
+    RETURN_NOT_OK(storage_manager_->write_to_cache(
+        tile_attr_var_uri, tile_attr_var_offset, t_var.buffer()));
   }
 
   return Status::Ok();
 
-  STATS_FUNC_OUT(reader_sparse_read);
+  STATS_FUNC_OUT(reader_unfilter_tile);
+}
+
+Status Reader::wait_prefetched_partition(
+    PrefetchedPartition* partition) const {
+  STATS_FUNC_IN(reader_wait_prefetched_partition);
+
+  RETURN_CANCEL_OR_ERROR(partition->task_.get());
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_wait_prefetched_partition);
+}
+
+Status Reader::wait_tile_pipeline(
+    TilePipeline* pipeline, size_t attr_num) const {
+  STATS_FUNC_IN(reader_wait_tile_pipeline);
+
+  auto& fetches = pipeline->fetches_;
+  while (!fetches.empty() && fetches.front().attr_idx_ < attr_num) {
+    // Wait for the oldest fetch, and take along all the subsequent
+    // fetches that have already completed
+    std::vector<TilePipeline::Fetch> batch;
+    do {
+      auto& fetch = fetches.front();
+      RETURN_CANCEL_OR_ERROR(fetch.task_.get());
+      STATS_GAUGE_SUB(reader_inflight_tile_bytes, fetch.bytes_);
+      batch.push_back(std::move(fetch));
+      fetches.pop_front();
+    } while (!fetches.empty() && fetches.front().attr_idx_ < attr_num &&
+             fetches.front().task_.wait_for(std::chrono::seconds(0)) ==
+                 std::future_status::ready);
+
+    // Unfilter the fetched tiles in parallel, while the reader thread pool
+    // keeps fetching the tiles issued so far
+    std::vector<std::pair<size_t, OverlappingTile*>> batch_tiles;
+    for (const auto& fetch : batch) {
+      for (auto tile : fetch.tiles_)
+        batch_tiles.emplace_back(fetch.attr_idx_, tile);
+    }
+    auto statuses = parallel_for(0, batch_tiles.size(), [&, this](uint64_t i) {
+      const auto& attribute = pipeline->attributes_[batch_tiles[i].first];
+      return unfilter_tile(attribute, batch_tiles[i].second);
+    });
+    for (const auto& st : statuses)
+      RETURN_CANCEL_OR_ERROR(st);
+
+    // The unfiltered tiles stay counted against the budget until they
+    // are released, so only the fetches that fit are issued
+    for (const auto& fetch : batch)
+      pipeline->unfiltered_bytes_[fetch.attr_idx_] += fetch.bytes_;
+    RETURN_CANCEL_OR_ERROR(issue_tile_fetches(pipeline));
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(reader_wait_tile_pipeline);
 }
 
 void Reader::zero_out_buffer_sizes() {
+  result_views_.clear();
   for (auto& attr_buffer : attr_buffers_) {
     if (attr_buffer.second.buffer_size_ != nullptr)
       *(attr_buffer.second.buffer_size_) = 0;
@@ -36,14 +36,23 @@
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/filter/filter_pipeline.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/stats.h"
 #include "tiledb/sm/misc/status.h"
+#include "tiledb/sm/misc/thread_pool.h"
 #include "tiledb/sm/query/dense_cell_range_iter.h"
+#include "tiledb/sm/query/aggregate.h"
+#include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/read_planner.h"
+#include "tiledb/sm/query/subarray_partitioner.h"
 #include "tiledb/sm/query/types.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <deque>
 #include <future>
 #include <list>
+#include <map>
 #include <memory>
+#include <type_traits>
 
 namespace tiledb {
 namespace sm {
@@ -78,10 +87,10 @@ class Reader {
     /** The original subarray set by the user. */
     void* subarray_;
     /**
-     * A list of subarray partitions. The head of the list is the partition
-     * to be split next.
+     * Partitions the subarray into partitions whose results are estimated
+     * to fit in the user buffers.
      */
-    std::list<void*> subarray_partitions_;
+    SubarrayPartitioner partitioner_;
     /** True if the reader has been initialized. */
     bool initialized_;
     /**
@@ -143,7 +152,8 @@ class Reader {
      *
      * Note that the tile this points to is allocated and freed in
      * sparse_read/dense_read, so the lifetime of this struct must not exceed
-     * the scope of those functions.
+     * the scope of those functions, unless the tile is kept in the
+     * copy state of the reader.
      */
     const OverlappingTile* tile_;
     /** The starting cell in the range. */
@@ -215,6 +225,15 @@ class Reader {
   template <typename T>
   using OverlappingCoordsList = std::vector<OverlappingCoords<T>>;
 
+  /**
+   * The ranges of each dimension that constrain a subarray partition,
+   * stored as sorted, disjoint `[low, high]` pairs. The partition results
+   * are the cells that fall in a range along every dimension, i.e., in the
+   * cross product of the ranges.
+   */
+  template <typename T>
+  using PartitionRanges = std::vector<std::vector<T>>;
+
   /** A cell range produced by the dense read algorithm. */
   template <class T>
   struct DenseCellRange {
@@ -261,6 +280,159 @@ class Reader {
     }
   };
 
+  /**
+   * The cells of a tile that the dense fragments provide, with the
+   * fragment precedence already resolved. The cells are stored as maximal
+   * disjoint runs of cell positions, sorted in the cell order, each run
+   * belonging to the most recent fragment that covers it. The cells
+   * outside the runs are empty.
+   */
+  struct DenseTileRuns {
+    /** The first cell position of each run. */
+    std::vector<uint64_t> starts_;
+    /** The last cell position of each run. */
+    std::vector<uint64_t> ends_;
+    /** The fragment of each run. */
+    std::vector<int> fragments_;
+    /** The first run that may intersect the next requested cell range. */
+    size_t next_;
+    /** `true` if the runs have been computed. */
+    bool computed_;
+
+    /** Constructor. */
+    DenseTileRuns()
+        : next_(0)
+        , computed_(false) {
+    }
+  };
+
+  /**
+   * The state of copying the results of the current subarray partition
+   * into the user buffers. If the results do not fit, the cell ranges that
+   * were not copied are kept along with the tiles they point to, so that
+   * the next read resumes from the exact cell where the previous one
+   * stopped, without reading and unfiltering the tiles again.
+   */
+  struct CopyState {
+    /** The cell ranges of the current partition not copied yet. */
+    OverlappingCellRangeList cell_ranges_;
+    /** The number of cells of the current partition copied so far. */
+    uint64_t copied_cell_num_;
+    /** The tiles the pending cell ranges point to. */
+    std::vector<OverlappingTileVec> tiles_;
+  };
+
+  /**
+   * A subarray partition read ahead of the user (see
+   * `sm.read_prefetch_partitions`). The partition is read in the
+   * background by a separate reader, which stores the results into
+   * staging buffers owned by the partition. Upon a user read, the staged
+   * results are copied into the user buffers.
+   */
+  struct PrefetchedPartition {
+    /** The staging buffers of an attribute. */
+    struct StagingBuffer {
+      /** The fixed-sized (or offsets) buffer. */
+      std::vector<uint8_t> buffer_;
+      /** The size of the results in `buffer_`. */
+      uint64_t buffer_size_;
+      /** The var-sized buffer (empty for fixed-sized attributes). */
+      std::vector<uint8_t> buffer_var_;
+      /** The size of the results in `buffer_var_`. */
+      uint64_t buffer_var_size_;
+    };
+
+    /** The reader constrained to the partition. */
+    std::unique_ptr<Reader> reader_;
+    /** The staging buffers, mapped from attribute names. */
+    std::unordered_map<std::string, StagingBuffer> buffers_;
+    /** The task reading the next results of the partition. */
+    std::future<Status> task_;
+  };
+
+  /**
+   * A bounded pipeline that streams the tiles of a list of attributes from
+   * storage through the filter pipeline. The tiles are fetched in the
+   * background by the reader thread pool, attribute by attribute, while the
+   * reader unfilters the fetched tiles and copies the cells of the
+   * attributes whose tiles are ready. A new fetch is issued only if the
+   * persisted bytes of the tiles in flight (i.e., fetched or being fetched
+   * but not unfiltered yet) fit in the in-flight budget. At least one tile
+   * is always in flight, so that the pipeline makes progress even if a
+   * single tile exceeds the budget.
+   */
+  struct TilePipeline {
+    /**
+     * A fetch issued by the pipeline. It covers consecutive tiles of the
+     * same fragment, so that their reads can be coalesced.
+     */
+    struct Fetch {
+      /** The index of the attribute of the tiles in `attributes_`. */
+      size_t attr_idx_;
+      /** The tiles to be fetched. */
+      std::vector<OverlappingTile*> tiles_;
+      /** The persisted bytes of the tiles (plus their var-sized tiles). */
+      uint64_t bytes_;
+      /**
+       * The buffers of the coalesced reads. The fetched tiles point into
+       * them until they are unfiltered.
+       */
+      std::unique_ptr<std::list<Buffer>> buffers_;
+      /** The future of the fetch task. */
+      std::future<Status> task_;
+    };
+
+    /** The attributes whose tiles are streamed, in order. */
+    std::vector<std::string> attributes_;
+    /** The tiles to be streamed for each attribute. */
+    std::vector<OverlappingTileVec*> tiles_;
+    /**
+     * The maximum number of persisted tile bytes in flight, bounded by
+     * both `sm.read_inflight_size` and `sm.memory_budget`.
+     */
+    uint64_t budget_;
+    /**
+     * The number of persisted tile bytes counted against the budget. The
+     * tiles are counted from the moment they are fetched until they are
+     * released after their cells are copied.
+     */
+    uint64_t inflight_bytes_;
+    /**
+     * The persisted bytes of the unfiltered tiles of each attribute, which
+     * are still counted in `inflight_bytes_`.
+     */
+    std::vector<uint64_t> unfiltered_bytes_;
+    /** The fetches in flight, in the order they were issued. */
+    std::deque<Fetch> fetches_;
+    /** The attribute index of the next fetch to issue. */
+    size_t next_attr_;
+    /** The index in `tiles_` of the tile vector of the next fetch. */
+    size_t next_vec_;
+    /** The index of the tile of the next fetch in its tile vector. */
+    uint64_t next_tile_;
+
+    /** Constructor. */
+    TilePipeline()
+        : budget_(0)
+        , inflight_bytes_(0)
+        , next_attr_(0)
+        , next_vec_(0)
+        , next_tile_(0) {
+    }
+
+    /**
+     * Destructor. It waits for the fetches still in flight, since they
+     * write into tiles owned by the caller.
+     */
+    ~TilePipeline() {
+      for (auto& fetch : fetches_) {
+        if (fetch.task_.valid())
+          fetch.task_.wait();
+        STATS_GAUGE_SUB(reader_inflight_tile_bytes, fetch.bytes_);
+      }
+    }
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -280,6 +452,35 @@ class Reader {
   /*                 API               */
   /* ********************************* */
 
+  /**
+   * Adds an aggregate on an attribute of a sparse array. This turns the
+   * query into an aggregate query, which does not copy any cells to user
+   * buffers; instead, it reduces the results of the whole subarray into the
+   * aggregates, which are retrieved with `get_aggregate`.
+   *
+   * @param attribute The attribute. `AGGREGATE_COUNT` can be applied on
+   *     any attribute (including the coordinates), the rest of the
+   *     operators only on numeric fixed-sized attributes with a single
+   *     value per cell.
+   * @param op The aggregate operator.
+   * @return Status
+   */
+  Status add_aggregate(const std::string& attribute, AggregateOp op);
+
+  /**
+   * Adds a range along a dimension of a sparse array. The query results
+   * are the cells in the cross product of the ranges of all dimensions;
+   * the dimensions without any added range are constrained only by the
+   * subarray. The ranges are processed together, i.e., a tile that
+   * overlaps with several ranges is fetched and unfiltered once.
+   *
+   * @param dim_idx The index of the dimension.
+   * @param start The range start, of the domain type.
+   * @param end The range end (inclusive), of the domain type.
+   * @return Status
+   */
+  Status add_range(unsigned dim_idx, const void* start, const void* end);
+
   /** Returns the array schema. */
   const ArraySchema* array_schema() const;
 
@@ -309,6 +510,32 @@ class Reader {
   /** Returns a vector with the fragment URIs. */
   std::vector<URI> fragment_uris() const;
 
+  /**
+   * Retrieves the result of an aggregate added with `add_aggregate`. See
+   * `Aggregate::get` for the type of the result.
+   *
+   * @param attribute The attribute.
+   * @param op The aggregate operator.
+   * @param value The result to be retrieved.
+   * @return Status
+   */
+  Status get_aggregate(
+      const std::string& attribute, AggregateOp op, void* value) const;
+
+  /**
+   * Retrieves the result views of a fixed-sized attribute for the last
+   * read, if result views are enabled (see `set_result_views`).
+   *
+   * @param attribute The attribute.
+   * @param views The views to be retrieved, in the order of the results.
+   *     It is `nullptr` if the last read did not produce views for the
+   *     attribute (e.g., the coordinates of a dense array).
+   * @return Status
+   */
+  Status get_result_views(
+      const std::string& attribute,
+      const std::vector<ResultView>** views) const;
+
   /**
    * Retrieves the buffer of a fixed-sized attribute.
    *
@@ -374,6 +601,15 @@ class Reader {
    */
   void set_array_schema(const ArraySchema* array_schema);
 
+  /**
+   * Sets the query condition. Only the cells that satisfy it are
+   * returned. This is applicable only to sparse arrays.
+   *
+   * @param condition The query condition.
+   * @return Status
+   */
+  Status set_condition(const QueryCondition& condition);
+
   /**
    * Sets the buffer for a fixed-sized attribute.
    *
@@ -424,6 +660,19 @@ class Reader {
    */
   Status set_layout(Layout layout);
 
+  /**
+   * Enables or disables result views. With result views, the results of
+   * the fixed-sized attributes are not copied into the user buffers (only
+   * the buffer sizes are set); instead, the read produces read-only views
+   * into the decoded tiles, retrieved with `get_result_views`. The viewed
+   * results of each read are bounded by the memory budget instead of the
+   * buffer sizes.
+   *
+   * @param enabled `true` to enable result views.
+   * @return Status
+   */
+  Status set_result_views(bool enabled);
+
   /** Sets the storage manager. */
   void set_storage_manager(StorageManager* storage_manager);
 
@@ -436,6 +685,17 @@ class Reader {
    */
   Status set_subarray(const void* subarray);
 
+  /**
+   * Sets the format of the offsets of the var-sized attribute buffers,
+   * overriding `sm.var_offsets.bitsize` and `sm.var_offsets.extra_element`.
+   *
+   * @param bitsize The size of an offset in bits (`32` or `64`).
+   * @param extra_element If `true`, the offsets end with an extra element
+   *     holding the total size of the values.
+   * @return Status
+   */
+  Status set_var_offsets_format(uint32_t bitsize, bool extra_element);
+
   /*
    * Return the subarray
    * @return subarray
@@ -459,6 +719,12 @@ class Reader {
   /** Maps attribute names to their buffers. */
   std::unordered_map<std::string, AttributeBuffer> attr_buffers_;
 
+  /** The aggregates of an aggregate query, mapped from attribute names. */
+  std::unordered_map<std::string, Aggregate> aggregates_;
+
+  /** The condition that the cells of the results must satisfy. */
+  QueryCondition condition_;
+
   /** The fragment metadata. */
   std::vector<FragmentMetadata*> fragment_metadata_;
 
@@ -469,9 +735,80 @@ class Reader {
    */
   Layout layout_;
 
+  /**
+   * The maximum number of persisted tile bytes that the tile pipeline keeps
+   * in flight.
+   */
+  uint64_t read_inflight_size_;
+
+  /** Merges the reads of nearby tiles of the same file. */
+  ReadPlanner read_planner_;
+
+  /**
+   * The maximum number of subarray partitions read ahead of the user.
+   * Zero disables prefetching.
+   */
+  uint64_t read_prefetch_partitions_;
+
+  /**
+   * The maximum number of bytes the staging buffers of the prefetched
+   * partitions may occupy in total.
+   */
+  uint64_t read_prefetch_memory_budget_;
+
+  /**
+   * The memory budget for the fixed-sized tiles (including offsets and
+   * coordinates) of a subarray partition.
+   */
+  uint64_t memory_budget_;
+
+  /** The memory budget for the var-sized tiles of a subarray partition. */
+  uint64_t memory_budget_var_;
+
+  /** The partitions read ahead of the user, in the order of the results. */
+  std::deque<std::unique_ptr<PrefetchedPartition>> prefetched_partitions_;
+
+  /** The thread pool reading the prefetched partitions. */
+  std::unique_ptr<ThreadPool> prefetch_thread_pool_;
+
+  /**
+   * The ranges added along each dimension, stored as `[low, high]` pairs
+   * of the domain type. A dimension without ranges is constrained by the
+   * subarray only.
+   */
+  std::vector<std::vector<uint8_t>> ranges_;
+
+
+  /** The size (in bits) of the offsets of the var-sized attribute buffers. */
+  uint32_t var_offsets_bitsize_;
+
+  /**
+   * If `true`, the offsets of the var-sized attribute buffers end with an
+   * extra element holding the total size of the values.
+   */
+  bool var_offsets_extra_element_;
+
   /** To handle incomplete read queries. */
   ReadState read_state_;
 
+  /** To resume copying the results of a partition that overflowed. */
+  CopyState copy_state_;
+
+  /** `true` if the read produces result views instead of copying. */
+  bool result_views_enabled_;
+
+  /** The result views of the last read, mapped from attribute names. */
+  std::unordered_map<std::string, std::vector<ResultView>> result_views_;
+
+  /**
+   * The decoded tiles handed over to result views, for the tiles of the
+   * current partition, keyed on the overlapping tile and the attribute.
+   */
+  std::map<
+      std::pair<const OverlappingTile*, std::string>,
+      std::shared_ptr<Tile>>
+      view_tiles_;
+
   /** The storage manager. */
   StorageManager* storage_manager_;
 
@@ -479,9 +816,130 @@ class Reader {
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
+  /**
+   * Performs an aggregate query on a sparse array. The whole subarray is
+   * processed at once.
+   *
+   * @return Status
+   */
+  Status aggregate_read();
+
+  /**
+   * Performs an aggregate query on a sparse array. The whole subarray is
+   * processed at once.
+   *
+   * @tparam T The domain type.
+   * @return Status
+   */
+  template <class T>
+  Status aggregate_read();
+
+  /**
+   * Aggregates the results of the input tiles, which may contain cells
+   * with the same coordinates as the cells of other tiles. The tiles are
+   * split into groups that conflict only internally, and the groups are
+   * processed in batches that fit in `sm.read_inflight_size`. The tiles of
+   * each batch are read altogether, and their coordinates are merged and
+   * deduplicated before the cells are aggregated.
+   *
+   * @tparam T The domain type.
+   * @param tiles The tiles.
+   * @return Status
+   */
+  template <class T>
+  Status aggregate_conflicting_tiles(OverlappingTileVec* tiles);
+
+  /**
+   * Aggregates the results of a single tile into the input aggregates.
+   *
+   * @tparam T The domain type.
+   * @param tile The tile, whose tiles for the aggregated attributes (as well
+   *     as the coordinates if the overlap is partial, and the attributes of
+   *     the query condition) must be loaded, unless `from_metadata` is set.
+   * @param from_metadata If `true`, the tile is aggregated from the tile
+   *     statistics of the fragment metadata. Applicable only to fully
+   *     overlapping tiles, when there is no query condition.
+   * @param ranges The ranges of the current partition.
+   * @param aggregates The aggregates to update, one per attribute in the
+   *     order of `aggregate_names`.
+   * @param aggregate_names The names of the aggregated attributes.
+   * @return Status
+   */
+  template <class T>
+  Status aggregate_tile(
+      const OverlappingTile* tile,
+      bool from_metadata,
+      const PartitionRanges<T>& ranges,
+      std::vector<Aggregate>* aggregates,
+      const std::vector<std::string>& aggregate_names) const;
+
+  /**
+   * Aggregates the results of the input tiles, none of which contains
+   * cells with the same coordinates as any other tile. The tiles are
+   * processed in batches whose total size is bounded by
+   * `read_inflight_size_`, and the tiles of each batch are aggregated in
+   * parallel. The tiles that are fully contained in the subarray are
+   * counted from the fragment metadata, and are not read at all if only
+   * counts are requested.
+   *
+   * @tparam T The domain type.
+   * @param tiles The tiles.
+   * @return Status
+   */
+  template <class T>
+  Status aggregate_tiles(OverlappingTileVec* tiles);
+
+  /**
+   * Adds a range along a dimension, after checking it against the
+   * dimension domain.
+   *
+   * @tparam T The domain type.
+   * @param dim_idx The index of the dimension.
+   * @param start The range start.
+   * @param end The range end (inclusive).
+   * @return Status
+   */
+  template <class T>
+  Status add_range(unsigned dim_idx, const T* start, const T* end);
+
+  /**
+   * Removes the cells that do not satisfy the query condition from the
+   * input cell ranges. The condition is evaluated once per tile, on the
+   * tiles of the attributes it refers to, which must be loaded.
+   *
+   * @param cell_ranges The cell ranges to filter.
+   * @return Status
+   */
+  Status apply_query_condition(OverlappingCellRangeList* cell_ranges) const;
+
+  /** Waits for the reads of the prefetched partitions and discards them. */
+  void clear_prefetched_partitions();
+
   /** Clears the read state. */
   void clear_read_state();
 
+  /**
+   * Returns `true` if there are results of the current subarray partition
+   * that have not been copied to the user buffers yet.
+   */
+  bool copy_pending() const;
+
+  /**
+   * Computes the maximal cell ranges of contiguous cell positions directly
+   * from the input coordinate tiles, without materializing the overlapping
+   * coordinates. Fully overlapping tiles produce a single range. This
+   * is applicable only if the results need not be sorted or deduplicated.
+   *
+   * @tparam T The coords type.
+   * @param tiles The overlapping tiles, with their coordinates loaded.
+   * @param cell_ranges The cell ranges to compute.
+   * @return Status
+   */
+  template <class T>
+  Status compute_cell_ranges(
+      const OverlappingTileVec& tiles,
+      OverlappingCellRangeList* cell_ranges) const;
+
   /**
    * Compute the maximal cell ranges of contiguous cell positions.
    *
@@ -495,6 +953,21 @@ class Reader {
       const OverlappingCoordsList<T>& coords,
       OverlappingCellRangeList* cell_ranges) const;
 
+  /**
+   * Groups the input tiles, such that the tiles that may hold cells with
+   * the same coordinates (i.e., tiles of different fragments whose MBRs
+   * overlap inside the subarray partition) end up in the same group,
+   * directly or transitively. Each group can then be deduplicated
+   * independently of the others.
+   *
+   * @tparam T The domain type.
+   * @param tiles The tiles to group.
+   * @param groups The group id of each tile.
+   */
+  template <class T>
+  void compute_conflict_groups(
+      const OverlappingTileVec& tiles, std::vector<size_t>* groups) const;
+
   /**
    * For the given cell range, it computes all the result dense cell ranges
    * across fragments, given precedence to more recent fragments.
@@ -518,6 +991,29 @@ class Reader {
       uint64_t end,
       std::list<DenseCellRange<T>>* dense_cell_ranges);
 
+  /**
+   * For the given cell range, it computes all the result dense cell ranges
+   * from the precomputed runs of the tile. This is applicable only if the
+   * cell ranges of a tile are requested in increasing positions, i.e.,
+   * if the query layout is the cell order.
+   *
+   * @tparam T The domain type.
+   * @param tile_coords The tile coordinates in the array domain.
+   * @param runs The runs of the tile. The next run to look at is advanced
+   *     past the input range.
+   * @param start The start position of the range this function focuses on.
+   * @param end The end position of the range this function focuses on.
+   * @param dense_cell_ranges The cell ranges where the results are appended to.
+   * @return Status
+   */
+  template <class T>
+  Status compute_dense_cell_ranges(
+      const T* tile_coords,
+      DenseTileRuns* runs,
+      uint64_t start,
+      uint64_t end,
+      std::list<DenseCellRange<T>>* dense_cell_ranges) const;
+
   /**
    * Computes the dense overlapping tiles and cell ranges based on the
    * input dense cell ranges. Note that the function also computes
@@ -538,6 +1034,25 @@ class Reader {
       OverlappingTileVec* tiles,
       OverlappingCellRangeList* overlapping_cell_ranges);
 
+  /**
+   * Computes the runs of a tile from the cell ranges of all the dense
+   * fragments in the tile, with a single sweep over the range boundaries
+   * that keeps track of the most recent fragment covering each position.
+   * This replaces comparing the ranges of different fragments one by one.
+   * The cell ranges of each fragment are derived from the cell position
+   * strides of the tile, rather than by advancing its iterator.
+   *
+   * @tparam T The domain type.
+   * @param frag_its The fragment dense cell range iterators of the tile,
+   *     which must iterate in the cell order. Only their subarrays are used.
+   * @param runs The runs to be computed.
+   * @return Status
+   */
+  template <class T>
+  Status compute_dense_tile_runs(
+      const std::vector<DenseCellRangeIter<T>>& frag_its,
+      DenseTileRuns* runs) const;
+
   /**
    * Computes the overlapping coordinates for a given subarray.
    *
@@ -551,21 +1066,44 @@ class Reader {
       const OverlappingTileVec& tiles, OverlappingCoordsList<T>* coords) const;
 
   /**
-   * Retrieves the coordinates that overlap the subarray from the input
-   * overlapping tile.
+   * Retrieves the coordinates that fall in the input partition ranges
+   * from the input overlapping tile.
    *
    * @tparam T The coords type.
    * @param The overlapping tile.
+   * @param ranges The ranges of the current partition (see
+   *     `compute_partition_ranges`).
    * @param coords The overlapping coordinates to retrieve.
    * @return Status
    */
   template <class T>
   Status compute_overlapping_coords(
-      const OverlappingTile* tile, OverlappingCoordsList<T>* coords) const;
+      const OverlappingTile* tile,
+      const PartitionRanges<T>& ranges,
+      OverlappingCoordsList<T>* coords) const;
+
+  /**
+   * Computes a bitmap over the coordinates of the input tile, which has
+   * a 1 for every cell that falls in the input partition ranges and a 0
+   * otherwise. Along each dimension, only the ranges that overlap the tile
+   * MBR are checked.
+   *
+   * @tparam T The coords type.
+   * @param tile The overlapping tile, whose coordinates must be loaded.
+   * @param ranges The ranges of the current partition.
+   * @param bitmap The bitmap to be computed.
+   */
+  template <class T>
+  void compute_coords_bitmap(
+      const OverlappingTile* tile,
+      const PartitionRanges<T>& ranges,
+      std::vector<uint8_t>* bitmap) const;
 
   /**
    * Computes info about the overlapping tiles, such as which fragment they
-   * belong to, the tile index and the type of overlap.
+   * belong to, the tile index and the type of overlap. The R-tree of each
+   * fragment is queried once with the bounding box of the partition
+   * ranges, and the resulting tiles are then checked against the ranges.
    *
    * @tparam T The coords type.
    * @param tiles The tiles to be computed.
@@ -574,6 +1112,125 @@ class Reader {
   template <class T>
   Status compute_overlapping_tiles(OverlappingTileVec* tiles) const;
 
+  /**
+   * Returns the ranges the current subarray partition is constrained on,
+   * i.e., the added ranges of each dimension clipped to the partition,
+   * or the partition range for a dimension without added ranges. A
+   * dimension has no ranges if none of its added ranges overlaps the
+   * partition.
+   *
+   * @tparam T The coords type.
+   * @return The partition ranges.
+   */
+  template <class T>
+  PartitionRanges<T> compute_partition_ranges() const;
+
+  /**
+   * Returns the bounding box of the input partition ranges, or an empty
+   * vector if some dimension has no ranges.
+   *
+   * @tparam T The coords type.
+   * @param ranges The partition ranges.
+   * @return The bounding box.
+   */
+  template <class T>
+  std::vector<T> ranges_bounding_box(const PartitionRanges<T>& ranges) const;
+
+  /**
+   * Returns `true` if the input hyper-rectangle overlaps the input
+   * partition ranges along every dimension.
+   *
+   * @tparam T The coords type.
+   * @param ranges The partition ranges.
+   * @param rect The hyper-rectangle.
+   * @return `true` if there is an overlap.
+   */
+  template <class T>
+  bool overlaps_ranges(const PartitionRanges<T>& ranges, const T* rect) const;
+
+  /**
+   * Returns `true` if the input hyper-rectangle is contained in a single
+   * range of the input partition ranges along every dimension.
+   *
+   * @tparam T The coords type.
+   * @param ranges The partition ranges.
+   * @param rect The hyper-rectangle.
+   * @return `true` if the hyper-rectangle is contained in the ranges.
+   */
+  template <class T>
+  bool contained_in_ranges(
+      const PartitionRanges<T>& ranges, const T* rect) const;
+
+  /**
+   * Sets the subarray to the bounding box of the added ranges.
+   *
+   * @return Status
+   */
+  Status set_subarray_to_ranges();
+
+  /**
+   * Sets the subarray to the bounding box of the added ranges.
+   *
+   * @tparam T The coords type.
+   * @return Status
+   */
+  template <class T>
+  Status set_subarray_to_ranges();
+
+  /**
+   * Returns `true` if the part of the MBR of the input tile inside the
+   * input partition ranges overlaps with any tile of the input fragments.
+   *
+   * @tparam T The domain type.
+   * @param tile The tile.
+   * @param ranges The ranges of the current partition.
+   * @param fragments The indexes of the fragments to check.
+   * @return `true` if there is an overlap.
+   */
+  template <class T>
+  bool overlaps_fragments(
+      const OverlappingTile* tile,
+      const PartitionRanges<T>& ranges,
+      const std::vector<unsigned>& fragments) const;
+
+  /**
+   * Removes the tiles in which no cell can satisfy the query condition,
+   * based on the tile statistics of the fragment metadata. A tile is kept
+   * if it overlaps with tiles of older fragments, since its cells may
+   * overwrite older cells that satisfy the condition.
+   *
+   * @tparam T The domain type.
+   * @param tiles The tiles.
+   */
+  template <class T>
+  void skip_tiles_by_condition(OverlappingTileVec* tiles) const;
+
+  /**
+   * Removes the tiles that none of the input cell ranges points to, i.e.,
+   * the tiles without any cell in the results (e.g., because none of
+   * their coordinates lies in the subarray).
+   *
+   * @param cell_ranges The cell ranges of the results.
+   * @param tiles The tiles.
+   */
+  void skip_tiles_without_results(
+      const OverlappingCellRangeList& cell_ranges,
+      OverlappingTileVec* tiles) const;
+
+  /**
+   * Moves the tiles that may contain cells with the same coordinates as
+   * tiles of other fragments (i.e., whose MBR overlaps, within the subarray,
+   * with the MBR of any tile of another fragment) from `tiles` to
+   * `conflicting_tiles`. The relative order of the tiles is maintained.
+   *
+   * @tparam T The domain type.
+   * @param tiles The tiles.
+   * @param conflicting_tiles The conflicting tiles.
+   */
+  template <class T>
+  void split_conflicting_tiles(
+      OverlappingTileVec* tiles, OverlappingTileVec* conflicting_tiles) const;
+
   /**
    * Computes the tile coordinates for each OverlappingCoords and populates
    * their `tile_coords_` field. The tile coordinates are placed in a
@@ -595,11 +1252,24 @@ class Reader {
    *
    * @param attribute The targeted attribute.
    * @param cell_ranges The cell ranges to copy cells for.
+   * @param tiles The tiles the cell ranges point to, which are handed over
+   *     to the result views, if enabled.
    * @return Status
    */
   Status copy_cells(
       const std::string& attribute,
-      const OverlappingCellRangeList& cell_ranges);
+      const OverlappingCellRangeList& cell_ranges,
+      const std::vector<OverlappingTileVec*>& tiles);
+
+  /**
+   * Copies the staged results of the input prefetched partition into the
+   * user buffers. It returns an error if the user buffers became smaller
+   * than the staged results since the partition was prefetched.
+   *
+   * @param partition The prefetched partition.
+   * @return Status
+   */
+  Status copy_prefetched_partition(PrefetchedPartition* partition);
 
   /**
    * Copies the cells for the input **fixed-sized** attribute and cell
@@ -607,11 +1277,14 @@ class Reader {
    *
    * @param attribute The targeted attribute.
    * @param cell_ranges The cell ranges to copy cells for.
+   * @param tiles The tiles the cell ranges point to, which are handed over
+   *     to the result views, if enabled.
    * @return Status
    */
   Status copy_fixed_cells(
       const std::string& attribute,
-      const OverlappingCellRangeList& cell_ranges);
+      const OverlappingCellRangeList& cell_ranges,
+      const std::vector<OverlappingTileVec*>& tiles);
 
   /**
    * Copies the cells for the input **var-sized** attribute and cell
@@ -625,6 +1298,60 @@ class Reader {
       const std::string& attribute,
       const OverlappingCellRangeList& cell_ranges);
 
+  /**
+   * Creates the result views for the input **fixed-sized** attribute and
+   * cell ranges, instead of copying the cells. The views point into the
+   * decoded tiles, which are handed over to the views, whereas the empty
+   * cell ranges point into a single fill buffer shared by the views.
+   * Consecutive cell ranges of the same tile are merged into a single view.
+   *
+   * @param attribute The targeted attribute.
+   * @param cell_ranges The cell ranges to create views for.
+   * @param tiles The tiles the cell ranges point to.
+   * @return Status
+   */
+  Status create_result_views(
+      const std::string& attribute,
+      const OverlappingCellRangeList& cell_ranges,
+      const std::vector<OverlappingTileVec*>& tiles);
+
+  /**
+   * Copies the input cell ranges of the current subarray partition into the
+   * user buffers, for all attributes. If the results do not fit, it copies
+   * as many cells as fit in all the buffers and keeps the rest of the
+   * cell ranges in `copy_state_`, to be copied in the next read. If not even
+   * a single cell fits, it flags an overflow.
+   *
+   * If a tile pipeline is given, the cells of each attribute it streams
+   * are copied as soon as the tiles of that attribute are ready, and, if
+   * all the results fit, the tiles are released right after the copy.
+   *
+   * @tparam T The domain type.
+   * @param cell_ranges The cell ranges to copy. On return, it holds only
+   *     the cell ranges that were copied.
+   * @param pipeline The pipeline streaming the attribute tiles the cell
+   *     ranges point to, or `nullptr` if all the tiles are ready.
+   * @return Status
+   */
+  template <class T>
+  Status copy_partition_cells(
+      OverlappingCellRangeList* cell_ranges, TilePipeline* pipeline = nullptr);
+
+  /**
+   * Computes the maximum number of cells, starting from the beginning of the
+   * input cell ranges, whose values fit in the buffers of the input
+   * attribute.
+   *
+   * @param attribute The targeted attribute.
+   * @param cell_ranges The cell ranges.
+   * @param max_cell_num The maximum number of cells to consider.
+   * @return The number of cells that fit (at most `max_cell_num`).
+   */
+  uint64_t compute_fitting_cell_num(
+      const std::string& attribute,
+      const OverlappingCellRangeList& cell_ranges,
+      uint64_t max_cell_num) const;
+
   /**
    * Computes offsets into destination buffers for the given attribute's offset
    * and variable-length data, for the given list of cell ranges.
@@ -674,16 +1401,48 @@ class Reader {
   template <class T>
   Status dense_read();
 
+  /**
+   * Performs a dense read in row- or col-major layout by transforming
+   * whole tiles into the result buffers, instead of copying them slab by
+   * slab. This applies only if, for every space tile overlapping the
+   * current subarray partition, a single dense fragment covers the
+   * overlap and supersedes all the others, and if all the results fit
+   * in the buffers. Otherwise, the function does nothing.
+   *
+   * @tparam T The domain type.
+   * @param subarray The current subarray partition.
+   * @param done Set to `true` if the read was performed, and `false`
+   *     otherwise.
+   * @return Status
+   */
+  template <class T>
+  Status dense_read_transform(const std::vector<T>& subarray, bool* done);
+
   /**
    * Fills the coordinate buffer with coordinates. Applicable only to dense
    * arrays when the user explicitly requests the coordinates to be
    * materialized.
    *
    * @tparam T The domain type.
+   * @param start The position (in the result order) of the first cell
+   *     of the current subarray partition to fill the coordinates of.
+   * @param num The number of cells to fill the coordinates of.
    * @return Status
    */
   template <class T>
-  Status fill_coords();
+  typename std::enable_if<std::is_integral<T>::value, Status>::type
+  fill_coords(uint64_t start, uint64_t num);
+
+  /**
+   * Dense arrays have integer domains only, so there are no coordinates to
+   * fill for real domain types. This overload lets the code paths shared
+   * with sparse reads be instantiated for every domain type.
+   */
+  template <class T>
+  typename std::enable_if<!std::is_integral<T>::value, Status>::type
+  fill_coords(uint64_t, uint64_t) {
+    return Status::Ok();
+  }
 
   /**
    * Fills coordinates in the input buffer for a particular cell slab, following
@@ -720,27 +1479,22 @@ class Reader {
       const T* start, uint64_t num, void* buff, uint64_t* offset) const;
 
   /**
-   * Filters the tiles on all attributes from all input fragments based on the
-   * tile info in `tiles`.
+   * Fetches the tile(s) of the input attribute of the input overlapping
+   * tiles, which must belong to the same fragment. The tiles are first
+   * looked up in the tile cache (a tile found in the cache is already
+   * unfiltered), and the rest are read from storage with coalesced
+   * reads.
    *
-   * @param tiles Vector containing tiles to be filtered.
-   * @param ensure_coords If true (the default), always filter the coordinate
-   *    tiles.
+   * @param attribute The attribute whose tile(s) will be fetched.
+   * @param tiles The overlapping tiles.
+   * @param buffers The buffers of the coalesced reads are appended here.
+   *     The fetched tiles point into them.
    * @return Status
    */
-  Status filter_all_tiles(
-      OverlappingTileVec* tiles, bool ensure_coords = true) const;
-
-  /**
-   * Filters the tiles on a particular attribute from all input fragments
-   * based on the tile info in `tiles`.
-   *
-   * @param attribute Attribute whose tiles will be filtered
-   * @param tiles Vector containing the tiles to be filtered
-   * @return Status
-   */
-  Status filter_tiles(
-      const std::string& attribute, OverlappingTileVec* tiles) const;
+  Status fetch_tiles(
+      const std::string& attribute,
+      const std::vector<OverlappingTile*>& tiles,
+      std::list<Buffer>* buffers) const;
 
   /**
    * Runs the input tile for the input attribute through the filter pipeline.
@@ -809,6 +1563,22 @@ class Reader {
   /** Returns `true` if the coordinates are included in the attributes. */
   bool has_coords() const;
 
+  /**
+   * Returns `true` if the results of the input attribute are returned as
+   * result views, in which case they are bounded by the memory budget
+   * instead of the user buffer size.
+   */
+  bool has_result_views(const std::string& attribute) const;
+
+  /**
+   * Creates a reader constrained to the current subarray partition, which
+   * reads into staging buffers sized like the user buffers.
+   *
+   * @param partition The prefetched partition to initialize.
+   * @return Status
+   */
+  Status init_prefetched_partition(PrefetchedPartition* partition);
+
   /** Initializes the read state. */
   Status init_read_state();
 
@@ -854,6 +1624,42 @@ class Reader {
       std::unordered_map<uint64_t, std::pair<uint64_t, std::vector<T>>>*
           overlapping_tile_idx_coords);
 
+  /**
+   * Initializes the input tile pipeline and issues the first fetches.
+   *
+   * @param attributes The attributes whose tiles will be streamed.
+   * @param tiles The tiles to be streamed for each attribute.
+   * @param pipeline The pipeline to initialize.
+   * @return Status
+   */
+  Status init_tile_pipeline(
+      const std::vector<std::string>& attributes,
+      const std::vector<OverlappingTileVec*>& tiles,
+      TilePipeline* pipeline) const;
+
+  /**
+   * Issues tile fetches in the input pipeline, until the in-flight budget
+   * is exhausted or all the tiles have been issued.
+   *
+   * @param pipeline The tile pipeline.
+   * @return Status
+   */
+  Status issue_tile_fetches(TilePipeline* pipeline) const;
+
+  /**
+   * Merges the input coordinates into the global order and deduplicates
+   * them in a single pass, breaking ties giving preference to the largest
+   * fragment index. The coordinates of each fragment must be contiguous
+   * and sorted in the global order, as produced by
+   * `compute_overlapping_coords`.
+   *
+   * @tparam T The coords type.
+   * @param coords The coordinates to merge.
+   * @return Status
+   */
+  template <class T>
+  Status merge_coords(OverlappingCoordsList<T>* coords) const;
+
   /**
    * Optimize the layout for 1D arrays. Specifically, if the array
    * is 1D, the layout should be global order which produces
@@ -862,33 +1668,87 @@ class Reader {
   void optimize_layout_for_1D();
 
   /**
-   * Retrieves the tiles on all attributes from all input fragments based on
-   * the tile info in `tiles`.
+   * Returns the attributes whose tiles are streamed by the tile pipeline
+   * after the coordinates have been processed, i.e., all the attributes
+   * except for the coordinates and the ones the query condition refers to,
+   * which are read upfront. The var-sized attributes come first, since
+   * their tiles are needed to compute how many results fit in the buffers.
+   */
+  std::vector<std::string> pipeline_attributes() const;
+
+  /**
+   * Fetches and unfilters the tiles of the input attributes, based on the
+   * tile info in `tiles`, and waits until they are all ready.
    *
+   * @param attributes The attributes whose tiles will be read.
    * @param tiles The retrieved tiles will be stored in `tiles`.
-   * @param ensure_coords If true (the default), always read the coordinate
-   * tiles.
    * @return Status
    */
   Status read_all_tiles(
-      OverlappingTileVec* tiles, bool ensure_coords = true) const;
+      const std::vector<std::string>& attributes,
+      OverlappingTileVec* tiles) const;
+
+  /**
+   * Reads the input byte ranges of a file into the input tiles, merging
+   * nearby ranges into single reads based on `read_planner_`. The tiles do
+   * not copy the data; their buffers point into the read buffers.
+   *
+   * @param uri The file to read from.
+   * @param ranges The byte ranges of the tiles in the file.
+   * @param tiles The tiles to read into, one per byte range.
+   * @param buffers The buffers of the coalesced reads are appended here.
+   * @return Status
+   */
+  Status read_tile_ranges(
+      const URI& uri,
+      const std::vector<ByteRange>& ranges,
+      const std::vector<Tile*>& tiles,
+      std::list<Buffer>* buffers) const;
 
   /**
-   * Retrieves the tiles on a particular attribute from all input fragments
-   * based on the tile info in `tiles`.
+   * Frees the tiles of the input attribute of the pipeline and releases
+   * their bytes from the in-flight budget, issuing new fetches. The tiles
+   * are freed in place, since the map of each tile is concurrently read by
+   * the fetches of the subsequent attributes.
    *
-   * The reads are done asynchronously, and futures for each read operation are
-   * added to the output parameter.
+   * @param pipeline The tile pipeline.
+   * @param attr_idx The index of the attribute in the pipeline.
+   * @return Status
+   */
+  Status release_tile_pipeline_attribute(
+      TilePipeline* pipeline, size_t attr_idx) const;
+
+  /**
+   * Resets the read state, keeping the subarray, so that the query is
+   * initialized again.
    *
-   * @param attribute The attribute name.
-   * @param tiles The retrieved tiles will be stored in `tiles`.
-   * @param tasks Vector to hold futures for the read tasks.
    * @return Status
    */
-  Status read_tiles(
-      const std::string& attribute,
-      OverlappingTileVec* tiles,
-      std::vector<std::future<Status>>* tasks) const;
+  Status reset_read_state();
+
+  /**
+   * Returns the number of subarray partitions to read ahead of the user,
+   * i.e., `sm.read_prefetch_partitions` capped so that the staging buffers
+   * fit in `sm.read_prefetch_memory_budget`. Zero means that the
+   * partitions are read directly into the user buffers.
+   */
+  uint64_t prefetch_partition_num() const;
+
+  /**
+   * Reads ahead the next subarray partitions, until the number of
+   * prefetched partitions reaches `prefetch_partition_num()`.
+   *
+   * @return Status
+   */
+  Status prefetch_partitions();
+
+  /**
+   * Performs a read that hands back the results of the prefetched
+   * partitions, in order, while the next partitions are being read.
+   *
+   * @return Status
+   */
+  Status prefetch_read();
 
   /**
    * Resets the buffer sizes to the original buffer sizes. This is because
@@ -898,7 +1758,34 @@ class Reader {
   void reset_buffer_sizes();
 
   /**
-   * Sorts the input coordinates according to the input layout.
+   * Sizes the staging buffers of the input prefetched partition like the
+   * current user buffers, and sets them to the partition reader. It is
+   * invoked every time a read of the partition is submitted, since the
+   * user may change the buffers between reads.
+   *
+   * @param partition The prefetched partition.
+   * @return Status
+   */
+  Status set_staging_buffers(PrefetchedPartition* partition);
+
+  /**
+   * Returns `true` if the query layout orders the cells of the current
+   * subarray partition in the global order, i.e., if the layout is the
+   * global order, the array is one-dimensional, or the layout is the cell
+   * order and the partition lies in a single space tile.
+   *
+   * @tparam T The domain type.
+   * @return `true` if the layout is the global order in the partition.
+   */
+  template <class T>
+  bool layout_is_global_order() const;
+
+  /** Returns `true` if all the input tiles belong to the same fragment. */
+  bool single_fragment(const OverlappingTileVec& tiles) const;
+
+  /**
+   * Sorts the input coordinates according to the row- or col-major
+   * layout. The global order is handled by `merge_coords`.
    *
    * @tparam T The coords type.
    * @param coords The coordinates to sort.
@@ -919,6 +1806,40 @@ class Reader {
   template <class T>
   Status sparse_read();
 
+  /**
+   * Unfilters the tile(s) of the input attribute of the input overlapping
+   * tile and inserts the result into the tile cache. It is a noop for tiles
+   * that were found in the cache.
+   *
+   * @param attribute The attribute whose tile(s) will be unfiltered.
+   * @param tile The overlapping tile.
+   * @return Status
+   */
+  Status unfilter_tile(
+      const std::string& attribute, OverlappingTile* tile) const;
+
+  /**
+   * Waits for the pending read of the input prefetched partition.
+   *
+   * @param partition The prefetched partition.
+   * @return Status
+   */
+  Status wait_prefetched_partition(PrefetchedPartition* partition) const;
+
+  /**
+   * Waits until the tiles of the first `attr_num` attributes of the input
+   * pipeline are fetched and unfiltered. The fetched tiles are unfiltered
+   * in parallel as soon as they arrive, while the pipeline keeps issuing
+   * fetches within its in-flight budget. The unfiltered tiles remain
+   * counted against the budget until they are released with
+   * `release_tile_pipeline_attribute`.
+   *
+   * @param pipeline The tile pipeline.
+   * @param attr_num The number of attributes to wait for.
+   * @return Status
+   */
+  Status wait_tile_pipeline(TilePipeline* pipeline, size_t attr_num) const;
+
   /** Zeroes out the user buffer sizes, indicating an empty result. */
   void zero_out_buffer_sizes();
 };
@@ -0,0 +1,623 @@
+/**
+ * @file   subarray_partitioner.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class SubarrayPartitioner.
+ */
+
+#include "tiledb/sm/query/subarray_partitioner.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/domain.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/constants.h"
+#include "tiledb/sm/misc/logger.h"
+#include "tiledb/sm/misc/stats.h"
+#include "tiledb/sm/misc/utils.h"
+#include "tiledb/sm/query/query_macros.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+SubarrayPartitioner::SubarrayPartitioner() {
+  array_schema_ = nullptr;
+  fragment_num_ = 0;
+  layout_ = Layout::ROW_MAJOR;
+  memory_budget_ = constants::memory_budget;
+  memory_budget_var_ = constants::memory_budget_var;
+}
+
+SubarrayPartitioner::~SubarrayPartitioner() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+void SubarrayPartitioner::clear() {
+  attributes_.clear();
+  buffer_sizes_.clear();
+  current_.subarray_.clear();
+  current_.tiles_.clear();
+  fragment_num_ = 0;
+  partitions_.clear();
+  tile_memory_.clear();
+  tile_rects_.clear();
+  tile_sizes_.clear();
+}
+
+bool SubarrayPartitioner::done() const {
+  return partitions_.empty();
+}
+
+Status SubarrayPartitioner::est_buffer_sizes(
+    const void* subarray,
+    std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
+    const {
+  if (array_schema_ == nullptr)
+    return LOG_STATUS(Status::ReaderError(
+        "Cannot estimate buffer sizes; Partitioner not initialized"));
+
+  std::vector<uint64_t> tiles(
+      tile_rects_.size() / (2 * array_schema_->coords_size()));
+  for (uint64_t t = 0; t < tiles.size(); ++t)
+    tiles[t] = t;
+
+  std::vector<std::pair<double, double>> sizes;
+  switch (array_schema_->domain()->type()) {
+    case Datatype::INT8:
+      compute_est_sizes(static_cast<const int8_t*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::UINT8:
+      compute_est_sizes(static_cast<const uint8_t*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::INT16:
+      compute_est_sizes(static_cast<const int16_t*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::UINT16:
+      compute_est_sizes(static_cast<const uint16_t*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::INT32:
+      compute_est_sizes(static_cast<const int*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::UINT32:
+      compute_est_sizes(static_cast<const unsigned*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::INT64:
+      compute_est_sizes(static_cast<const int64_t*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::UINT64:
+      compute_est_sizes(static_cast<const uint64_t*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::FLOAT32:
+      compute_est_sizes(static_cast<const float*>(subarray), tiles, &sizes);
+      break;
+    case Datatype::FLOAT64:
+      compute_est_sizes(static_cast<const double*>(subarray), tiles, &sizes);
+      break;
+    default:
+      return LOG_STATUS(Status::ReaderError(
+          "Cannot estimate buffer sizes; Unsupported domain type"));
+  }
+
+  for (size_t a = 0; a < attributes_.size(); ++a)
+    (*buffer_sizes)[attributes_[a]] = sizes[a];
+
+  return Status::Ok();
+}
+
+Status SubarrayPartitioner::init(
+    const ArraySchema* array_schema,
+    const std::vector<FragmentMetadata*>& fragment_metadata,
+    const void* subarray,
+    Layout layout,
+    const std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>&
+        buffer_sizes) {
+  clear();
+  array_schema_ = array_schema;
+  fragment_num_ = fragment_metadata.size();
+  layout_ = layout;
+  for (const auto& it : buffer_sizes) {
+    attributes_.push_back(it.first);
+    buffer_sizes_.push_back(it.second);
+  }
+
+  switch (array_schema_->domain()->type()) {
+    case Datatype::INT8:
+      init_tiles(fragment_metadata, static_cast<const int8_t*>(subarray));
+      break;
+    case Datatype::UINT8:
+      init_tiles(fragment_metadata, static_cast<const uint8_t*>(subarray));
+      break;
+    case Datatype::INT16:
+      init_tiles(fragment_metadata, static_cast<const int16_t*>(subarray));
+      break;
+    case Datatype::UINT16:
+      init_tiles(fragment_metadata, static_cast<const uint16_t*>(subarray));
+      break;
+    case Datatype::INT32:
+      init_tiles(fragment_metadata, static_cast<const int*>(subarray));
+      break;
+    case Datatype::UINT32:
+      init_tiles(fragment_metadata, static_cast<const unsigned*>(subarray));
+      break;
+    case Datatype::INT64:
+      init_tiles(fragment_metadata, static_cast<const int64_t*>(subarray));
+      break;
+    case Datatype::UINT64:
+      init_tiles(fragment_metadata, static_cast<const uint64_t*>(subarray));
+      break;
+    case Datatype::FLOAT32:
+      init_tiles(fragment_metadata, static_cast<const float*>(subarray));
+      break;
+    case Datatype::FLOAT64:
+      init_tiles(fragment_metadata, static_cast<const double*>(subarray));
+      break;
+    default:
+      return LOG_STATUS(Status::ReaderError(
+          "Cannot initialize subarray partitioner; Unsupported domain type"));
+  }
+
+  return Status::Ok();
+}
+
+Status SubarrayPartitioner::next(
+    void* partition, bool* found, bool* unsplittable) {
+  switch (array_schema_->domain()->type()) {
+    case Datatype::INT8:
+      return next<int8_t>(partition, found, unsplittable);
+    case Datatype::UINT8:
+      return next<uint8_t>(partition, found, unsplittable);
+    case Datatype::INT16:
+      return next<int16_t>(partition, found, unsplittable);
+    case Datatype::UINT16:
+      return next<uint16_t>(partition, found, unsplittable);
+    case Datatype::INT32:
+      return next<int>(partition, found, unsplittable);
+    case Datatype::UINT32:
+      return next<unsigned>(partition, found, unsplittable);
+    case Datatype::INT64:
+      return next<int64_t>(partition, found, unsplittable);
+    case Datatype::UINT64:
+      return next<uint64_t>(partition, found, unsplittable);
+    case Datatype::FLOAT32:
+      return next<float>(partition, found, unsplittable);
+    case Datatype::FLOAT64:
+      return next<double>(partition, found, unsplittable);
+    default:
+      return LOG_STATUS(Status::ReaderError(
+          "Cannot get next subarray partition; Unsupported domain type"));
+  }
+
+  return Status::Ok();
+}
+
+void SubarrayPartitioner::set_memory_budget(
+    uint64_t budget, uint64_t budget_var) {
+  memory_budget_ = budget;
+  memory_budget_var_ = budget_var;
+}
+
+Status SubarrayPartitioner::split_current(bool* unsplittable) {
+  Partition partition_1, partition_2;
+  Status st;
+  switch (array_schema_->domain()->type()) {
+    case Datatype::INT8:
+      st = split<int8_t>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::UINT8:
+      st = split<uint8_t>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::INT16:
+      st = split<int16_t>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::UINT16:
+      st = split<uint16_t>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::INT32:
+      st = split<int>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::UINT32:
+      st = split<unsigned>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::INT64:
+      st = split<int64_t>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::UINT64:
+      st = split<uint64_t>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::FLOAT32:
+      st = split<float>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    case Datatype::FLOAT64:
+      st = split<double>(current_, &partition_1, &partition_2, unsplittable);
+      break;
+    default:
+      return LOG_STATUS(Status::ReaderError(
+          "Cannot split subarray partition; Unsupported domain type"));
+  }
+  RETURN_NOT_OK(st);
+
+  if (!*unsplittable) {
+    partitions_.push_front(std::move(partition_2));
+    partitions_.push_front(std::move(partition_1));
+  }
+
+  return Status::Ok();
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+template <class T>
+bool SubarrayPartitioner::compute_split_value(
+    const Partition& partition, unsigned dim_idx, T* split_value) const {
+  // For easy reference
+  auto domain = array_schema_->domain();
+  auto dim_num = domain->dim_num();
+  auto s = (const T*)&partition.subarray_[0];
+  auto low = s[2 * dim_idx];
+  auto high = s[2 * dim_idx + 1];
+  auto dom_low = static_cast<const T*>(domain->domain())[2 * dim_idx];
+  auto tile_extents = static_cast<const T*>(domain->tile_extents());
+  T e = (std::numeric_limits<T>::is_integer) ?
+            1 :
+            std::numeric_limits<T>::epsilon();
+
+  // Determine the candidate split values. For the global order, a partition
+  // that spans several tiles on the dimension must be split on a tile
+  // boundary (see `Domain::split_subarray_global`), otherwise any value
+  // works. The candidates are indexed in `[0, candidate_num)`.
+  uint64_t candidate_num;
+  uint64_t first_tile = 0;
+  bool by_tile = false;
+  if (layout_ == Layout::GLOBAL_ORDER && tile_extents != nullptr) {
+    auto extent = tile_extents[dim_idx];
+    first_tile = (uint64_t)std::floor((low - dom_low) / extent);
+    auto last_tile = (uint64_t)std::floor((high - dom_low) / extent);
+    by_tile = (first_tile != last_tile);
+    candidate_num = last_tile - first_tile;
+  }
+  if (!by_tile) {
+    candidate_num = std::numeric_limits<T>::is_integer ?
+                        (uint64_t)high - (uint64_t)low :
+                        constants::partitioner_real_split_num;
+  }
+  if (candidate_num == 0)
+    return false;
+
+  auto candidate = [&](uint64_t i) -> T {
+    if (by_tile)
+      return (T)(dom_low + (first_tile + i + 1) * tile_extents[dim_idx] - e);
+    if (std::numeric_limits<T>::is_integer)
+      return (T)((uint64_t)low + i);
+    return (T)(low + (high - low) * ((double)i / candidate_num));
+  };
+
+  // Returns the weight difference of the two halves for a candidate
+  std::vector<T> s1(s, s + 2 * dim_num), s2(s, s + 2 * dim_num);
+  std::vector<std::pair<double, double>> sizes_1, sizes_2;
+  auto imbalance = [&](uint64_t i) -> double {
+    s1[2 * dim_idx + 1] = candidate(i);
+    s2[2 * dim_idx] = s1[2 * dim_idx + 1] + e;
+    compute_est_sizes(&s1[0], partition.tiles_, &sizes_1);
+    compute_est_sizes(&s2[0], partition.tiles_, &sizes_2);
+    return weight(sizes_1) - weight(sizes_2);
+  };
+
+  // Binary search for the first candidate where the first half becomes
+  // at least as heavy as the second one
+  uint64_t left = 0, right = candidate_num - 1;
+  while (left < right) {
+    auto mid = left + (right - left) / 2;
+    if (imbalance(mid) >= 0)
+      right = mid;
+    else
+      left = mid + 1;
+  }
+
+  // The previous candidate may be better balanced
+  if (left > 0 && std::fabs(imbalance(left - 1)) < std::fabs(imbalance(left)))
+    --left;
+
+  *split_value = candidate(left);
+  return *split_value >= low && *split_value < high;
+}
+
+template <class T>
+void SubarrayPartitioner::compute_est_sizes(
+    const T* subarray,
+    const std::vector<uint64_t>& tiles,
+    std::vector<std::pair<double, double>>* sizes) const {
+  // For easy reference
+  auto domain = array_schema_->domain();
+  auto dim_num = domain->dim_num();
+  auto attr_num = attributes_.size();
+  auto rect_size = 2 * dim_num * sizeof(T);
+  sizes->assign(attr_num, std::pair<double, double>(0, 0));
+
+  // Return if there are no fragments
+  if (fragment_num_ == 0)
+    return;
+
+  // Add the covered portion of every overlapping tile
+  std::vector<T> overlap_rect(2 * dim_num);
+  bool overlap;
+  for (auto t : tiles) {
+    auto rect = (const T*)&tile_rects_[t * rect_size];
+    utils::geometry::overlap(
+        subarray, rect, dim_num, &overlap_rect[0], &overlap);
+    if (!overlap)
+      continue;
+    auto cov = utils::geometry::coverage(&overlap_rect[0], rect, dim_num);
+    for (size_t a = 0; a < attr_num; ++a) {
+      (*sizes)[a].first += cov * tile_sizes_[t * attr_num + a].first;
+      (*sizes)[a].second += cov * tile_sizes_[t * attr_num + a].second;
+    }
+  }
+
+  // Rectify the estimate with the number of cells in the subarray.
+  // `cell_num` becomes 0 when `subarray` is huge, leading to a
+  // `uint64_t` overflow.
+  if (!array_schema_->dense() && !datatype_is_integer(domain->type()))
+    return;
+  auto cell_num = domain->cell_num(subarray);
+  if (cell_num == 0)
+    return;
+  for (size_t a = 0; a < attr_num; ++a) {
+    const auto& attr = attributes_[a];
+    auto var_size = array_schema_->var_size(attr);
+    if (array_schema_->dense()) {
+      (*sizes)[a].first = var_size ?
+                              cell_num * constants::cell_var_offset_size :
+                              cell_num * array_schema_->cell_size(attr);
+    } else if (!var_size) {
+      // Check for overflow
+      uint64_t new_size = cell_num * array_schema_->cell_size(attr);
+      if (new_size / array_schema_->cell_size(attr) != cell_num)
+        continue;
+      (*sizes)[a].first = MIN((*sizes)[a].first, new_size);
+    }
+  }
+}
+
+template <class T>
+void SubarrayPartitioner::init_tiles(
+    const std::vector<FragmentMetadata*>& fragment_metadata,
+    const T* subarray) {
+  // Cache the tiles overlapping with the subarray
+  auto attr_num = attributes_.size();
+  std::vector<uint64_t> tile_ids;
+  std::vector<T> tile_rects;
+  for (const auto& meta : fragment_metadata) {
+    tile_ids.clear();
+    meta->get_overlapping_tiles(subarray, &tile_ids, &tile_rects);
+    auto has_coords = !meta->dense() &&
+                      std::find(
+                          attributes_.begin(),
+                          attributes_.end(),
+                          constants::coords) == attributes_.end();
+    for (auto tid : tile_ids) {
+      std::pair<uint64_t, uint64_t> memory(0, 0);
+      if (has_coords)
+        memory.first += meta->tile_size(constants::coords, tid);
+      for (size_t a = 0; a < attr_num; ++a) {
+        const auto& attr = attributes_[a];
+        auto var_size = array_schema_->var_size(attr);
+        auto size = meta->tile_size(attr, tid);
+        auto var_size_bytes = var_size ? meta->tile_var_size(attr, tid) : 0;
+        tile_sizes_.emplace_back((double)size, (double)var_size_bytes);
+        memory.first += size;
+        memory.second += var_size_bytes;
+      }
+      tile_memory_.push_back(memory);
+    }
+  }
+  auto rects_size = tile_rects.size() * sizeof(T);
+  tile_rects_.resize(rects_size);
+  if (rects_size != 0)
+    std::memcpy(&tile_rects_[0], &tile_rects[0], rects_size);
+
+  // The whole subarray is the first partition
+  Partition partition;
+  auto subarray_size = 2 * array_schema_->dim_num() * sizeof(T);
+  partition.subarray_.resize(subarray_size);
+  std::memcpy(&partition.subarray_[0], subarray, subarray_size);
+  auto tile_num = tile_rects.size() / (2 * array_schema_->dim_num());
+  partition.tiles_.resize(tile_num);
+  for (uint64_t t = 0; t < tile_num; ++t)
+    partition.tiles_[t] = t;
+  partitions_.push_back(std::move(partition));
+}
+
+bool SubarrayPartitioner::must_split(
+    const std::vector<std::pair<double, double>>& sizes) const {
+  for (size_t a = 0; a < attributes_.size(); ++a) {
+    auto var_size = array_schema_->var_size(attributes_[a]);
+    if (uint64_t(round(sizes[a].first)) > buffer_sizes_[a].first)
+      return true;
+    if (var_size && uint64_t(round(sizes[a].second)) > buffer_sizes_[a].second)
+      return true;
+  }
+  return false;
+}
+
+bool SubarrayPartitioner::over_memory_budget(
+    const std::vector<uint64_t>& tiles) const {
+  uint64_t memory = 0, memory_var = 0;
+  for (auto t : tiles) {
+    memory += tile_memory_[t].first;
+    memory_var += tile_memory_[t].second;
+    if (memory > memory_budget_ || memory_var > memory_budget_var_)
+      return true;
+  }
+  return false;
+}
+
+bool SubarrayPartitioner::no_results(
+    const std::vector<std::pair<double, double>>& sizes) const {
+  for (const auto& size : sizes) {
+    if (size.first != 0)
+      return false;
+  }
+  return true;
+}
+
+template <class T>
+Status SubarrayPartitioner::next(
+    void* partition, bool* found, bool* unsplittable) {
+  *found = false;
+  *unsplittable = false;
+
+  // Loop until a partition whose result fits in the buffers is found
+  std::vector<std::pair<double, double>> sizes;
+  while (!partitions_.empty()) {
+    auto next = std::move(partitions_.front());
+    partitions_.pop_front();
+
+    // Handle case of no results
+    compute_est_sizes((const T*)&next.subarray_[0], next.tiles_, &sizes);
+    if (no_results(sizes))
+      continue;
+
+    // Handle case of split. A partition whose results fit in the buffers
+    // but whose tiles exceed the memory budget is split only if this
+    // leaves fewer tiles in one of the halves, since the tiles of a single
+    // region cannot be read in pieces.
+    auto results_fit = !must_split(sizes);
+    if (!results_fit || over_memory_budget(next.tiles_)) {
+      Partition partition_1, partition_2;
+      RETURN_NOT_OK(split<T>(next, &partition_1, &partition_2, unsplittable));
+      auto useful = !results_fit ||
+                    partition_1.tiles_.size() < next.tiles_.size() ||
+                    partition_2.tiles_.size() < next.tiles_.size();
+      if (!*unsplittable && useful) {
+        STATS_COUNTER_ADD_IF(results_fit, reader_num_memory_budget_splits, 1);
+        partitions_.push_front(std::move(partition_2));
+        partitions_.push_front(std::move(partition_1));
+        continue;
+      }
+      if (results_fit)
+        *unsplittable = false;
+    }
+
+    current_ = std::move(next);
+    std::memcpy(partition, &current_.subarray_[0], current_.subarray_.size());
+    *found = true;
+    break;
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status SubarrayPartitioner::split(
+    const Partition& partition,
+    Partition* partition_1,
+    Partition* partition_2,
+    bool* unsplittable) const {
+  // For easy reference
+  auto domain = array_schema_->domain();
+  auto dim_num = domain->dim_num();
+  auto subarray_size = partition.subarray_.size();
+  auto s = (const T*)&partition.subarray_[0];
+
+  // Let the domain pick the dimension to split on based on the layout
+  void *subarray_1 = nullptr, *subarray_2 = nullptr;
+  RETURN_NOT_OK(domain->split_subarray(
+      (void*)&partition.subarray_[0], layout_, &subarray_1, &subarray_2));
+  *unsplittable = (subarray_1 == nullptr || subarray_2 == nullptr);
+  if (*unsplittable) {
+    std::free(subarray_1);
+    std::free(subarray_2);
+    return Status::Ok();
+  }
+  partition_1->subarray_.resize(subarray_size);
+  std::memcpy(&partition_1->subarray_[0], subarray_1, subarray_size);
+  partition_2->subarray_.resize(subarray_size);
+  std::memcpy(&partition_2->subarray_[0], subarray_2, subarray_size);
+  std::free(subarray_1);
+  std::free(subarray_2);
+
+  // Move the split point so that the halves have similar estimated results
+  auto s1 = (T*)&partition_1->subarray_[0];
+  auto s2 = (T*)&partition_2->subarray_[0];
+  unsigned dim_idx = 0;
+  while (dim_idx < dim_num && s1[2 * dim_idx + 1] == s[2 * dim_idx + 1])
+    ++dim_idx;
+  assert(dim_idx < dim_num);
+  T split_value;
+  if (!partition.tiles_.empty() &&
+      compute_split_value(partition, dim_idx, &split_value)) {
+    T e = (std::numeric_limits<T>::is_integer) ?
+              1 :
+              std::numeric_limits<T>::epsilon();
+    s1[2 * dim_idx + 1] = split_value;
+    s2[2 * dim_idx] = split_value + e;
+  }
+
+  // Each half keeps only the cached tiles that overlap with it
+  auto rect_size = 2 * dim_num * sizeof(T);
+  for (auto t : partition.tiles_) {
+    auto rect = (const T*)&tile_rects_[t * rect_size];
+    if (utils::geometry::overlap(s1, rect, dim_num))
+      partition_1->tiles_.push_back(t);
+    if (utils::geometry::overlap(s2, rect, dim_num))
+      partition_2->tiles_.push_back(t);
+  }
+
+  return Status::Ok();
+}
+
+double SubarrayPartitioner::weight(
+    const std::vector<std::pair<double, double>>& sizes) const {
+  double weight = 0;
+  for (size_t a = 0; a < attributes_.size(); ++a) {
+    weight =
+        MAX(weight, sizes[a].first / MAX(buffer_sizes_[a].first, (uint64_t)1));
+    if (array_schema_->var_size(attributes_[a]))
+      weight = MAX(
+          weight,
+          sizes[a].second / MAX(buffer_sizes_[a].second, (uint64_t)1));
+  }
+  return weight;
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,309 @@
+/**
+ * @file   subarray_partitioner.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class SubarrayPartitioner.
+ */
+
+#ifndef TILEDB_SUBARRAY_PARTITIONER_H
+#define TILEDB_SUBARRAY_PARTITIONER_H
+
+#include "tiledb/sm/enums/layout.h"
+#include "tiledb/sm/misc/status.h"
+
+#include <cinttypes>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+class ArraySchema;
+class FragmentMetadata;
+
+/**
+ * Partitions a read subarray into partitions whose estimated results fit
+ * in the user buffers, and whose overlapping tiles fit in the memory
+ * budget.
+ *
+ * Upon initialization, the partitioner finds the tiles of all fragments
+ * that overlap with the original subarray once, and caches the rectangle
+ * each tile covers along with its (uncompressed) attribute sizes. The
+ * result size of any partition is then estimated from the cached tiles
+ * only, and every partition carries the subset of the cached tiles that
+ * overlap with it, so that the estimation cost shrinks as the partitions
+ * get smaller.
+ *
+ * A partition that does not fit is split along the dimension dictated by
+ * the query layout (see `Domain::split_subarray`), but at the point that
+ * balances the estimated result sizes of the two halves, rather than at
+ * the middle of the partition.
+ */
+class SubarrayPartitioner {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  SubarrayPartitioner();
+
+  /** Destructor. */
+  ~SubarrayPartitioner();
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Clears the cached tiles and the pending partitions. */
+  void clear();
+
+  /** Returns `true` if there are no more pending partitions. */
+  bool done() const;
+
+  /**
+   * Sets the memory budget for the (decompressed) tiles that overlap with
+   * a partition. A partition whose tiles exceed the budget is split, as
+   * long as the split leaves fewer tiles in at least one of the halves.
+   * This must be called before `init`.
+   *
+   * @param budget The budget for the fixed-sized tiles (including offsets
+   *     and coordinates).
+   * @param budget_var The budget for the tiles of var-sized values.
+   */
+  void set_memory_budget(uint64_t budget, uint64_t budget_var);
+
+  /**
+   * Computes an estimate on the buffer sizes needed when reading the input
+   * subarray, which must be contained in the subarray the partitioner
+   * was initialized with.
+   *
+   * @param subarray The targeted subarray.
+   * @param buffer_sizes The estimates are retrieved in this map, for the
+   *     attributes the partitioner was initialized with. For fixed-sized
+   *     attributes, only the first size is useful. For var-sized attributes,
+   *     the first is the offsets size, whereas the second is the data size.
+   * @return Status
+   */
+  Status est_buffer_sizes(
+      const void* subarray,
+      std::unordered_map<std::string, std::pair<double, double>>* buffer_sizes)
+      const;
+
+  /**
+   * Initializes the partitioner. It caches the tiles overlapping with
+   * `subarray` and sets `subarray` as the single pending partition.
+   *
+   * @param array_schema The array schema.
+   * @param fragment_metadata The fragment metadata of the array.
+   * @param subarray The subarray to be partitioned.
+   * @param layout The query layout, which the partitions must respect.
+   * @param buffer_sizes Maps each attribute to the sizes of its buffers
+   *     (fixed and var-sized). The partitions are created so that their
+   *     estimated results fit in these sizes.
+   * @return Status
+   */
+  Status init(
+      const ArraySchema* array_schema,
+      const std::vector<FragmentMetadata*>& fragment_metadata,
+      const void* subarray,
+      Layout layout,
+      const std::unordered_map<std::string, std::pair<uint64_t, uint64_t>>&
+          buffer_sizes);
+
+  /**
+   * Retrieves the next pending partition whose estimated result fits
+   * in the buffers, splitting the pending partitions as needed. Partitions
+   * with no estimated results are skipped.
+   *
+   * @param partition The next partition is copied here.
+   * @param found Set to `false` if there are no more partitions.
+   * @param unsplittable Set to `true` if the retrieved partition does not
+   *     fit in the buffers, but cannot be split any further.
+   * @return Status
+   */
+  Status next(void* partition, bool* found, bool* unsplittable);
+
+  /**
+   * Splits the partition last retrieved with `next` (e.g., because its
+   * actual results did not fit in the buffers) and makes the two halves
+   * the next pending partitions.
+   *
+   * @param unsplittable Set to `true` if the partition cannot be split.
+   * @return Status
+   */
+  Status split_current(bool* unsplittable);
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE TYPES            */
+  /* ********************************* */
+
+  /** A partition of the subarray. */
+  struct Partition {
+    /** The partition subarray. */
+    std::vector<uint8_t> subarray_;
+    /** The indexes of the cached tiles that overlap with the partition. */
+    std::vector<uint64_t> tiles_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The array schema. */
+  const ArraySchema* array_schema_;
+
+  /** The attributes whose result sizes are estimated. */
+  std::vector<std::string> attributes_;
+
+  /** The buffer sizes (fixed and var-sized) of each attribute. */
+  std::vector<std::pair<uint64_t, uint64_t>> buffer_sizes_;
+
+  /** The partition last retrieved with `next`. */
+  Partition current_;
+
+  /** The memory budget for the fixed-sized tiles of a partition. */
+  uint64_t memory_budget_;
+
+  /** The memory budget for the var-sized tiles of a partition. */
+  uint64_t memory_budget_var_;
+
+  /** The number of fragments of the array. */
+  uint64_t fragment_num_;
+
+  /** The query layout. */
+  Layout layout_;
+
+  /** The pending partitions. The head is the one to be examined next. */
+  std::list<Partition> partitions_;
+
+  /** The rectangles covered by the cached tiles, stored contiguously. */
+  std::vector<uint8_t> tile_rects_;
+
+  /**
+   * The attribute sizes (fixed and var-sized) of the cached tiles. The
+   * sizes of attribute `a` in tile `t` are at `t * attributes_.size() + a`.
+   */
+  std::vector<std::pair<double, double>> tile_sizes_;
+
+  /**
+   * The memory (fixed and var-sized) needed for the tiles of all the
+   * attributes (including the coordinates of sparse fragments) of every
+   * cached tile.
+   */
+  std::vector<std::pair<uint64_t, uint64_t>> tile_memory_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Computes the balanced split value of a partition along the input
+   * dimension, i.e., the value `v` such that the estimated results of the
+   * partition constrained to `[low, v]` and to `(v, high]` on the dimension
+   * are as close as possible. The candidate values respect the layout.
+   *
+   * @tparam T The domain type.
+   * @param partition The partition to be split.
+   * @param dim_idx The dimension to split on.
+   * @param split_value The split value to be retrieved.
+   * @return `true` if a split value was found.
+   */
+  template <class T>
+  bool compute_split_value(
+      const Partition& partition, unsigned dim_idx, T* split_value) const;
+
+  /**
+   * Computes the estimated attribute sizes of a subarray from the input
+   * cached tiles.
+   *
+   * @tparam T The domain type.
+   * @param subarray The targeted subarray.
+   * @param tiles The indexes of the cached tiles to be considered.
+   * @param sizes The estimated sizes (fixed and var-sized) of each
+   *     attribute, in the order of `attributes_`.
+   */
+  template <class T>
+  void compute_est_sizes(
+      const T* subarray,
+      const std::vector<uint64_t>& tiles,
+      std::vector<std::pair<double, double>>* sizes) const;
+
+  /** Initializes the tile cache for the input subarray. */
+  template <class T>
+  void init_tiles(
+      const std::vector<FragmentMetadata*>& fragment_metadata,
+      const T* subarray);
+
+  /** Returns `true` if any of the input sizes exceeds the buffer sizes. */
+  bool must_split(const std::vector<std::pair<double, double>>& sizes) const;
+
+  /**
+   * Returns `true` if the memory needed for the input cached tiles exceeds
+   * the memory budget.
+   */
+  bool over_memory_budget(const std::vector<uint64_t>& tiles) const;
+
+  /** Returns `true` if the input sizes indicate no results. */
+  bool no_results(const std::vector<std::pair<double, double>>& sizes) const;
+
+  /** Implements `next` for the input domain type. */
+  template <class T>
+  Status next(void* partition, bool* found, bool* unsplittable);
+
+  /**
+   * Splits a partition into two partitions, respecting the layout.
+   *
+   * @tparam T The domain type.
+   * @param partition The partition to be split.
+   * @param partition_1 The first partition resulting from the split.
+   * @param partition_2 The second partition resulting from the split.
+   * @param unsplittable Set to `true` if the partition cannot be split.
+   * @return Status
+   */
+  template <class T>
+  Status split(
+      const Partition& partition,
+      Partition* partition_1,
+      Partition* partition_2,
+      bool* unsplittable) const;
+
+  /**
+   * Returns the largest ratio of an estimated size over the corresponding
+   * buffer size. This is used as the weight of a partition.
+   */
+  double weight(const std::vector<std::pair<double, double>>& sizes) const;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_SUBARRAY_PARTITIONER_H
@@ -32,6 +32,10 @@
 
 #ifndef TILEDB_TYPES_H
 #define TILEDB_TYPES_H
+
+#include <cinttypes>
+#include <memory>
+
 namespace tiledb {
 namespace sm {
 
@@ -97,6 +101,27 @@ struct AttributeBuffer {
         (buffer_var_size_ != nullptr) ? *buffer_var_size : 0;
   }
 };
+
+/**
+ * A read-only view of the results of a fixed-sized attribute, which points
+ * into memory owned by TileDB (e.g., a decoded tile) instead of a user
+ * buffer.
+ */
+struct ResultView {
+  /** The start of the results. */
+  const void* data_;
+  /** The size (in bytes) of the results. */
+  uint64_t size_;
+  /** Keeps the memory the view points into alive. */
+  std::shared_ptr<void> handle_;
+
+  /** Constructor. */
+  ResultView(const void* data, uint64_t size, std::shared_ptr<void> handle)
+      : data_(data)
+      , size_(size)
+      , handle_(std::move(handle)) {
+  }
+};
 }  // namespace sm
 }  // namespace tiledb
 #endif  // TILEDB_TYPES_H
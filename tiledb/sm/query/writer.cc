@@ -37,12 +37,18 @@
 #include "tiledb/sm/misc/stats.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/misc/uuid.h"
+#include "tiledb/sm/query/aggregate.h"
 #include "tiledb/sm/query/query_macros.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/sm/tile/tile_io.h"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <type_traits>
 
 namespace tiledb {
 namespace sm {
@@ -57,11 +63,19 @@ Writer::Writer() {
   global_write_state_.reset(nullptr);
   initialized_ = false;
   layout_ = Layout::ROW_MAJOR;
+  memory_budget_ = constants::memory_budget;
+  memory_budget_var_ = constants::memory_budget_var;
+  write_batch_size_ = constants::write_batch_size;
+  write_staging_buffers_ = constants::write_staging_buffers;
+  next_staged_batch_ = 0;
   storage_manager_ = nullptr;
   subarray_ = nullptr;
+  var_offsets_bitsize_ = constants::var_offsets_bitsize;
+  var_offsets_extra_element_ = constants::var_offsets_extra_element;
 }
 
 Writer::~Writer() {
+  clear_staged_batches();
   std::free(subarray_);
 }
 
@@ -85,6 +99,13 @@ AttributeBuffer Writer::buffer(const std::string& attribute) const {
 }
 
 Status Writer::finalize() {
+  // Finalize the writer of the staged batches once they are all written
+  if (async_writer_ != nullptr) {
+    wait_staged_batches();
+    RETURN_NOT_OK(async_status_);
+    return async_writer_->finalize();
+  }
+
   if (global_write_state_ != nullptr)
     return finalize_global_write_state();
   return Status::Ok();
@@ -162,6 +183,11 @@ Status Writer::init() {
   check_coord_oob_ = !strcmp(check_coord_oob, "true");
   check_global_order_ = !strcmp(check_global_order, "true");
   dedup_coords_ = !strcmp(dedup_coords, "true");
+  auto sm_params = config.sm_params();
+  memory_budget_ = sm_params.memory_budget_;
+  memory_budget_var_ = sm_params.memory_budget_var_;
+  write_batch_size_ = sm_params.write_batch_size_;
+  write_staging_buffers_ = sm_params.write_staging_buffers_;
   initialized_ = true;
 
   return Status::Ok();
@@ -284,6 +310,12 @@ Status Writer::set_layout(Layout layout) {
     return LOG_STATUS(Status::WriterError(
         "Cannot set layout; The array is defined as a key-value store"));
 
+  // The Hilbert layout is applicable only to the cell order
+  if (layout == Layout::HILBERT)
+    return LOG_STATUS(Status::WriterError(
+        "Cannot set layout; The Hilbert layout is applicable only to the "
+        "cell order of sparse arrays"));
+
   // Ordered layout for writes in sparse arrays is meaningless
   if (!array_schema_->dense() &&
       (layout == Layout::COL_MAJOR || layout == Layout::ROW_MAJOR))
@@ -299,6 +331,9 @@ Status Writer::set_layout(Layout layout) {
 
 void Writer::set_storage_manager(StorageManager* storage_manager) {
   storage_manager_ = storage_manager;
+  auto sm_params = storage_manager_->config().sm_params();
+  var_offsets_bitsize_ = sm_params.var_offsets_bitsize_;
+  var_offsets_extra_element_ = sm_params.var_offsets_extra_element_;
 }
 
 Status Writer::set_subarray(const void* subarray) {
@@ -314,7 +349,7 @@ Status Writer::set_subarray(const void* subarray) {
   }
 
   // Reset the writer (this will nuke the global write state)
-  reset();
+  RETURN_NOT_OK(reset());
 
   uint64_t subarray_size = 2 * array_schema_->coords_size();
   if (subarray_ == nullptr)
@@ -331,16 +366,46 @@ Status Writer::set_subarray(const void* subarray) {
   return Status::Ok();
 }
 
+Status Writer::set_var_offsets_format(uint32_t bitsize, bool extra_element) {
+  if (initialized_)
+    return LOG_STATUS(Status::WriterError(
+        "Cannot set var offsets format; Query already initialized"));
+  if (bitsize != 32 && bitsize != 64)
+    return LOG_STATUS(Status::WriterError(
+        "Cannot set var offsets format; Invalid offset bitsize"));
+
+  var_offsets_bitsize_ = bitsize;
+  var_offsets_extra_element_ = extra_element;
+
+  return Status::Ok();
+}
+
 void* Writer::subarray() const {
   return subarray_;
 }
 
+uint32_t Writer::var_offsets_bitsize() const {
+  return var_offsets_bitsize_;
+}
+
+bool Writer::var_offsets_extra_element() const {
+  return var_offsets_extra_element_;
+}
+
 Status Writer::write() {
   STATS_FUNC_IN(writer_write);
 
+  if (write_staging_buffers_ > 0)
+    return async_write();
+
   if (check_coord_oob_)
     RETURN_NOT_OK(check_coord_oob());
 
+  // Write with 64-bit offsets; the guard restores the user buffers on
+  // every exit path
+  ConvertedOffsetsGuard guard(this);
+  RETURN_NOT_OK(convert_var_offsets(&guard.user_buffers_));
+
   if (layout_ == Layout::COL_MAJOR || layout_ == Layout::ROW_MAJOR) {
     RETURN_NOT_OK(ordered_write());
   } else if (layout_ == Layout::UNORDERED) {
@@ -359,6 +424,29 @@ Status Writer::write() {
 /*          PRIVATE METHODS       */
 /* ****************************** */
 
+Status Writer::async_write() {
+  if (async_writer_ == nullptr)
+    RETURN_NOT_OK(init_async_writer());
+
+  // Reuse the staging buffers of the oldest batch, waiting for its write
+  // if all the batches are in use
+  auto batch = &staged_batches_[next_staged_batch_];
+  next_staged_batch_ = (next_staged_batch_ + 1) % staged_batches_.size();
+  if (batch->task_.valid()) {
+    if (batch->task_.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready)
+      STATS_COUNTER_ADD(writer_num_staging_stalls, 1);
+    RETURN_NOT_OK(batch->task_.get());
+  }
+
+  RETURN_NOT_OK(stage_batch(batch));
+  batch->task_ = staging_thread_pool_->enqueue(
+      [this, batch]() { return write_staged_batch(batch); });
+  STATS_COUNTER_ADD(writer_num_staged_batches, 1);
+
+  return Status::Ok();
+}
+
 Status Writer::check_attributes() {
   // There should be no duplicate attributes
   std::set<std::string> unique_attributes;
@@ -405,7 +493,9 @@ Status Writer::check_buffer_sizes() const {
     auto it = attr_buffers_.find(attr);
     auto buffer_size = *it->second.buffer_size_;
     if (is_var) {
-      expected_cell_num = buffer_size / constants::cell_var_offset_size;
+      expected_cell_num = buffer_size / (var_offsets_bitsize_ / 8);
+      if (var_offsets_extra_element_ && expected_cell_num > 0)
+        --expected_cell_num;
     } else {
       expected_cell_num = buffer_size / array_schema_->cell_size(attr);
     }
@@ -615,14 +705,14 @@ Status Writer::check_global_order() const {
   auto domain = array_schema_->domain();
 
   // Check if all coordinates fall in the domain in parallel
+  std::vector<uint64_t> hilbert_keys;
+  compute_hilbert_keys<T>(coords_buff, coords_num, &hilbert_keys);
+  GlobalCmp<T> cmp(
+      domain,
+      coords_buff,
+      hilbert_keys.empty() ? nullptr : hilbert_keys.data());
   auto statuses = parallel_for(0, coords_num - 1, [&](uint64_t i) {
-    auto tile_cmp = domain->tile_order_cmp<T>(
-        &coords_buff[i * dim_num], &coords_buff[(i + 1) * dim_num]);
-    auto fail = (tile_cmp > 0) ||
-                ((tile_cmp == 0) && domain->cell_order_cmp<T>(
-                                        &coords_buff[i * dim_num],
-                                        &coords_buff[(i + 1) * dim_num]) > 0);
-    if (fail) {
+    if (cmp(i + 1, i)) {
       std::stringstream ss;
       ss << "Write failed; Coordinates (" << coords_buff[i * dim_num];
       for (unsigned int j = 1; j < dim_num; ++j)
@@ -719,6 +809,12 @@ Status Writer::check_subarray() const {
   return Status::Ok();
 }
 
+void Writer::clear_staged_batches() {
+  wait_staged_batches();
+  staged_batches_.clear();
+  next_staged_batch_ = 0;
+}
+
 Status Writer::close_files(FragmentMetadata* meta) const {
   for (const auto& attr : attributes_) {
     RETURN_NOT_OK(storage_manager_->close_file(meta->attr_uri(attr)));
@@ -786,6 +882,20 @@ Status Writer::compute_coord_dups(std::set<uint64_t>* coord_dups) const {
   STATS_FUNC_OUT(writer_compute_coord_dups_global);
 }
 
+uint64_t Writer::count_coord_dups(
+    const std::vector<uint64_t>& cell_pos,
+    const std::set<uint64_t>& coord_dups,
+    uint64_t begin,
+    uint64_t end) const {
+  if (coord_dups.empty())
+    return 0;
+
+  uint64_t dups_num = 0;
+  for (auto i = begin; i < end; ++i)
+    dups_num += coord_dups.count(cell_pos[i]);
+  return dups_num;
+}
+
 template <class T>
 Status Writer::compute_coords_metadata(
     const std::vector<Tile>& tiles, FragmentMetadata* meta) const {
@@ -843,6 +953,171 @@ Status Writer::compute_coords_metadata(
   STATS_FUNC_OUT(writer_compute_coords_metadata);
 }
 
+template <class T>
+Status Writer::compute_global_order_keys(
+    const T* coords,
+    uint64_t coords_num,
+    std::vector<uint64_t>* keys,
+    unsigned* key_bits) const {
+  *key_bits = 0;
+  if (!std::is_integral<T>::value)
+    return Status::Ok();
+
+  // For easy reference
+  auto domain = array_schema_->domain();
+  auto dim_num = domain->dim_num();
+  auto dom = (const T*)domain->domain();
+  auto tile_extents = (const T*)domain->tile_extents();
+  const uint64_t max_key = std::numeric_limits<uint64_t>::max();
+
+  // Compute the number of tiles and the number of cells per tile along each
+  // dimension, giving up if the keys would overflow. Without tile extents,
+  // the domain is a single tile.
+  std::vector<uint64_t> spans(dim_num), tile_nums(dim_num), cell_nums(dim_num);
+  uint64_t tile_num = 1, cell_num = 1;
+  for (unsigned i = 0; i < dim_num; ++i) {
+    spans[i] = (uint64_t)dom[2 * i + 1] - (uint64_t)dom[2 * i];
+    if (tile_extents == nullptr) {
+      if (spans[i] == max_key)
+        return Status::Ok();
+      tile_nums[i] = 1;
+      cell_nums[i] = spans[i] + 1;
+    } else {
+      cell_nums[i] = (uint64_t)tile_extents[i];
+      tile_nums[i] = spans[i] / cell_nums[i] + 1;
+    }
+    if (tile_nums[i] > max_key / tile_num)
+      return Status::Ok();
+    tile_num *= tile_nums[i];
+  }
+
+  // The cell positions take the low `cell_bits` bits of the keys. Under the
+  // Hilbert cell order, they are the Hilbert keys of the cells, which are
+  // usable only if no dimension range had to be scaled down to fit.
+  auto hilbert = (domain->cell_order() == Layout::HILBERT);
+  unsigned cell_bits = 0;
+  if (hilbert) {
+    auto bits = domain->hilbert_bits();
+    for (unsigned i = 0; i < dim_num; ++i) {
+      if (bits < 64 && (spans[i] >> bits) != 0)
+        return Status::Ok();
+    }
+    cell_bits = bits * dim_num;
+  } else {
+    for (unsigned i = 0; i < dim_num; ++i) {
+      if (cell_nums[i] > max_key / cell_num)
+        return Status::Ok();
+      cell_num *= cell_nums[i];
+    }
+    for (uint64_t max_pos = cell_num - 1; max_pos != 0; max_pos >>= 1)
+      ++cell_bits;
+  }
+  unsigned tile_bits = 0;
+  for (uint64_t max_pos = tile_num - 1; max_pos != 0; max_pos >>= 1)
+    ++tile_bits;
+  if (tile_bits + cell_bits > 64)
+    return Status::Ok();
+
+  // The dimensions from the most to the least significant one
+  std::vector<unsigned> tile_dims(dim_num), cell_dims(dim_num);
+  for (unsigned i = 0; i < dim_num; ++i) {
+    tile_dims[i] = (domain->tile_order() == Layout::COL_MAJOR) ?
+                       dim_num - 1 - i :
+                       i;
+    cell_dims[i] = (domain->cell_order() == Layout::COL_MAJOR) ?
+                       dim_num - 1 - i :
+                       i;
+  }
+
+  // Compute the keys in parallel chunks
+  keys->resize(coords_num);
+  const uint64_t chunk_size = 1 << 16;
+  uint64_t num_chunks = utils::math::ceil(coords_num, chunk_size);
+  if (num_chunks == 0)
+    return Status::Ok();
+  auto statuses = parallel_for(0, num_chunks, [&](uint64_t c) {
+    std::vector<uint64_t> offsets(dim_num);
+    uint64_t end = std::min((c + 1) * chunk_size, coords_num);
+    for (uint64_t i = c * chunk_size; i < end; ++i) {
+      auto cell_coords = &coords[i * dim_num];
+      for (unsigned d = 0; d < dim_num; ++d)
+        offsets[d] = (uint64_t)cell_coords[d] - (uint64_t)dom[2 * d];
+
+      uint64_t tile_pos = 0, cell_pos = 0;
+      for (unsigned d : tile_dims)
+        tile_pos = tile_pos * tile_nums[d] + offsets[d] / cell_nums[d];
+      if (hilbert) {
+        cell_pos = domain->hilbert_key(cell_coords);
+        (*keys)[i] =
+            (tile_bits == 0) ? cell_pos : (tile_pos << cell_bits) | cell_pos;
+      } else {
+        for (unsigned d : cell_dims)
+          cell_pos = cell_pos * cell_nums[d] + offsets[d] % cell_nums[d];
+        (*keys)[i] = tile_pos * cell_num + cell_pos;
+      }
+    }
+    return Status::Ok();
+  });
+  for (const auto& st : statuses)
+    RETURN_NOT_OK(st);
+
+  *key_bits = std::max(tile_bits + cell_bits, 1u);
+
+  return Status::Ok();
+}
+
+template <class T>
+void Writer::compute_hilbert_keys(
+    const T* coords, uint64_t coords_num, std::vector<uint64_t>* keys) const {
+  auto domain = array_schema_->domain();
+  if (domain->cell_order() != Layout::HILBERT)
+    return;
+
+  auto dim_num = domain->dim_num();
+  keys->resize(coords_num);
+  for (uint64_t i = 0; i < coords_num; ++i)
+    (*keys)[i] = domain->hilbert_key(&coords[i * dim_num]);
+}
+
+Status Writer::compute_tile_stats(
+    const std::string& attribute,
+    const std::vector<Tile>& tiles,
+    FragmentMetadata* meta) const {
+  STATS_FUNC_IN(writer_compute_tile_stats);
+
+  if (!meta->has_tile_stats(attribute))
+    return Status::Ok();
+
+  // For easy reference
+  auto type = array_schema_->type(attribute);
+  auto cell_size = array_schema_->cell_size(attribute);
+  std::vector<uint8_t> min(cell_size), max(cell_size);
+  std::vector<uint8_t> sum(constants::tile_sum_size);
+
+  for (uint64_t tile_id = 0; tile_id < tiles.size(); tile_id++) {
+    const auto& tile = tiles[tile_id];
+    auto cell_num = tile.size() / cell_size;
+    assert(cell_num > 0);
+
+    Aggregate aggregate(type);
+    aggregate.update(tile.data(), (uint64_t)0, cell_num - 1);
+    RETURN_NOT_OK(aggregate.get(AggregateOp::AGGREGATE_MIN, &min[0]));
+    RETURN_NOT_OK(aggregate.get(AggregateOp::AGGREGATE_MAX, &max[0]));
+    RETURN_NOT_OK(aggregate.get(AggregateOp::AGGREGATE_SUM, &sum[0]));
+    meta->set_tile_stats(
+        attribute,
+        tile_id,
+        &min[0],
+        &max[0],
+        &sum[0],
+        aggregate.nan_count());
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(writer_compute_tile_stats);
+}
+
 template <class T>
 Status Writer::compute_write_cell_ranges(
     DenseCellRangeIter<T>* iter, WriteCellRangeVec* write_cell_ranges) const {
@@ -902,6 +1177,56 @@ Status Writer::compute_write_cell_ranges(
   STATS_FUNC_OUT(writer_compute_write_cell_ranges);
 }
 
+Status Writer::convert_var_offsets(
+    std::unordered_map<std::string, AttributeBuffer>* user_buffers) {
+  if (var_offsets_bitsize_ == 64 && !var_offsets_extra_element_)
+    return Status::Ok();
+
+  uint64_t offset_size = var_offsets_bitsize_ / 8;
+  auto read_offset = [offset_size](const unsigned char* offsets, uint64_t i) {
+    if (offset_size == sizeof(uint32_t)) {
+      uint32_t offset;
+      std::memcpy(&offset, offsets + i * offset_size, offset_size);
+      return (uint64_t)offset;
+    }
+    uint64_t offset;
+    std::memcpy(&offset, offsets + i * offset_size, offset_size);
+    return offset;
+  };
+
+  for (auto& it : attr_buffers_) {
+    auto& attr_buffer = it.second;
+    if (attr_buffer.buffer_var_ == nullptr)
+      continue;
+
+    auto offsets = (const unsigned char*)attr_buffer.buffer_;
+    auto cell_num = *attr_buffer.buffer_size_ / offset_size;
+    if (var_offsets_extra_element_) {
+      if (cell_num == 0)
+        return LOG_STATUS(Status::WriterError(
+            "Cannot convert var offsets; The extra offset of attribute '" +
+            it.first + "' is missing"));
+      --cell_num;
+      if (read_offset(offsets, cell_num) != *attr_buffer.buffer_var_size_)
+        return LOG_STATUS(Status::WriterError(
+            "Cannot convert var offsets; The extra offset of attribute '" +
+            it.first + "' does not match the size of the values"));
+    }
+
+    auto& converted = converted_offsets_[it.first];
+    converted.first.resize(cell_num);
+    for (uint64_t i = 0; i < cell_num; ++i)
+      converted.first[i] = read_offset(offsets, i);
+    converted.second = cell_num * sizeof(uint64_t);
+
+    (*user_buffers)[it.first] = attr_buffer;
+    attr_buffer.buffer_ = converted.first.data();
+    attr_buffer.buffer_size_ = &converted.second;
+  }
+
+  return Status::Ok();
+}
+
 Status Writer::create_fragment(
     bool dense, std::shared_ptr<FragmentMetadata>* frag_meta) const {
   STATS_FUNC_IN(writer_create_fragment);
@@ -943,6 +1268,89 @@ Status Writer::filter_tiles(
   STATS_FUNC_OUT(writer_filter_tiles);
 }
 
+Status Writer::filter_and_write_tiles(
+    const std::string& attribute,
+    FragmentMetadata* frag_meta,
+    std::vector<Tile>* tiles,
+    uint64_t* tile_bytes) const {
+  STATS_FUNC_IN(writer_filter_and_write_tiles);
+
+  auto var_size = array_schema_->var_size(attribute);
+  uint64_t step = var_size ? 2 : 1;
+  auto tile_num = tiles->size();
+
+  // The write in flight, along with its tile range and unfiltered size
+  std::future<Status> write_task;
+  uint64_t write_begin = 0, write_end = 0, write_bytes = 0;
+  auto wait_write = [&]() {
+    if (!write_task.valid())
+      return Status::Ok();
+    auto ready = write_task.wait_for(std::chrono::seconds(0)) ==
+                 std::future_status::ready;
+    STATS_COUNTER_ADD_IF(!ready, writer_num_tile_pipeline_stalls, 1);
+    auto st = write_task.get();
+    for (auto i = write_begin; i < write_end; ++i)
+      (*tiles)[i] = Tile();
+    write_bytes = std::min(write_bytes, *tile_bytes);
+    *tile_bytes -= write_bytes;
+    STATS_GAUGE_SUB(writer_tile_bytes, write_bytes);
+    return st;
+  };
+
+  Status st;
+  for (uint64_t begin = 0; st.ok() && begin < tile_num;) {
+    // Form the next batch, with at least one tile
+    uint64_t end = begin, batch_bytes = 0;
+    while (end < tile_num) {
+      auto bytes = (*tiles)[end].size();
+      if (var_size)
+        bytes += (*tiles)[end + 1].size();
+      if (end > begin && batch_bytes + bytes > write_batch_size_)
+        break;
+      batch_bytes += bytes;
+      end += step;
+    }
+
+    // Filter the batch, while the previous batch is being written
+    auto statuses = parallel_for(begin / step, end / step, [&](uint64_t t) {
+      RETURN_NOT_OK(filter_tile(attribute, &(*tiles)[t * step], var_size));
+      if (var_size)
+        RETURN_NOT_OK(filter_tile(attribute, &(*tiles)[t * step + 1], false));
+      return Status::Ok();
+    });
+    for (auto& filter_st : statuses) {
+      if (!filter_st.ok()) {
+        st = filter_st;
+        break;
+      }
+    }
+
+    // Wait for the previous batch, then issue the write of this one
+    auto write_st = wait_write();
+    if (st.ok())
+      st = write_st;
+    if (!st.ok())
+      break;
+    STATS_COUNTER_ADD(writer_num_tile_batches, 1);
+    write_begin = begin;
+    write_end = end;
+    write_bytes = batch_bytes;
+    write_task = storage_manager_->writer_thread_pool()->enqueue(
+        [this, &attribute, frag_meta, tiles, begin, end]() {
+          return write_tiles(attribute, frag_meta, *tiles, begin, end);
+        });
+    begin = end;
+  }
+
+  auto write_st = wait_write();
+  if (st.ok())
+    st = write_st;
+
+  return st;
+
+  STATS_FUNC_OUT(writer_filter_and_write_tiles);
+}
+
 Status Writer::filter_tile(
     const std::string& attribute, Tile* tile, bool offsets) const {
   auto orig_size = tile->buffer()->size();
@@ -1124,59 +1532,65 @@ Status Writer::global_write() {
   if (dedup_coords_)
     RETURN_CANCEL_OR_ERROR(compute_coord_dups(&coord_dups));
 
-  // Prepare tiles for all attributes
+  // Prepare, filter and write the tiles in groups of attributes that fit
+  // in the memory budget
+  std::vector<WriteGroup> groups;
+  group_attributes(0, false, 0, &groups);
   std::vector<std::vector<Tile>> attribute_tiles(num_attributes);
-  auto statuses = parallel_for(0, num_attributes, [&](uint64_t i) {
-    const auto& attr = attributes_[i];
-    auto& full_tiles = attribute_tiles[i];
-    RETURN_CANCEL_OR_ERROR(prepare_full_tiles(attr, coord_dups, &full_tiles));
-    return Status::Ok();
-  });
-
-  // Check all statuses
-  for (auto& st : statuses) {
-    if (!st.ok()) {
-      storage_manager_->vfs()->remove_dir(uri);
-      global_write_state_.reset(nullptr);
-      return st;
+  std::vector<uint64_t> tile_bytes(num_attributes, 0);
+  auto new_num_tiles = frag_meta->tile_index_base();
+  auto write_group = [&](const WriteGroup& group) {
+    // Prepare tiles
+    auto statuses = parallel_for(group.begin_, group.end_, [&](uint64_t i) {
+      const auto& attr = attributes_[i];
+      auto& full_tiles = attribute_tiles[i];
+      RETURN_CANCEL_OR_ERROR(
+          prepare_full_tiles(attr, coord_dups, &full_tiles));
+      account_tiles(full_tiles, &tile_bytes[i]);
+      return Status::Ok();
+    });
+    for (auto& st : statuses)
+      RETURN_NOT_OK(st);
+
+    // Increment number of tiles in the fragment metadata
+    if (group.begin_ == 0) {
+      uint64_t num_tiles = array_schema_->var_size(attributes_[0]) ?
+                               attribute_tiles[0].size() / 2 :
+                               attribute_tiles[0].size();
+      new_num_tiles += num_tiles;
+      frag_meta->set_num_tiles(new_num_tiles);
     }
-  }
-  statuses.clear();
 
-  // Increment number of tiles in the fragment metadata
-  uint64_t num_tiles = array_schema_->var_size(attributes_[0]) ?
-                           attribute_tiles[0].size() / 2 :
-                           attribute_tiles[0].size();
-  auto new_num_tiles = frag_meta->tile_index_base() + num_tiles;
-  frag_meta->set_num_tiles(new_num_tiles);
+    // Filter and write tiles, streaming them in batches
+    statuses = parallel_for(group.begin_, group.end_, [&](uint64_t i) {
+      const auto& attr = attributes_[i];
+      auto& full_tiles = attribute_tiles[i];
+      if (attr == constants::coords) {
+        RETURN_CANCEL_OR_ERROR(
+            compute_coords_metadata<T>(full_tiles, frag_meta));
+      } else {
+        RETURN_CANCEL_OR_ERROR(
+            compute_tile_stats(attr, full_tiles, frag_meta));
+      }
+      RETURN_CANCEL_OR_ERROR(filter_and_write_tiles(
+          attr, frag_meta, &full_tiles, &tile_bytes[i]));
+      return Status::Ok();
+    });
+    for (auto& st : statuses)
+      RETURN_NOT_OK(st);
 
-  // Filter all tiles
-  statuses = parallel_for(0, num_attributes, [&](uint64_t i) {
-    const auto& attr = attributes_[i];
-    auto& full_tiles = attribute_tiles[i];
-    if (attr == constants::coords)
-      RETURN_CANCEL_OR_ERROR(compute_coords_metadata<T>(full_tiles, frag_meta));
-    RETURN_CANCEL_OR_ERROR(filter_tiles(attr, &full_tiles));
     return Status::Ok();
-  });
+  };
 
-  // Check all statuses
-  for (auto& st : statuses) {
+  for (const auto& group : groups) {
+    auto st = write_group(group);
+    release_tiles(group, &tile_bytes, &attribute_tiles);
     if (!st.ok()) {
       storage_manager_->vfs()->remove_dir(uri);
       global_write_state_.reset(nullptr);
       return st;
     }
   }
-  statuses.clear();
-
-  // Write tiles for all attributes
-  auto st = write_all_tiles(frag_meta, attribute_tiles);
-  if (!st.ok()) {
-    storage_manager_->vfs()->remove_dir(uri);
-    global_write_state_.reset(nullptr);
-    return st;
-  }
 
   // Increment the tile index base for the next global order write.
   frag_meta->set_tile_index_base(new_num_tiles);
@@ -1219,8 +1633,11 @@ Status Writer::global_write_handle_last_tile() {
       tiles.push_back(last_tile.clone(false));
       if (!last_tile_var.empty())
         tiles.push_back(last_tile_var.clone(false));
-      if (attr == constants::coords)
+      if (attr == constants::coords) {
         RETURN_NOT_OK(compute_coords_metadata<T>(tiles, meta));
+      } else {
+        RETURN_NOT_OK(compute_tile_stats(attr, tiles, meta));
+      }
       RETURN_NOT_OK(filter_tiles(attr, &tiles));
     }
     return Status::Ok();
@@ -1231,7 +1648,7 @@ Status Writer::global_write_handle_last_tile() {
     RETURN_NOT_OK(st);
 
   // Write the last tiles
-  RETURN_NOT_OK(write_all_tiles(meta, attribute_tiles));
+  RETURN_NOT_OK(write_all_tiles(meta, attribute_tiles, false));
 
   // Increment the tile index base.
   meta->set_tile_index_base(meta->tile_index_base() + 1);
@@ -1239,10 +1656,108 @@ Status Writer::global_write_handle_last_tile() {
   return Status::Ok();
 }
 
+void Writer::account_tiles(
+    const std::vector<Tile>& tiles, uint64_t* tile_bytes) const {
+  uint64_t bytes = 0;
+  for (const auto& tile : tiles)
+    bytes += tile.size();
+  *tile_bytes = bytes;
+  STATS_GAUGE_ADD(writer_tile_bytes, bytes);
+}
+
+void Writer::group_attributes(
+    uint64_t tile_num,
+    bool dense_tiles,
+    uint64_t reserved_bytes,
+    std::vector<WriteGroup>* groups) const {
+  auto cell_num_per_tile = array_schema_->domain()->cell_num_per_tile();
+  auto num_attributes = attributes_.size();
+  auto budget = memory_budget_ - std::min(memory_budget_, reserved_bytes);
+  uint64_t memory = 0, memory_var = 0, begin = 0;
+  for (uint64_t i = 0; i < num_attributes; ++i) {
+    const auto& attr = attributes_[i];
+    const auto& attr_buffer = attr_buffers_.find(attr)->second;
+    auto var_size = array_schema_->var_size(attr);
+
+    // Dense tiles hold all their cells, including the empty ones
+    uint64_t size = *attr_buffer.buffer_size_, size_var = 0;
+    if (var_size)
+      size_var = *attr_buffer.buffer_var_size_;
+    if (dense_tiles) {
+      auto cell_size = var_size ? constants::cell_var_offset_size :
+                                  array_schema_->cell_size(attr);
+      size = std::max(size, tile_num * cell_num_per_tile * cell_size);
+    }
+
+    // Split an attribute whose tiles alone exceed the budget into ranges
+    // of tiles that fit in it, assuming equally sized tiles
+    if (tile_num > 1 && (size > budget || size_var > memory_budget_var_)) {
+      if (i > begin)
+        groups->emplace_back(begin, i, 0, tile_num);
+      double ratio = 1;
+      if (size > budget)
+        ratio = std::min(ratio, (double)budget / size);
+      if (size_var > memory_budget_var_)
+        ratio = std::min(ratio, (double)memory_budget_var_ / size_var);
+      auto group_tile_num = std::max<uint64_t>(1, ratio * tile_num);
+      for (uint64_t t = 0; t < tile_num; t += group_tile_num)
+        groups->emplace_back(
+            i, i + 1, t, std::min(t + group_tile_num, tile_num));
+      begin = i + 1;
+      memory = 0;
+      memory_var = 0;
+      continue;
+    }
+
+    if (i > begin && (memory + size > budget ||
+                      memory_var + size_var > memory_budget_var_)) {
+      groups->emplace_back(begin, i, 0, tile_num);
+      begin = i;
+      memory = 0;
+      memory_var = 0;
+    }
+    memory += size;
+    memory_var += size_var;
+  }
+  if (begin < num_attributes)
+    groups->emplace_back(begin, num_attributes, 0, tile_num);
+}
+
 bool Writer::has_coords() const {
   return attr_buffers_.find(constants::coords) != attr_buffers_.end();
 }
 
+Status Writer::init_async_writer() {
+  // The writer shares the array, fragment and constraints of this writer
+  auto writer = new Writer();
+  async_writer_.reset(writer);
+  writer->set_storage_manager(storage_manager_);
+  writer->set_array(array_);
+  writer->set_array_schema(array_schema_);
+  writer->layout_ = layout_;
+  writer->fragment_uri_ = fragment_uri_;
+  writer->var_offsets_bitsize_ = var_offsets_bitsize_;
+  writer->var_offsets_extra_element_ = var_offsets_extra_element_;
+  uint64_t subarray_size = 2 * array_schema_->coords_size();
+  writer->subarray_ = std::malloc(subarray_size);
+  if (writer->subarray_ == nullptr)
+    return LOG_STATUS(Status::WriterError(
+        "Cannot initialize asynchronous write; Memory allocation failed"));
+  std::memcpy(writer->subarray_, subarray_, subarray_size);
+
+  // The batches are written by a single thread, in the order they are
+  // staged
+  async_status_ = Status::Ok();
+  staged_batches_ = std::vector<StagedBatch>(write_staging_buffers_);
+  next_staged_batch_ = 0;
+  if (staging_thread_pool_ == nullptr) {
+    staging_thread_pool_.reset(new ThreadPool());
+    RETURN_NOT_OK(staging_thread_pool_->init(1));
+  }
+
+  return Status::Ok();
+}
+
 Status Writer::init_global_write_state() {
   STATS_FUNC_IN(writer_init_global_write_state);
 
@@ -1496,25 +2011,45 @@ Status Writer::ordered_write() {
   // Set number of tiles in the fragment metadata
   frag_meta->set_num_tiles(tile_num);
 
-  // Prepare tiles for all attributes and filter
+  // Prepare, filter and write the tiles in groups of attributes that fit
+  // in the memory budget, along with the write cell ranges. The tile
+  // indices of a group are relative to its first tile.
   uint64_t num_attributes = attributes_.size();
+  uint64_t reserved_bytes = 0;
+  for (const auto& ranges : write_cell_ranges)
+    reserved_bytes += ranges.size() * sizeof(WriteCellRange);
+  std::vector<WriteGroup> groups;
+  group_attributes(tile_num, true, reserved_bytes, &groups);
   std::vector<std::vector<Tile>> attr_tiles(num_attributes);
-  auto statuses = parallel_for(0, num_attributes, [&](uint64_t i) {
-    const auto& attr = attributes_[i];
-    std::vector<Tile>& tiles = attr_tiles[i];
-    RETURN_CANCEL_OR_ERROR(prepare_tiles(attr, write_cell_ranges, &tiles));
-    RETURN_CANCEL_OR_ERROR(filter_tiles(attr, &tiles));
-    return Status::Ok();
-  });
-
-  // Check all statuses
-  for (auto& st : statuses)
+  std::vector<uint64_t> tile_bytes(num_attributes, 0);
+  auto write_group = [&](const WriteGroup& group) {
+    frag_meta->set_tile_index_base(group.tile_begin_);
+    auto statuses = parallel_for(group.begin_, group.end_, [&](uint64_t i) {
+      const auto& attr = attributes_[i];
+      std::vector<Tile>& tiles = attr_tiles[i];
+      RETURN_CANCEL_OR_ERROR(prepare_tiles(
+          attr,
+          write_cell_ranges,
+          group.tile_begin_,
+          group.tile_end_,
+          &tiles));
+      account_tiles(tiles, &tile_bytes[i]);
+      RETURN_CANCEL_OR_ERROR(filter_tiles(attr, &tiles));
+      return Status::Ok();
+    });
+    for (auto& st : statuses)
+      RETURN_NOT_OK(st);
+
+    return write_all_tiles(
+        frag_meta.get(), attr_tiles, group.tile_end_ == tile_num);
+  };
+
+  for (const auto& group : groups) {
+    auto st = write_group(group);
+    release_tiles(group, &tile_bytes, &attr_tiles);
     RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
-
-  // Write tiles for all attributes
-  RETURN_NOT_OK_ELSE(
-      write_all_tiles(frag_meta.get(), attr_tiles),
-      storage_manager_->vfs()->remove_dir(uri));
+  }
+  frag_meta->set_tile_index_base(0);
 
   // Write the fragment metadata
   RETURN_CANCEL_OR_ERROR_ELSE(
@@ -1809,11 +2344,13 @@ Status Writer::prepare_full_tiles_var(
 Status Writer::prepare_tiles(
     const std::string& attribute,
     const std::vector<WriteCellRangeVec>& write_cell_ranges,
+    uint64_t tile_begin,
+    uint64_t tile_end,
     std::vector<Tile>* tiles) const {
   STATS_FUNC_IN(writer_prepare_tiles_ordered);
 
   // Trivial case
-  auto tile_num = write_cell_ranges.size();
+  auto tile_num = tile_end - tile_begin;
   if (tile_num == 0)
     return Status::Ok();
 
@@ -1835,7 +2372,8 @@ Status Writer::prepare_tiles(
 
   // Populate each tile with the write cell ranges
   uint64_t end_pos = array_schema_->domain()->cell_num_per_tile() - 1;
-  for (size_t i = 0, t = 0; i < tile_num; ++i, t += (var_size) ? 2 : 1) {
+  for (uint64_t i = tile_begin, t = 0; i < tile_end;
+       ++i, t += (var_size) ? 2 : 1) {
     uint64_t pos = 0;
     for (const auto& wcr : write_cell_ranges[i]) {
       // Write empty range
@@ -1884,30 +2422,35 @@ Status Writer::prepare_tiles(
     const std::string& attribute,
     const std::vector<uint64_t>& cell_pos,
     const std::set<uint64_t>& coord_dups,
+    uint64_t begin,
+    uint64_t end,
     std::vector<Tile>* tiles) const {
   return array_schema_->var_size(attribute) ?
-             prepare_tiles_var(attribute, cell_pos, coord_dups, tiles) :
-             prepare_tiles_fixed(attribute, cell_pos, coord_dups, tiles);
+             prepare_tiles_var(
+                 attribute, cell_pos, coord_dups, begin, end, tiles) :
+             prepare_tiles_fixed(
+                 attribute, cell_pos, coord_dups, begin, end, tiles);
 }
 
 Status Writer::prepare_tiles_fixed(
     const std::string& attribute,
     const std::vector<uint64_t>& cell_pos,
     const std::set<uint64_t>& coord_dups,
+    uint64_t begin,
+    uint64_t end,
     std::vector<Tile>* tiles) const {
   STATS_FUNC_IN(writer_prepare_tiles_fixed);
 
   // Trivial case
-  if (cell_pos.empty())
+  if (begin == end)
     return Status::Ok();
 
   // For easy reference
   auto it = attr_buffers_.find(attribute);
   auto buffer = (unsigned char*)it->second.buffer_;
-  auto cell_num = (uint64_t)cell_pos.size();
   auto capacity = array_schema_->capacity();
-  auto dups_num = coord_dups.size();
-  auto tile_num = utils::math::ceil(cell_num - dups_num, capacity);
+  auto dups_num = count_coord_dups(cell_pos, coord_dups, begin, end);
+  auto tile_num = utils::math::ceil(end - begin - dups_num, capacity);
   auto cell_size = array_schema_->cell_size(attribute);
 
   // Initialize tiles
@@ -1917,7 +2460,7 @@ Status Writer::prepare_tiles_fixed(
 
   // Write all cells one by one
   if (dups_num == 0) {
-    for (uint64_t i = 0, tile_idx = 0; i < cell_num; ++i) {
+    for (uint64_t i = begin, tile_idx = 0; i < end; ++i) {
       if ((*tiles)[tile_idx].full())
         ++tile_idx;
 
@@ -1925,7 +2468,7 @@ Status Writer::prepare_tiles_fixed(
           buffer + cell_pos[i] * cell_size, cell_size));
     }
   } else {
-    for (uint64_t i = 0, tile_idx = 0; i < cell_num; ++i) {
+    for (uint64_t i = begin, tile_idx = 0; i < end; ++i) {
       if (coord_dups.find(cell_pos[i]) != coord_dups.end())
         continue;
 
@@ -1946,6 +2489,8 @@ Status Writer::prepare_tiles_var(
     const std::string& attribute,
     const std::vector<uint64_t>& cell_pos,
     const std::set<uint64_t>& coord_dups,
+    uint64_t begin,
+    uint64_t end,
     std::vector<Tile>* tiles) const {
   STATS_FUNC_IN(writer_prepare_tiles_var);
 
@@ -1956,8 +2501,8 @@ Status Writer::prepare_tiles_var(
   auto buffer_var_size = it->second.buffer_var_size_;
   auto cell_num = (uint64_t)cell_pos.size();
   auto capacity = array_schema_->capacity();
-  auto dups_num = coord_dups.size();
-  auto tile_num = utils::math::ceil(cell_num - dups_num, capacity);
+  auto dups_num = count_coord_dups(cell_pos, coord_dups, begin, end);
+  auto tile_num = utils::math::ceil(end - begin - dups_num, capacity);
   uint64_t offset;
   uint64_t var_size;
 
@@ -1969,7 +2514,7 @@ Status Writer::prepare_tiles_var(
 
   // Write all cells one by one
   if (dups_num == 0) {
-    for (uint64_t i = 0, tile_idx = 0; i < cell_num; ++i) {
+    for (uint64_t i = begin, tile_idx = 0; i < end; ++i) {
       if ((*tiles)[tile_idx].full())
         tile_idx += 2;
 
@@ -1985,7 +2530,7 @@ Status Writer::prepare_tiles_var(
           &buffer_var[buffer[cell_pos[i]]], var_size));
     }
   } else {
-    for (uint64_t i = 0, tile_idx = 0; i < cell_num; ++i) {
+    for (uint64_t i = begin, tile_idx = 0; i < end; ++i) {
       if (coord_dups.find(cell_pos[i]) != coord_dups.end())
         continue;
 
@@ -2010,10 +2555,35 @@ Status Writer::prepare_tiles_var(
   STATS_FUNC_OUT(writer_prepare_tiles_var);
 }
 
-void Writer::reset() {
+void Writer::release_tiles(
+    const WriteGroup& group,
+    std::vector<uint64_t>* tile_bytes,
+    std::vector<std::vector<Tile>>* attribute_tiles) const {
+  for (auto i = group.begin_; i < group.end_; ++i) {
+    STATS_GAUGE_SUB(writer_tile_bytes, (*tile_bytes)[i]);
+    (*tile_bytes)[i] = 0;
+    std::vector<Tile>().swap((*attribute_tiles)[i]);
+  }
+}
+
+Status Writer::reset() {
+  // Wait for the staged batches and report the failure of any of them,
+  // which would otherwise be lost along with the writer of the batches
+  Status st;
+  if (async_writer_ != nullptr) {
+    clear_staged_batches();
+    st = async_status_;
+    async_status_ = Status::Ok();
+    auto async_st = async_writer_->reset();
+    async_writer_.reset(nullptr);
+    if (st.ok())
+      st = async_st;
+  }
   if (global_write_state_ != nullptr)
     nuke_global_write_state();
   initialized_ = false;
+
+  return st;
 }
 
 template <class T>
@@ -2033,15 +2603,61 @@ Status Writer::sort_coords(std::vector<uint64_t>* cell_pos) const {
   for (uint64_t i = 0; i < coords_num; ++i)
     (*cell_pos)[i] = i;
 
-  // Sort the coordinates in global order
-  parallel_sort(
-      cell_pos->begin(), cell_pos->end(), GlobalCmp<T>(domain, buffer));
+  // Sort the coordinates in global order, on precomputed keys if possible.
+  // The radix sort holds the keys, along with temporary keys and values,
+  // in addition to `cell_pos`, so it is used only if these fit in the
+  // memory budget.
+  std::vector<uint64_t> keys;
+  unsigned key_bits = 0;
+  if (4 * coords_num * sizeof(uint64_t) <= memory_budget_)
+    RETURN_NOT_OK(
+        compute_global_order_keys<T>(buffer, coords_num, &keys, &key_bits));
+  if (key_bits > 0) {
+    STATS_COUNTER_ADD(writer_num_radix_sorts, 1);
+    parallel_radix_sort(&keys, cell_pos, key_bits);
+  } else {
+    std::vector<uint64_t> hilbert_keys;
+    compute_hilbert_keys<T>(buffer, coords_num, &hilbert_keys);
+    parallel_sort(
+        cell_pos->begin(),
+        cell_pos->end(),
+        GlobalCmp<T>(
+            domain,
+            buffer,
+            hilbert_keys.empty() ? nullptr : hilbert_keys.data()));
+  }
 
   return Status::Ok();
 
   STATS_FUNC_OUT(writer_sort_coords);
 }
 
+Status Writer::stage_batch(StagedBatch* batch) const {
+  STATS_FUNC_IN(writer_stage_batch);
+
+  for (const auto& attr : attributes_) {
+    const auto& attr_buffer = attr_buffers_.find(attr)->second;
+    auto& staging = batch->buffers_[attr];
+    staging.buffer_size_ = *attr_buffer.buffer_size_;
+    staging.buffer_.resize(std::max<uint64_t>(staging.buffer_size_, 1));
+    std::memcpy(
+        staging.buffer_.data(), attr_buffer.buffer_, staging.buffer_size_);
+    if (attr_buffer.buffer_var_ != nullptr) {
+      staging.buffer_var_size_ = *attr_buffer.buffer_var_size_;
+      staging.buffer_var_.resize(
+          std::max<uint64_t>(staging.buffer_var_size_, 1));
+      std::memcpy(
+          staging.buffer_var_.data(),
+          attr_buffer.buffer_var_,
+          staging.buffer_var_size_);
+    }
+  }
+
+  return Status::Ok();
+
+  STATS_FUNC_OUT(writer_stage_batch);
+}
+
 Status Writer::unordered_write() {
   STATS_FUNC_IN(writer_unordered_write);
 
@@ -2102,51 +2718,82 @@ Status Writer::unordered_write() {
   RETURN_CANCEL_OR_ERROR(create_fragment(false, &frag_meta));
   auto uri = frag_meta->fragment_uri();
 
-  // Prepare tiles for all attributes
+  // Find the index in `cell_pos` where each tile starts, skipping the
+  // duplicates
+  auto cell_num = (uint64_t)cell_pos.size();
+  auto capacity = array_schema_->capacity();
+  auto tile_num = utils::math::ceil(cell_num - coord_dups.size(), capacity);
+  std::vector<uint64_t> tile_starts;
+  tile_starts.reserve(tile_num + 1);
+  for (uint64_t i = 0, n = 0; i < cell_num; ++i) {
+    if (!coord_dups.empty() && coord_dups.count(cell_pos[i]) > 0)
+      continue;
+    if (n++ % capacity == 0)
+      tile_starts.push_back(i);
+  }
+  tile_starts.push_back(cell_num);
+  frag_meta->set_num_tiles(tile_num);
+
+  // Prepare, filter and write the tiles in groups of attributes that fit
+  // in the memory budget, along with the sorted positions. The tile
+  // indices of a group are relative to its first tile.
   auto num_attributes = attributes_.size();
+  auto reserved_bytes = (cell_num + tile_starts.size()) * sizeof(uint64_t);
+  std::vector<WriteGroup> groups;
+  group_attributes(tile_num, false, reserved_bytes, &groups);
   std::vector<std::vector<Tile>> attribute_tiles(num_attributes);
-  auto statuses = parallel_for(0, num_attributes, [&](uint64_t i) {
-    const auto& attr = attributes_[i];
-    auto& tiles = attribute_tiles[i];
-    RETURN_CANCEL_OR_ERROR(prepare_tiles(attr, cell_pos, coord_dups, &tiles));
-    return Status::Ok();
-  });
+  std::vector<uint64_t> tile_bytes(num_attributes, 0);
+  auto write_group = [&](const WriteGroup& group) {
+    // Prepare tiles
+    frag_meta->set_tile_index_base(group.tile_begin_);
+    auto statuses = parallel_for(group.begin_, group.end_, [&](uint64_t i) {
+      const auto& attr = attributes_[i];
+      auto& tiles = attribute_tiles[i];
+      RETURN_CANCEL_OR_ERROR(prepare_tiles(
+          attr,
+          cell_pos,
+          coord_dups,
+          tile_starts[group.tile_begin_],
+          tile_starts[group.tile_end_],
+          &tiles));
+      account_tiles(tiles, &tile_bytes[i]);
+      return Status::Ok();
+    });
+    for (auto& st : statuses)
+      RETURN_NOT_OK(st);
+
+    // Filter tiles
+    statuses = parallel_for(group.begin_, group.end_, [&](uint64_t i) {
+      const auto& attr = attributes_[i];
+      auto& tiles = attribute_tiles[i];
+      if (attr == constants::coords) {
+        RETURN_CANCEL_OR_ERROR(
+            compute_coords_metadata<T>(tiles, frag_meta.get()));
+      } else {
+        RETURN_CANCEL_OR_ERROR(
+            compute_tile_stats(attr, tiles, frag_meta.get()));
+      }
+      RETURN_CANCEL_OR_ERROR(filter_tiles(attr, &tiles));
+      return Status::Ok();
+    });
+    for (auto& st : statuses)
+      RETURN_NOT_OK(st);
+
+    // Write tiles
+    return write_all_tiles(
+        frag_meta.get(), attribute_tiles, group.tile_end_ == tile_num);
+  };
+
+  for (const auto& group : groups) {
+    auto st = write_group(group);
+    release_tiles(group, &tile_bytes, &attribute_tiles);
+    RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
+  }
+  frag_meta->set_tile_index_base(0);
 
   // Clear the boolean vector for coordinate duplicates
   coord_dups.clear();
 
-  // Check all statuses
-  for (auto& st : statuses)
-    RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
-  statuses.clear();
-
-  // Set the number of tiles in the metadata
-  uint64_t num_tiles = array_schema_->var_size(attributes_[0]) ?
-                           attribute_tiles[0].size() / 2 :
-                           attribute_tiles[0].size();
-  frag_meta->set_num_tiles(num_tiles);
-
-  // Filter all tiles
-  statuses = parallel_for(0, num_attributes, [&](uint64_t i) {
-    const auto& attr = attributes_[i];
-    auto& tiles = attribute_tiles[i];
-    if (attr == constants::coords)
-      RETURN_CANCEL_OR_ERROR(
-          compute_coords_metadata<T>(tiles, frag_meta.get()));
-    RETURN_CANCEL_OR_ERROR(filter_tiles(attr, &tiles));
-    return Status::Ok();
-  });
-
-  // Check all statuses
-  for (auto& st : statuses)
-    RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
-  statuses.clear();
-
-  // Write tiles for all attributes
-  RETURN_NOT_OK_ELSE(
-      write_all_tiles(frag_meta.get(), attribute_tiles),
-      storage_manager_->vfs()->remove_dir(uri));
-
   // Write the fragment metadata
   RETURN_CANCEL_OR_ERROR_ELSE(
       storage_manager_->store_fragment_metadata(
@@ -2156,6 +2803,13 @@ Status Writer::unordered_write() {
   return Status::Ok();
 }
 
+void Writer::wait_staged_batches() {
+  for (auto& batch : staged_batches_) {
+    if (batch.task_.valid())
+      batch.task_.wait();
+  }
+}
+
 Status Writer::write_empty_cell_range_to_tile(uint64_t num, Tile* tile) const {
   auto type = tile->type();
   auto fill_size = datatype_size(type);
@@ -2223,7 +2877,8 @@ Status Writer::write_cell_range_to_tile_var(
 
 Status Writer::write_all_tiles(
     FragmentMetadata* frag_meta,
-    const std::vector<std::vector<tiledb::sm::Tile>>& attribute_tiles) const {
+    const std::vector<std::vector<tiledb::sm::Tile>>& attribute_tiles,
+    bool close_files) const {
   STATS_FUNC_IN(writer_write_all_tiles);
 
   std::vector<std::future<Status>> tasks;
@@ -2232,9 +2887,12 @@ Status Writer::write_all_tiles(
   for (uint64_t i = 0; i < num_attributes; i++) {
     const auto& attr = attributes_[i];
     auto& tiles = attribute_tiles[i];
+    if (tiles.empty())
+      continue;
     tasks.push_back(
         storage_manager_->writer_thread_pool()->enqueue([&, this]() {
-          RETURN_CANCEL_OR_ERROR(write_tiles(attr, frag_meta, tiles));
+          RETURN_CANCEL_OR_ERROR(
+              write_tiles(attr, frag_meta, tiles, close_files));
           return Status::Ok();
         }));
   }
@@ -2250,23 +2908,86 @@ Status Writer::write_all_tiles(
   STATS_FUNC_OUT(writer_write_all_tiles);
 }
 
+Status Writer::write_staged_batch(StagedBatch* batch) {
+  // The batches following a failed one are not written
+  if (!async_status_.ok())
+    return async_status_;
+
+  auto writer = async_writer_.get();
+  auto write = [&]() -> Status {
+    // Point the writer to the staging buffers of the batch
+    for (auto& it : batch->buffers_) {
+      auto& staging = it.second;
+      if (array_schema_->var_size(it.first)) {
+        RETURN_NOT_OK(writer->set_buffer(
+            it.first,
+            (uint64_t*)staging.buffer_.data(),
+            &staging.buffer_size_,
+            staging.buffer_var_.data(),
+            &staging.buffer_var_size_));
+      } else {
+        RETURN_NOT_OK(writer->set_buffer(
+            it.first, staging.buffer_.data(), &staging.buffer_size_));
+      }
+    }
+
+    // The writer writes the batches as they come
+    if (!writer->initialized_) {
+      RETURN_NOT_OK(writer->init());
+      writer->write_staging_buffers_ = 0;
+    }
+
+    return writer->write();
+  };
+  async_status_ = write();
+
+  return async_status_;
+}
+
 Status Writer::write_tiles(
     const std::string& attribute,
     FragmentMetadata* frag_meta,
-    const std::vector<Tile>& tiles) const {
+    const std::vector<Tile>& tiles,
+    bool close_files) const {
   // Handle zero tiles
   if (tiles.empty())
     return Status::Ok();
 
+  // Write tiles
+  bool var_size = array_schema_->var_size(attribute);
+  RETURN_NOT_OK(write_tiles(attribute, frag_meta, tiles, 0, tiles.size()));
+
+  // Close files, unless more tiles follow
+  if (close_files) {
+    RETURN_NOT_OK(storage_manager_->close_file(frag_meta->attr_uri(attribute)));
+    if (var_size)
+      RETURN_NOT_OK(
+          storage_manager_->close_file(frag_meta->attr_var_uri(attribute)));
+  }
+
+  return Status::Ok();
+}
+
+Status Writer::write_tiles(
+    const std::string& attribute,
+    FragmentMetadata* frag_meta,
+    const std::vector<Tile>& tiles,
+    uint64_t begin,
+    uint64_t end) const {
   // For easy reference
   bool var_size = array_schema_->var_size(attribute);
   auto attr_uri = frag_meta->attr_uri(attribute);
   auto attr_var_uri = var_size ? frag_meta->attr_var_uri(attribute) : URI("");
 
-  // Write tiles
-  auto tile_num = tiles.size();
-  for (size_t i = 0, tile_id = 0; i < tile_num; ++i, ++tile_id) {
-    RETURN_NOT_OK(storage_manager_->write(attr_uri, tiles[i].buffer()));
+  // Collect the tiles of each file into a single batch, computing the
+  // tile offsets as the tiles are laid out back to back
+  uint64_t step = var_size ? 2 : 1;
+  std::vector<ConstBuffer> batch, var_batch;
+  batch.reserve((end - begin) / step);
+  if (var_size)
+    var_batch.reserve((end - begin) / step);
+  for (auto i = begin, tile_id = begin / step; i < end; ++i, ++tile_id) {
+    batch.emplace_back(tiles[i].buffer());
     frag_meta->set_tile_offset(attribute, tile_id, tiles[i].buffer()->size());
 
     STATS_COUNTER_ADD(writer_num_bytes_written, tiles[i].buffer()->size());
@@ -2274,7 +2995,7 @@ Status Writer::write_tiles(
     if (var_size) {
       ++i;
 
-      RETURN_NOT_OK(storage_manager_->write(attr_var_uri, tiles[i].buffer()));
+      var_batch.emplace_back(tiles[i].buffer());
       frag_meta->set_tile_var_offset(
           attribute, tile_id, tiles[i].buffer()->size());
       frag_meta->set_tile_var_size(
@@ -2284,15 +3005,12 @@ Status Writer::write_tiles(
     }
   }
 
-  // Close files, except in the case of global order
-  if (layout_ != Layout::GLOBAL_ORDER) {
-    RETURN_NOT_OK(storage_manager_->close_file(frag_meta->attr_uri(attribute)));
-    if (var_size)
-      RETURN_NOT_OK(
-          storage_manager_->close_file(frag_meta->attr_var_uri(attribute)));
-  }
+  // Write tiles
+  RETURN_NOT_OK(storage_manager_->write(attr_uri, batch));
+  if (var_size)
+    RETURN_NOT_OK(storage_manager_->write(attr_var_uri, var_batch));
 
-  STATS_COUNTER_ADD(writer_num_attr_tiles_written, tile_num);
+  STATS_COUNTER_ADD(writer_num_attr_tiles_written, end - begin);
 
   return Status::Ok();
 }
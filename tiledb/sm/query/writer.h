@@ -37,10 +37,12 @@
 #include "tiledb/sm/filter/filter_pipeline.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/status.h"
+#include "tiledb/sm/misc/thread_pool.h"
 #include "tiledb/sm/query/dense_cell_range_iter.h"
 #include "tiledb/sm/query/types.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <future>
 #include <memory>
 #include <set>
 
@@ -100,6 +102,83 @@ class Writer {
   /** A vector of write cell ranges. */
   typedef std::vector<WriteCellRange> WriteCellRangeVec;
 
+  /**
+   * A group of attributes whose tiles are prepared, filtered and written
+   * together, restricted to a range of tiles. An attribute whose tiles
+   * alone exceed the memory budget is split into several groups, each
+   * covering a range of its tiles.
+   */
+  struct WriteGroup {
+    /** The first attribute index. */
+    uint64_t begin_;
+    /** The attribute index following the last one. */
+    uint64_t end_;
+    /** The first tile index. */
+    uint64_t tile_begin_;
+    /** The tile index following the last one. */
+    uint64_t tile_end_;
+
+    /** Constructor. */
+    WriteGroup(
+        uint64_t begin, uint64_t end, uint64_t tile_begin, uint64_t tile_end)
+        : begin_(begin)
+        , end_(end)
+        , tile_begin_(tile_begin)
+        , tile_end_(tile_end) {
+    }
+  };
+
+  /**
+   * A batch submitted to an asynchronous write (see
+   * `sm.write_staging_buffers`). The batch is copied from the user buffers
+   * into staging buffers owned by the batch, from which it is filtered and
+   * written in the background, so that the user can refill the buffers
+   * with the next batch in the meantime.
+   */
+  struct StagedBatch {
+    /** The staging buffers of an attribute. */
+    struct StagingBuffer {
+      /** The fixed-sized (or offsets) buffer. */
+      std::vector<uint8_t> buffer_;
+      /** The size of the cells in `buffer_`. */
+      uint64_t buffer_size_;
+      /** The var-sized buffer (empty for fixed-sized attributes). */
+      std::vector<uint8_t> buffer_var_;
+      /** The size of the cells in `buffer_var_`. */
+      uint64_t buffer_var_size_;
+    };
+
+    /** The staging buffers, mapped from attribute names. */
+    std::unordered_map<std::string, StagingBuffer> buffers_;
+    /** The task writing the batch. */
+    std::future<Status> task_;
+  };
+
+  /**
+   * Restores the user buffers of the attributes whose offsets were
+   * converted by `convert_var_offsets` when it goes out of scope, so that
+   * the attribute buffers do not point to the converted offsets after a
+   * write, on any exit path.
+   */
+  struct ConvertedOffsetsGuard {
+    /** The writer whose buffers are restored. */
+    Writer* writer_;
+    /** The original user buffers, mapped from attribute names. */
+    std::unordered_map<std::string, AttributeBuffer> user_buffers_;
+
+    /** Constructor. */
+    explicit ConvertedOffsetsGuard(Writer* writer)
+        : writer_(writer) {
+    }
+
+    /** Destructor. It restores the user buffers. */
+    ~ConvertedOffsetsGuard() {
+      for (const auto& it : user_buffers_)
+        writer_->attr_buffers_[it.first] = it.second;
+      writer_->converted_offsets_.clear();
+    }
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -130,7 +209,10 @@ class Writer {
    */
   AttributeBuffer buffer(const std::string& attribute) const;
 
-  /** Finalizes the reader. */
+  /**
+   * Finalizes the writer. For asynchronous writes, it first waits for all
+   * the staged batches to be written.
+   */
   Status finalize();
 
   /**
@@ -232,13 +314,37 @@ class Writer {
    */
   Status set_subarray(const void* subarray);
 
+  /**
+   * Sets the format of the offsets of the var-sized attribute buffers,
+   * overriding `sm.var_offsets.bitsize` and `sm.var_offsets.extra_element`.
+   *
+   * @param bitsize The size of an offset in bits (`32` or `64`).
+   * @param extra_element If `true`, the offsets end with an extra element
+   *     holding the total size of the values.
+   * @return Status
+   */
+  Status set_var_offsets_format(uint32_t bitsize, bool extra_element);
+
   /*
    * Return the subarray
    * @return subarray
    */
   void* subarray() const;
 
-  /** Performs a write query using its set members. */
+  /** Returns the size (in bits) of the offsets of the var-sized buffers. */
+  uint32_t var_offsets_bitsize() const;
+
+  /**
+   * Returns `true` if the offsets of the var-sized buffers end with an extra
+   * element holding the total size of the values.
+   */
+  bool var_offsets_extra_element() const;
+
+  /**
+   * Performs a write query using its set members. If asynchronous writes
+   * are enabled (see `sm.write_staging_buffers`), the write proceeds in the
+   * background after the user buffers are staged (see `async_write`).
+   */
   Status write();
 
  private:
@@ -258,6 +364,14 @@ class Writer {
   /** Maps attribute names to their buffers. */
   std::unordered_map<std::string, AttributeBuffer> attr_buffers_;
 
+  /**
+   * The offsets of the var-sized attribute buffers converted by
+   * `convert_var_offsets`, along with their size in bytes, mapped from
+   * attribute names.
+   */
+  std::unordered_map<std::string, std::pair<std::vector<uint64_t>, uint64_t>>
+      converted_offsets_;
+
   /**
    * Meaningful only when `dedup_coords_` is `false`.
    * If `true`, a check for duplicate coordinates will be performed upon
@@ -290,9 +404,63 @@ class Writer {
   /** The name of the new fragment to be created. */
   URI fragment_uri_;
 
+  /** The size (in bits) of the offsets of the var-sized attribute buffers. */
+  uint32_t var_offsets_bitsize_;
+
+  /**
+   * If `true`, the offsets of the var-sized attribute buffers end with an
+   * extra element holding the total size of the values.
+   */
+  bool var_offsets_extra_element_;
+
   /** The state associated with global writes. */
   std::unique_ptr<GlobalWriteState> global_write_state_;
 
+  /**
+   * The memory budget for the fixed-sized tiles (including offsets and
+   * coordinates) prepared at once.
+   */
+  uint64_t memory_budget_;
+
+  /** The memory budget for the var-sized tiles prepared at once. */
+  uint64_t memory_budget_var_;
+
+  /**
+   * The maximum size of the unfiltered tiles of an attribute that global
+   * order writes filter and write together.
+   */
+  uint64_t write_batch_size_;
+
+  /**
+   * The number of batches that asynchronous writes can stage at once (see
+   * `sm.write_staging_buffers`). Zero disables asynchronous writes.
+   */
+  uint64_t write_staging_buffers_;
+
+  /**
+   * The writer that writes the staged batches in the background, in the
+   * order they were submitted.
+   */
+  std::unique_ptr<Writer> async_writer_;
+
+  /**
+   * The status of the last staged batch written. The batches following a
+   * failed one are not written.
+   */
+  Status async_status_;
+
+  /**
+   * The ring of staged batches, whose staging buffers are reused by
+   * successive submissions.
+   */
+  std::vector<StagedBatch> staged_batches_;
+
+  /** The position in `staged_batches_` of the next batch to be staged. */
+  size_t next_staged_batch_;
+
+  /** The thread pool writing the staged batches, with a single thread. */
+  std::unique_ptr<ThreadPool> staging_thread_pool_;
+
   /** True if the writer has been initialized. */
   bool initialized_;
 
@@ -313,6 +481,28 @@ class Writer {
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
+  /**
+   * Adds the size of the input prepared tiles to the `writer_tile_bytes`
+   * stats gauge. Like all stats, the gauge is process-global, i.e., it
+   * holds the tile bytes of all the writes in flight.
+   *
+   * @param tiles The prepared tiles.
+   * @param tile_bytes Set to the size of the tiles.
+   */
+  void account_tiles(
+      const std::vector<Tile>& tiles, uint64_t* tile_bytes) const;
+
+  /**
+   * Performs an asynchronous write, which stages the user buffers into the
+   * next batch of the ring and returns while the batch is written in the
+   * background. If all batches are in use, it first waits for the oldest
+   * one to be written.
+   *
+   * @return Status, which is the error of the oldest batch if its write
+   *     failed.
+   */
+  Status async_write();
+
   /** Checks if attributes has been appropriately set for the query. */
   Status check_attributes();
 
@@ -380,6 +570,9 @@ class Writer {
   template <class T>
   Status check_subarray() const;
 
+  /** Waits for the writes of the staged batches and discards the batches. */
+  void clear_staged_batches();
+
   /** Closes all attribute files, flushing their state to storage. */
   Status close_files(FragmentMetadata* meta) const;
 
@@ -416,6 +609,23 @@ class Writer {
    */
   Status compute_coord_dups(std::set<uint64_t>* coord_dups) const;
 
+  /**
+   * Returns the number of coordinate duplicates among the input range of
+   * sorted positions.
+   *
+   * @param cell_pos The sorted positions of the coordinates in the
+   *     `attr_buffers_`.
+   * @param coord_dups The positions of the duplicates.
+   * @param begin The index in `cell_pos` of the first position.
+   * @param end The index in `cell_pos` following the last position.
+   * @return The number of duplicates.
+   */
+  uint64_t count_coord_dups(
+      const std::vector<uint64_t>& cell_pos,
+      const std::set<uint64_t>& coord_dups,
+      uint64_t begin,
+      uint64_t end) const;
+
   /**
    * Computes the coordinates metadata (e.g., MBRs).
    *
@@ -428,6 +638,59 @@ class Writer {
   Status compute_coords_metadata(
       const std::vector<Tile>& tiles, FragmentMetadata* meta) const;
 
+  /**
+   * Computes a key for each coordinate tuple of the user buffers, such that
+   * the order of the keys is the global order of the coordinates. The key
+   * of a cell is the position of its tile in the tile order, times the
+   * number of cells per tile, plus the position of the cell within its tile
+   * in the cell order (or its Hilbert key, for the `HILBERT` cell order).
+   * Applicable only to integer domains whose keys fit in 64 bits.
+   *
+   * @tparam T The domain type.
+   * @param coords The coordinates.
+   * @param coords_num The number of coordinate tuples.
+   * @param keys The keys to be created.
+   * @param key_bits Set to the number of significant bits in the keys, or to
+   *     0 if the keys are not applicable to the domain.
+   * @return Status
+   */
+  template <class T>
+  Status compute_global_order_keys(
+      const T* coords,
+      uint64_t coords_num,
+      std::vector<uint64_t>* keys,
+      unsigned* key_bits) const;
+
+  /**
+   * Computes the Hilbert key of each coordinate tuple, so that the keys are
+   * not recomputed on every comparison by `GlobalCmp`. The keys are left
+   * empty unless the cell order is `HILBERT`.
+   *
+   * @tparam T The domain type.
+   * @param coords The coordinates.
+   * @param coords_num The number of coordinate tuples.
+   * @param keys The keys to be created.
+   */
+  template <class T>
+  void compute_hilbert_keys(
+      const T* coords,
+      uint64_t coords_num,
+      std::vector<uint64_t>* keys) const;
+
+  /**
+   * Computes the per-tile statistics (minimum, maximum, sum and number of
+   * NaN values) of an attribute, if the fragment stores statistics for it.
+   *
+   * @param attribute The attribute.
+   * @param tiles The (unfiltered) tiles of the attribute.
+   * @param meta The fragment metadata that will store the statistics.
+   * @return Status
+   */
+  Status compute_tile_stats(
+      const std::string& attribute,
+      const std::vector<Tile>& tiles,
+      FragmentMetadata* meta) const;
+
   /**
    * Computes the cell ranges to be written, derived from a
    * dense cell range iterator for a specific tile.
@@ -442,6 +705,22 @@ class Writer {
   Status compute_write_cell_ranges(
       DenseCellRangeIter<T>* iters, WriteCellRangeVec* write_cell_ranges) const;
 
+  /**
+   * Converts the offsets of the var-sized attribute buffers from the format
+   * set by `set_var_offsets_format` into 64-bit offsets without an extra
+   * element (which is what the write path operates on), and points the
+   * attribute buffers to the converted offsets. It does nothing if the
+   * offsets are already in that format.
+   *
+   * @param user_buffers The original user buffers of the converted
+   *     attributes, to be restored after the write (see
+   *     `ConvertedOffsetsGuard`). They are recorded as soon as each
+   *     attribute is converted, so that they are restored on errors too.
+   * @return Status
+   */
+  Status convert_var_offsets(
+      std::unordered_map<std::string, AttributeBuffer>* user_buffers);
+
   /**
    * Creates a new fragment.
    *
@@ -463,6 +742,26 @@ class Writer {
   Status filter_tiles(
       const std::string& attribute, std::vector<Tile>* tiles) const;
 
+  /**
+   * Filters the input tiles of an attribute and writes them to storage,
+   * streaming them in batches of at most `write_batch_size_` unfiltered
+   * bytes (and at least one tile). The write of a batch proceeds on the
+   * writer thread pool while the next batch is filtered, and the tiles of
+   * a batch are freed as soon as they are written.
+   *
+   * @param attribute The attribute the tiles belong to.
+   * @param frag_meta The fragment metadata.
+   * @param tiles The tiles to be filtered and written.
+   * @param tile_bytes The size accounted for the tiles by `account_tiles`,
+   *     which is decreased as tiles are freed.
+   * @return Status
+   */
+  Status filter_and_write_tiles(
+      const std::string& attribute,
+      FragmentMetadata* frag_meta,
+      std::vector<Tile>* tiles,
+      uint64_t* tile_bytes) const;
+
   /**
    * Runs the input tile for the input attribute through the filter pipeline.
    * The tile buffer is modified to contain the output of the pipeline.
@@ -514,9 +813,39 @@ class Writer {
   template <class T>
   Status global_write_handle_last_tile();
 
+  /**
+   * Splits the attributes into consecutive groups whose tiles are expected
+   * to fit in the memory budget, along with the buffers the write holds
+   * while the tiles are prepared. The tiles of a group are prepared,
+   * filtered and written before those of the next group are prepared.
+   * Every group holds at least one attribute, except that an attribute
+   * whose tiles alone exceed the budget is split into groups of tile
+   * ranges, each holding at least one tile.
+   *
+   * @param tile_num The number of tiles to be written, or 0 if it is not
+   *     known in advance, in which case no attribute is split.
+   * @param dense_tiles `true` if the tiles hold all the cells of a dense
+   *     tile, including the empty ones, and not only the cells of the user
+   *     buffers.
+   * @param reserved_bytes The size of the buffers held along with the
+   *     tiles, which is subtracted from the fixed-sized budget.
+   * @param groups The groups.
+   */
+  void group_attributes(
+      uint64_t tile_num,
+      bool dense_tiles,
+      uint64_t reserved_bytes,
+      std::vector<WriteGroup>* groups) const;
+
   /** Returns `true` if the coordinates are included in the attributes. */
   bool has_coords() const;
 
+  /**
+   * Creates the writer of the staged batches, along with the ring of
+   * `write_staging_buffers_` batches.
+   */
+  Status init_async_writer();
+
   /** Initializes the global write state. */
   Status init_global_write_state();
 
@@ -673,13 +1002,17 @@ class Writer {
    * input attribute.
    *
    * @param attribute The attribute to prepare the tiles for.
-   * @param write_cell_ranges The write cell ranges.
+   * @param write_cell_ranges The write cell ranges, one vector per tile.
+   * @param tile_begin The index of the first tile to prepare.
+   * @param tile_end The index following the last tile to prepare.
    * @param tiles The tiles to be created.
    * @return Status
    */
   Status prepare_tiles(
       const std::string& attribute,
       const std::vector<WriteCellRangeVec>& write_cell_ranges,
+      uint64_t tile_begin,
+      uint64_t tile_end,
       std::vector<Tile>* tiles) const;
 
   /**
@@ -691,6 +1024,9 @@ class Writer {
    *     according to which the cells must be re-arranged.
    * @param coord_dups The set with the positions
    *     of duplicate coordinates/cells.
+   * @param begin The index in `cell_pos` of the first cell to prepare,
+   *     which must start a tile.
+   * @param end The index in `cell_pos` following the last cell to prepare.
    * @param tiles The tiles to be created.
    * @return Status
    */
@@ -698,6 +1034,8 @@ class Writer {
       const std::string& attribute,
       const std::vector<uint64_t>& cell_pos,
       const std::set<uint64_t>& coord_dups,
+      uint64_t begin,
+      uint64_t end,
       std::vector<Tile>* tiles) const;
 
   /**
@@ -710,6 +1048,9 @@ class Writer {
    *     according to which the cells must be re-arranged.
    * @param coord_dups The set with the positions
    *     of duplicate coordinates/cells.
+   * @param begin The index in `cell_pos` of the first cell to prepare,
+   *     which must start a tile.
+   * @param end The index in `cell_pos` following the last cell to prepare.
    * @param tiles The tiles to be created.
    * @return Status
    */
@@ -717,6 +1058,8 @@ class Writer {
       const std::string& attribute,
       const std::vector<uint64_t>& cell_pos,
       const std::set<uint64_t>& coord_dups,
+      uint64_t begin,
+      uint64_t end,
       std::vector<Tile>* tiles) const;
 
   /**
@@ -729,6 +1072,9 @@ class Writer {
    *     according to which the cells must be re-arranged.
    * @param coord_dups The set with the positions
    *     of duplicate coordinates/cells.
+   * @param begin The index in `cell_pos` of the first cell to prepare,
+   *     which must start a tile.
+   * @param end The index in `cell_pos` following the last cell to prepare.
    * @param tiles The tiles to be created.
    * @return Status
    */
@@ -736,14 +1082,40 @@ class Writer {
       const std::string& attribute,
       const std::vector<uint64_t>& cell_pos,
       const std::set<uint64_t>& coord_dups,
+      uint64_t begin,
+      uint64_t end,
       std::vector<Tile>* tiles) const;
 
-  /** Resets the writer object, rendering it incomplete. */
-  void reset();
+  /**
+   * Frees the tiles of a group of attributes once they have been written
+   * (or upon error), and removes their size from the `writer_tile_bytes`
+   * stats gauge.
+   *
+   * @param group The group of attributes.
+   * @param tile_bytes The sizes accounted by `account_tiles`, one per
+   *     attribute.
+   * @param attribute_tiles The tiles, one vector per attribute.
+   */
+  void release_tiles(
+      const WriteGroup& group,
+      std::vector<uint64_t>* tile_bytes,
+      std::vector<std::vector<Tile>>* attribute_tiles) const;
+
+  /**
+   * Resets the writer object, rendering it incomplete. The staged batches
+   * of an asynchronous write are written first.
+   *
+   * @return Status. An error if any of the staged batches failed to be
+   *     written, even though the writer is reset.
+   */
+  Status reset();
 
   /**
    * Sorts the coordinates of the user buffers, creating a vector with
-   * the sorted positions.
+   * the sorted positions. Integer domains are radix-sorted on the keys of
+   * `compute_global_order_keys`, if the sort buffers fit in the memory
+   * budget; the rest are sorted with `GlobalCmp`, on precomputed Hilbert
+   * keys under the Hilbert cell order.
    *
    * @tparam T The domain type.
    * @param cell_pos The sorted cell positions to be created.
@@ -752,6 +1124,14 @@ class Writer {
   template <class T>
   Status sort_coords(std::vector<uint64_t>* cell_pos) const;
 
+  /**
+   * Copies the user buffers into the staging buffers of the input batch.
+   *
+   * @param batch The batch to be staged.
+   * @return Status
+   */
+  Status stage_batch(StagedBatch* batch) const;
+
   /**
    * Writes in unordered layout. Applicable to both dense and sparse arrays.
    * Explicit coordinates must be provided for this write.
@@ -767,6 +1147,9 @@ class Writer {
   template <class T>
   Status unordered_write();
 
+  /** Waits for the writes of the staged batches to complete. */
+  void wait_staged_batches();
+
   /**
    * Writes an empty cell range to the input tile.
    * Applicable to **fixed-sized** attributes.
@@ -826,11 +1209,24 @@ class Writer {
    * Writes all the input tiles to storage.
    *
    * @param attribute_tiles Tiles to be written, one element per attribute.
+   *     Attributes without tiles are skipped.
+   * @param close_files `true` if the attribute files are closed after the
+   *     tiles are written, i.e., if no more tiles follow for the attributes.
    * @return Status
    */
   Status write_all_tiles(
       FragmentMetadata* frag_meta,
-      const std::vector<std::vector<Tile>>& attribute_tiles) const;
+      const std::vector<std::vector<Tile>>& attribute_tiles,
+      bool close_files) const;
+
+  /**
+   * Writes a staged batch with `async_writer_`. Runs on
+   * `staging_thread_pool_`.
+   *
+   * @param batch The staged batch.
+   * @return Status
+   */
+  Status write_staged_batch(StagedBatch* batch);
 
   /**
    * Writes the input tiles for the input attribute to storage.
@@ -838,12 +1234,35 @@ class Writer {
    * @param attribute The attribute the tiles belong to.
    * @param frag_meta The fragment metadata.
    * @param tiles The tiles to be written.
+   * @param close_files `true` if the attribute files are closed after the
+   *     tiles are written.
+   * @return Status
+   */
+  Status write_tiles(
+      const std::string& attribute,
+      FragmentMetadata* frag_meta,
+      const std::vector<Tile>& tiles,
+      bool close_files) const;
+
+  /**
+   * Writes a range of the input tiles for the input attribute to storage,
+   * without closing the attribute files. The range must follow the tiles
+   * written last for the attribute.
+   *
+   * @param attribute The attribute the tiles belong to.
+   * @param frag_meta The fragment metadata.
+   * @param tiles The tiles, of which the ones in `[begin, end)` are written.
+   *     For var-sized attributes, `begin` and `end` are even.
+   * @param begin The index of the first tile to write.
+   * @param end The index following the last tile to write.
    * @return Status
    */
   Status write_tiles(
       const std::string& attribute,
       FragmentMetadata* frag_meta,
-      const std::vector<Tile>& tiles) const;
+      const std::vector<Tile>& tiles,
+      uint64_t begin,
+      uint64_t end) const;
 };
 
 }  // namespace sm
@@ -0,0 +1,267 @@
+/**
+ * @file   rtree.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class RTree.
+ */
+
+#include "tiledb/sm/rtree/rtree.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+RTree::RTree() {
+  dim_num_ = 0;
+  fanout_ = 0;
+  mbr_size_ = 0;
+  type_ = Datatype::INT32;
+}
+
+RTree::RTree(
+    Datatype type,
+    unsigned dim_num,
+    unsigned fanout,
+    const std::vector<void*>& mbrs)
+    : dim_num_(dim_num)
+    , fanout_(fanout)
+    , type_(type) {
+  assert(fanout_ > 1);
+  mbr_size_ = 2 * dim_num_ * datatype_size(type_);
+
+  switch (type_) {
+    case Datatype::INT8:
+      build_tree<int8_t>(mbrs);
+      break;
+    case Datatype::UINT8:
+      build_tree<uint8_t>(mbrs);
+      break;
+    case Datatype::INT16:
+      build_tree<int16_t>(mbrs);
+      break;
+    case Datatype::UINT16:
+      build_tree<uint16_t>(mbrs);
+      break;
+    case Datatype::INT32:
+      build_tree<int>(mbrs);
+      break;
+    case Datatype::UINT32:
+      build_tree<unsigned>(mbrs);
+      break;
+    case Datatype::INT64:
+      build_tree<int64_t>(mbrs);
+      break;
+    case Datatype::UINT64:
+      build_tree<uint64_t>(mbrs);
+      break;
+    case Datatype::FLOAT32:
+      build_tree<float>(mbrs);
+      break;
+    case Datatype::FLOAT64:
+      build_tree<double>(mbrs);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+RTree::~RTree() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+unsigned RTree::dim_num() const {
+  return dim_num_;
+}
+
+unsigned RTree::fanout() const {
+  return fanout_;
+}
+
+template <class T>
+TileOverlap RTree::get_tile_overlap(const T* rect) const {
+  TileOverlap overlap;
+  if (levels_.empty())
+    return overlap;
+
+  // For easy reference
+  auto leaf_level = height() - 1;
+  auto leaf_num = this->leaf_num();
+  std::vector<T> overlap_rect(2 * dim_num_);
+  bool contains, overlaps;
+
+  // Depth-first traversal. Children are pushed in reverse order, so that
+  // the tiles are reported in ascending order of their ids.
+  std::vector<std::pair<unsigned, uint64_t>> stack;
+  stack.emplace_back(0, 0);
+  while (!stack.empty()) {
+    auto level = stack.back().first;
+    auto idx = stack.back().second;
+    stack.pop_back();
+
+    auto mbr = (const T*)&levels_[level][idx * mbr_size_];
+    if (!utils::geometry::overlap(rect, mbr, dim_num_, &contains))
+      continue;
+
+    // The whole subtree is contained in the query
+    if (contains) {
+      auto start = idx * subtree_leaf_num_[level];
+      auto end = std::min(start + subtree_leaf_num_[level], leaf_num) - 1;
+      if (!overlap.tile_ranges_.empty() &&
+          overlap.tile_ranges_.back().second + 1 == start)
+        overlap.tile_ranges_.back().second = end;
+      else
+        overlap.tile_ranges_.emplace_back(start, end);
+      continue;
+    }
+
+    // Partially overlapping leaf
+    if (level == leaf_level) {
+      utils::geometry::overlap(
+          rect, mbr, dim_num_, &overlap_rect[0], &overlaps);
+      auto cov = utils::geometry::coverage(&overlap_rect[0], mbr, dim_num_);
+      overlap.tiles_.emplace_back(idx, cov);
+      continue;
+    }
+
+    // Partially overlapping internal node
+    auto child_start = idx * fanout_;
+    auto child_end = std::min(child_start + fanout_, node_num(level + 1));
+    for (auto c = child_end; c > child_start; --c)
+      stack.emplace_back(level + 1, c - 1);
+  }
+
+  return overlap;
+}
+
+unsigned RTree::height() const {
+  return (unsigned)levels_.size();
+}
+
+uint64_t RTree::leaf_num() const {
+  return levels_.empty() ? 0 : node_num(height() - 1);
+}
+
+const void* RTree::node_mbr(unsigned level, uint64_t idx) const {
+  assert(level < levels_.size());
+  assert(idx < node_num(level));
+  return &levels_[level][idx * mbr_size_];
+}
+
+uint64_t RTree::node_num(unsigned level) const {
+  assert(level < levels_.size());
+  return levels_[level].size() / mbr_size_;
+}
+
+Datatype RTree::type() const {
+  return type_;
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+template <class T>
+void RTree::build_tree(const std::vector<void*>& mbrs) {
+  auto mbr_num = (uint64_t)mbrs.size();
+  if (mbr_num == 0)
+    return;
+
+  // Create the leaf level
+  std::vector<std::vector<uint8_t>> levels;
+  std::vector<uint8_t> leaves(mbr_num * mbr_size_);
+  for (uint64_t i = 0; i < mbr_num; ++i)
+    std::memcpy(&leaves[i * mbr_size_], mbrs[i], mbr_size_);
+  levels.push_back(std::move(leaves));
+
+  // Create the upper levels, until a single root remains
+  while (levels.back().size() > mbr_size_) {
+    const auto& children = levels.back();
+    auto child_num = children.size() / mbr_size_;
+    auto parent_num = utils::math::ceil(child_num, fanout_);
+    std::vector<uint8_t> parents(parent_num * mbr_size_);
+    for (uint64_t p = 0; p < parent_num; ++p) {
+      auto parent = (T*)&parents[p * mbr_size_];
+      auto child_start = p * fanout_;
+      auto child_end = std::min(child_start + fanout_, child_num);
+      std::memcpy(parent, &children[child_start * mbr_size_], mbr_size_);
+      for (auto c = child_start + 1; c < child_end; ++c) {
+        auto child = (const T*)&children[c * mbr_size_];
+        for (unsigned d = 0; d < dim_num_; ++d) {
+          parent[2 * d] = std::min(parent[2 * d], child[2 * d]);
+          parent[2 * d + 1] = std::max(parent[2 * d + 1], child[2 * d + 1]);
+        }
+      }
+    }
+    levels.push_back(std::move(parents));
+  }
+
+  // Store the levels from the root to the leaves
+  levels_.assign(
+      std::make_move_iterator(levels.rbegin()),
+      std::make_move_iterator(levels.rend()));
+
+  // Compute the number of leaves covered by each subtree per level
+  subtree_leaf_num_.resize(levels_.size());
+  uint64_t subtree_leaf_num = 1;
+  for (auto l = (int64_t)levels_.size() - 1; l >= 0; --l) {
+    subtree_leaf_num_[l] = subtree_leaf_num;
+    subtree_leaf_num *= fanout_;
+  }
+}
+
+// Explicit template instantiations
+template TileOverlap RTree::get_tile_overlap<int8_t>(const int8_t* rect) const;
+template TileOverlap RTree::get_tile_overlap<uint8_t>(
+    const uint8_t* rect) const;
+template TileOverlap RTree::get_tile_overlap<int16_t>(
+    const int16_t* rect) const;
+template TileOverlap RTree::get_tile_overlap<uint16_t>(
+    const uint16_t* rect) const;
+template TileOverlap RTree::get_tile_overlap<int>(const int* rect) const;
+template TileOverlap RTree::get_tile_overlap<unsigned>(
+    const unsigned* rect) const;
+template TileOverlap RTree::get_tile_overlap<int64_t>(
+    const int64_t* rect) const;
+template TileOverlap RTree::get_tile_overlap<uint64_t>(
+    const uint64_t* rect) const;
+template TileOverlap RTree::get_tile_overlap<float>(const float* rect) const;
+template TileOverlap RTree::get_tile_overlap<double>(const double* rect) const;
+
+}  // namespace sm
+}  // namespace tiledb
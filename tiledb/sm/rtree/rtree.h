@@ -0,0 +1,195 @@
+/**
+ * @file   rtree.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2018 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class RTree.
+ */
+
+#ifndef TILEDB_RTREE_H
+#define TILEDB_RTREE_H
+
+#include <cinttypes>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+enum class Datatype : uint8_t;
+
+/**
+ * The result of an R-tree query, i.e., the tiles that overlap with
+ * a hyper-rectangle.
+ */
+struct TileOverlap {
+  /**
+   * The ids of the tiles that partially overlap with the query
+   * hyper-rectangle, along with the ratio of the MBR of the tile that
+   * is covered by the query.
+   */
+  std::vector<std::pair<uint64_t, double>> tiles_;
+
+  /**
+   * Ranges `[start, end]` of consecutive tile ids, whose MBRs are fully
+   * contained in the query hyper-rectangle. The ranges are sorted and
+   * disjoint.
+   */
+  std::vector<std::pair<uint64_t, uint64_t>> tile_ranges_;
+};
+
+/**
+ * A static, in-memory R-tree over a sequence of MBRs (one per data tile).
+ * The tree is bulk-loaded bottom-up, i.e., every `fanout` consecutive
+ * MBRs are grouped into a parent node, and so on until a single root
+ * remains. Since the MBRs of a sparse fragment are created from cells
+ * sorted in the global order, consecutive MBRs are spatially close and,
+ * thus, this simple packing produces tight internal nodes.
+ *
+ * The leaf level stores a copy of the MBRs in a contiguous buffer, and
+ * each subtree covers a contiguous range of tile ids.
+ */
+class RTree {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  RTree();
+
+  /**
+   * Constructor. This bulk-loads the R-tree from the input MBRs.
+   *
+   * @param type The datatype of the MBRs.
+   * @param dim_num The number of dimensions.
+   * @param fanout The maximum number of children of an internal node.
+   * @param mbrs The MBRs (one per tile), each stored as `[low, high]` pairs
+   *     along each dimension.
+   */
+  RTree(
+      Datatype type,
+      unsigned dim_num,
+      unsigned fanout,
+      const std::vector<void*>& mbrs);
+
+  /** Destructor. */
+  ~RTree();
+
+  /** Copy constructor. */
+  RTree(const RTree& rtree) = default;
+
+  /** Move constructor. */
+  RTree(RTree&& rtree) = default;
+
+  /** Copy-assign operator. */
+  RTree& operator=(const RTree& rtree) = default;
+
+  /** Move-assign operator. */
+  RTree& operator=(RTree&& rtree) = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the number of dimensions. */
+  unsigned dim_num() const;
+
+  /** Returns the fanout. */
+  unsigned fanout() const;
+
+  /**
+   * Returns the tiles that overlap with the input hyper-rectangle.
+   *
+   * @tparam T The type of the MBRs and `rect`.
+   * @param rect The query hyper-rectangle, as `[low, high]` pairs along
+   *     each dimension.
+   * @return The overlapping tiles. Tile ids in both the partial and the full
+   *     overlap lists are sorted in ascending order.
+   */
+  template <class T>
+  TileOverlap get_tile_overlap(const T* rect) const;
+
+  /** Returns the number of levels in the tree (0 if it is empty). */
+  unsigned height() const;
+
+  /** Returns the number of leaves (i.e., tiles) indexed by the tree. */
+  uint64_t leaf_num() const;
+
+  /**
+   * Returns the MBR of the `idx`-th node of the input level, where level 0
+   * is the root and level `height() - 1` holds the leaves.
+   */
+  const void* node_mbr(unsigned level, uint64_t idx) const;
+
+  /** Returns the number of nodes in the input level. */
+  uint64_t node_num(unsigned level) const;
+
+  /** Returns the datatype of the MBRs. */
+  Datatype type() const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The number of dimensions. */
+  unsigned dim_num_;
+
+  /** The maximum number of children of an internal node. */
+  unsigned fanout_;
+
+  /**
+   * The tree levels, from the root (first) to the leaves (last). Each level
+   * stores the MBRs of its nodes contiguously.
+   */
+  std::vector<std::vector<uint8_t>> levels_;
+
+  /** The size of a single MBR in bytes. */
+  uint64_t mbr_size_;
+
+  /**
+   * The number of leaves covered by a (full) subtree rooted at each level,
+   * i.e., `fanout^(height - 1 - level)`.
+   */
+  std::vector<uint64_t> subtree_leaf_num_;
+
+  /** The datatype of the MBRs. */
+  Datatype type_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Bulk-loads the tree from the input MBRs. */
+  template <class T>
+  void build_tree(const std::vector<void*>& mbrs);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_RTREE_H
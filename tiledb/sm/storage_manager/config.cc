@@ -170,6 +170,28 @@ Status Config::set(const std::string& param, const std::string& value) {
     RETURN_NOT_OK(set_sm_check_global_order(value));
   } else if (param == "sm.tile_cache_size") {
     RETURN_NOT_OK(set_sm_tile_cache_size(value));
+  } else if (param == "sm.read_inflight_size") {
+    RETURN_NOT_OK(set_sm_read_inflight_size(value));
+  } else if (param == "sm.read_coalesce_gap") {
+    RETURN_NOT_OK(set_sm_read_coalesce_gap(value));
+  } else if (param == "sm.read_coalesce_max_size") {
+    RETURN_NOT_OK(set_sm_read_coalesce_max_size(value));
+  } else if (param == "sm.read_prefetch_partitions") {
+    RETURN_NOT_OK(set_sm_read_prefetch_partitions(value));
+  } else if (param == "sm.read_prefetch_memory_budget") {
+    RETURN_NOT_OK(set_sm_read_prefetch_memory_budget(value));
+  } else if (param == "sm.memory_budget") {
+    RETURN_NOT_OK(set_sm_memory_budget(value));
+  } else if (param == "sm.memory_budget_var") {
+    RETURN_NOT_OK(set_sm_memory_budget_var(value));
+  } else if (param == "sm.write_batch_size") {
+    RETURN_NOT_OK(set_sm_write_batch_size(value));
+  } else if (param == "sm.write_staging_buffers") {
+    RETURN_NOT_OK(set_sm_write_staging_buffers(value));
+  } else if (param == "sm.var_offsets.bitsize") {
+    RETURN_NOT_OK(set_sm_var_offsets_bitsize(value));
+  } else if (param == "sm.var_offsets.extra_element") {
+    RETURN_NOT_OK(set_sm_var_offsets_extra_element(value));
   } else if (param == "sm.array_schema_cache_size") {
     RETURN_NOT_OK(set_sm_array_schema_cache_size(value));
   } else if (param == "sm.fragment_metadata_cache_size") {
@@ -188,6 +210,8 @@ Status Config::set(const std::string& param, const std::string& value) {
     RETURN_NOT_OK(set_vfs_file_creation_permission(value));
   } else if (param == "vfs.file.max_parallel_ops") {
     RETURN_NOT_OK(set_vfs_file_max_parallel_ops(value));
+  } else if (param == "vfs.file.max_open_files") {
+    RETURN_NOT_OK(set_vfs_file_max_open_files(value));
   } else if (param == "vfs.s3.region") {
     RETURN_NOT_OK(set_vfs_s3_region(value));
   } else if (param == "vfs.s3.aws_access_key_id") {
@@ -284,6 +308,63 @@ Status Config::unset(const std::string& param) {
     value << sm_params_.tile_cache_size_;
     param_values_["sm.tile_cache_size"] = value.str();
     value.str(std::string());
+  } else if (param == "sm.read_inflight_size") {
+    sm_params_.read_inflight_size_ = constants::read_inflight_size;
+    value << sm_params_.read_inflight_size_;
+    param_values_["sm.read_inflight_size"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.read_coalesce_gap") {
+    sm_params_.read_coalesce_gap_ = constants::read_coalesce_gap;
+    value << sm_params_.read_coalesce_gap_;
+    param_values_["sm.read_coalesce_gap"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.read_coalesce_max_size") {
+    sm_params_.read_coalesce_max_size_ = constants::read_coalesce_max_size;
+    value << sm_params_.read_coalesce_max_size_;
+    param_values_["sm.read_coalesce_max_size"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.read_prefetch_partitions") {
+    sm_params_.read_prefetch_partitions_ = constants::read_prefetch_partitions;
+    value << sm_params_.read_prefetch_partitions_;
+    param_values_["sm.read_prefetch_partitions"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.read_prefetch_memory_budget") {
+    sm_params_.read_prefetch_memory_budget_ =
+        constants::read_prefetch_memory_budget;
+    value << sm_params_.read_prefetch_memory_budget_;
+    param_values_["sm.read_prefetch_memory_budget"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.memory_budget") {
+    sm_params_.memory_budget_ = constants::memory_budget;
+    value << sm_params_.memory_budget_;
+    param_values_["sm.memory_budget"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.memory_budget_var") {
+    sm_params_.memory_budget_var_ = constants::memory_budget_var;
+    value << sm_params_.memory_budget_var_;
+    param_values_["sm.memory_budget_var"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.write_batch_size") {
+    sm_params_.write_batch_size_ = constants::write_batch_size;
+    value << sm_params_.write_batch_size_;
+    param_values_["sm.write_batch_size"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.write_staging_buffers") {
+    sm_params_.write_staging_buffers_ = constants::write_staging_buffers;
+    value << sm_params_.write_staging_buffers_;
+    param_values_["sm.write_staging_buffers"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.var_offsets.bitsize") {
+    sm_params_.var_offsets_bitsize_ = constants::var_offsets_bitsize;
+    value << sm_params_.var_offsets_bitsize_;
+    param_values_["sm.var_offsets.bitsize"] = value.str();
+    value.str(std::string());
+  } else if (param == "sm.var_offsets.extra_element") {
+    sm_params_.var_offsets_extra_element_ =
+        constants::var_offsets_extra_element;
+    value << (sm_params_.var_offsets_extra_element_ ? "true" : "false");
+    param_values_["sm.var_offsets.extra_element"] = value.str();
+    value.str(std::string());
   } else if (param == "sm.array_schema_cache_size") {
     sm_params_.array_schema_cache_size_ = constants::array_schema_cache_size;
     value << sm_params_.array_schema_cache_size_;
@@ -342,6 +423,12 @@ Status Config::unset(const std::string& param) {
     value << vfs_params_.file_params_.max_parallel_ops_;
     param_values_["vfs.file.max_parallel_ops"] = value.str();
     value.str(std::string());
+  } else if (param == "vfs.file.max_open_files") {
+    vfs_params_.file_params_.max_open_files_ =
+        constants::vfs_file_max_open_files;
+    value << vfs_params_.file_params_.max_open_files_;
+    param_values_["vfs.file.max_open_files"] = value.str();
+    value.str(std::string());
   } else if (param == "vfs.s3.region") {
     vfs_params_.s3_params_.region_ = constants::s3_region;
     value << vfs_params_.s3_params_.region_;
@@ -482,6 +569,50 @@ void Config::set_default_param_values() {
   param_values_["sm.tile_cache_size"] = value.str();
   value.str(std::string());
 
+  value << sm_params_.read_inflight_size_;
+  param_values_["sm.read_inflight_size"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.read_coalesce_gap_;
+  param_values_["sm.read_coalesce_gap"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.read_coalesce_max_size_;
+  param_values_["sm.read_coalesce_max_size"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.read_prefetch_partitions_;
+  param_values_["sm.read_prefetch_partitions"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.read_prefetch_memory_budget_;
+  param_values_["sm.read_prefetch_memory_budget"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.memory_budget_;
+  param_values_["sm.memory_budget"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.memory_budget_var_;
+  param_values_["sm.memory_budget_var"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.write_batch_size_;
+  param_values_["sm.write_batch_size"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.write_staging_buffers_;
+  param_values_["sm.write_staging_buffers"] = value.str();
+  value.str(std::string());
+
+  value << sm_params_.var_offsets_bitsize_;
+  param_values_["sm.var_offsets.bitsize"] = value.str();
+  value.str(std::string());
+
+  value << (sm_params_.var_offsets_extra_element_ ? "true" : "false");
+  param_values_["sm.var_offsets.extra_element"] = value.str();
+  value.str(std::string());
+
   value << sm_params_.array_schema_cache_size_;
   param_values_["sm.array_schema_cache_size"] = value.str();
   value.str(std::string());
@@ -526,6 +657,10 @@ void Config::set_default_param_values() {
   param_values_["vfs.file.max_parallel_ops"] = value.str();
   value.str(std::string());
 
+  value << vfs_params_.file_params_.max_open_files_;
+  param_values_["vfs.file.max_open_files"] = value.str();
+  value.str(std::string());
+
   value << vfs_params_.s3_params_.region_;
   param_values_["vfs.s3.region"] = value.str();
   value.str(std::string());
@@ -725,6 +860,99 @@ Status Config::set_sm_tile_cache_size(const std::string& value) {
   return Status::Ok();
 }
 
+Status Config::set_sm_read_inflight_size(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.read_inflight_size_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_read_coalesce_gap(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.read_coalesce_gap_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_read_coalesce_max_size(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.read_coalesce_max_size_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_read_prefetch_partitions(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.read_prefetch_partitions_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_read_prefetch_memory_budget(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.read_prefetch_memory_budget_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_memory_budget(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.memory_budget_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_memory_budget_var(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.memory_budget_var_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_write_batch_size(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.write_batch_size_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_write_staging_buffers(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  sm_params_.write_staging_buffers_ = v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_var_offsets_bitsize(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  if (v != 32 && v != 64)
+    return LOG_STATUS(Status::ConfigError(
+        "Cannot set parameter; Invalid var offsets bitsize value"));
+  sm_params_.var_offsets_bitsize_ = (uint32_t)v;
+
+  return Status::Ok();
+}
+
+Status Config::set_sm_var_offsets_extra_element(const std::string& value) {
+  bool v = false;
+  if (!parse_bool(value, &v).ok()) {
+    return LOG_STATUS(Status::ConfigError(
+        "Cannot set parameter; Invalid var offsets extra element value"));
+  }
+  sm_params_.var_offsets_extra_element_ = v;
+  return Status::Ok();
+}
+
 Status Config::set_vfs_num_threads(const std::string& value) {
   uint64_t v;
   RETURN_NOT_OK(utils::parse::convert(value, &v));
@@ -749,6 +977,14 @@ Status Config::set_vfs_file_max_parallel_ops(const std::string& value) {
   return Status::Ok();
 }
 
+Status Config::set_vfs_file_max_open_files(const std::string& value) {
+  uint64_t v;
+  RETURN_NOT_OK(utils::parse::convert(value, &v));
+  vfs_params_.file_params_.max_open_files_ = v;
+
+  return Status::Ok();
+}
+
 Status Config::set_vfs_s3_region(const std::string& value) {
   vfs_params_.s3_params_.region_ = value;
   return Status::Ok();
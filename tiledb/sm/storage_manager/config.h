@@ -60,6 +60,17 @@ class Config {
     uint64_t num_writer_threads_;
     int num_tbb_threads_;
     uint64_t tile_cache_size_;
+    uint64_t read_inflight_size_;
+    uint64_t read_coalesce_gap_;
+    uint64_t read_coalesce_max_size_;
+    uint64_t read_prefetch_partitions_;
+    uint64_t read_prefetch_memory_budget_;
+    uint64_t memory_budget_;
+    uint64_t memory_budget_var_;
+    uint64_t write_batch_size_;
+    uint64_t write_staging_buffers_;
+    uint32_t var_offsets_bitsize_;
+    bool var_offsets_extra_element_;
     bool dedup_coords_;
     bool check_coord_dups_;
     bool check_coord_oob_;
@@ -74,6 +85,17 @@ class Config {
       num_writer_threads_ = constants::num_writer_threads;
       num_tbb_threads_ = constants::num_tbb_threads;
       tile_cache_size_ = constants::tile_cache_size;
+      read_inflight_size_ = constants::read_inflight_size;
+      read_coalesce_gap_ = constants::read_coalesce_gap;
+      read_coalesce_max_size_ = constants::read_coalesce_max_size;
+      read_prefetch_partitions_ = constants::read_prefetch_partitions;
+      read_prefetch_memory_budget_ = constants::read_prefetch_memory_budget;
+      memory_budget_ = constants::memory_budget;
+      memory_budget_var_ = constants::memory_budget_var;
+      write_batch_size_ = constants::write_batch_size;
+      write_staging_buffers_ = constants::write_staging_buffers;
+      var_offsets_bitsize_ = constants::var_offsets_bitsize;
+      var_offsets_extra_element_ = constants::var_offsets_extra_element;
       dedup_coords_ = false;
       check_coord_dups_ = true;
       check_coord_oob_ = true;
@@ -135,10 +157,12 @@ class Config {
 
   struct FileParams {
     uint64_t max_parallel_ops_;
+    uint64_t max_open_files_;
     int creation_permission_;
 
     FileParams() {
       max_parallel_ops_ = constants::vfs_file_max_parallel_ops;
+      max_open_files_ = constants::vfs_file_max_open_files;
       creation_permission_ = constants::vfs_file_creation_permission;
     }
   };
@@ -215,6 +239,71 @@ class Config {
    * - `sm.tile_cache_size` <br>
    *    The tile cache size in bytes. Any `uint64_t` value is acceptable. <br>
    *    **Default**: 10,000,000
+   * - `sm.read_inflight_size` <br>
+   *    The maximum number of bytes of (persisted) tiles that a read query
+   *    fetches and unfilters concurrently. Tiles are streamed from storage
+   *    through the filter pipeline to the result buffers, and new tile
+   *    reads are issued only when earlier ones have completed within this
+   *    budget. At least one tile is always in flight. <br>
+   *    **Default**: 100,000,000
+   * - `sm.read_coalesce_gap` <br>
+   *    Tiles of the same file that are at most this many bytes apart are
+   *    fetched with a single read request, discarding the bytes in between.
+   *    <br>
+   *    **Default**: 65536
+   * - `sm.read_coalesce_max_size` <br>
+   *    The maximum number of bytes of a single coalesced tile read request.
+   *    A tile larger than this is still fetched with a single request. <br>
+   *    **Default**: 10485760
+   * - `sm.read_prefetch_partitions` <br>
+   *    The number of subarray partitions that an incomplete read query
+   *    fetches and decodes ahead of the user into internal staging buffers,
+   *    so that the next submission returns an already prepared partition.
+   *    `0` disables prefetching. <br>
+   *    **Default**: 0
+   * - `sm.read_prefetch_memory_budget` <br>
+   *    The maximum number of bytes of the staging buffers of the prefetched
+   *    partitions. Every prefetched partition needs as much memory as the
+   *    user buffers, so fewer partitions are prefetched if they do not fit.
+   *    <br>
+   *    **Default**: 1,000,000,000
+   * - `sm.memory_budget` <br>
+   *    The maximum number of bytes of the fixed-sized tiles (including
+   *    offsets and coordinates) that a read or write query holds in memory
+   *    at once. Reads partition the subarray further if the tiles that
+   *    overlap with a partition exceed it, and never keep more tile bytes in
+   *    flight. Writes prepare, filter and write the attributes in groups
+   *    whose tiles fit in it. <br>
+   *    **Default**: 5GB
+   * - `sm.memory_budget_var` <br>
+   *    The same as `sm.memory_budget`, but for the tiles of the values of
+   *    var-sized attributes. <br>
+   *    **Default**: 10GB
+   * - `sm.write_batch_size` <br>
+   *    The maximum number of (unfiltered) tile bytes of an attribute that
+   *    global order writes filter and write together. The write of a batch
+   *    overlaps with the filtering of the next one. <br>
+   *    **Default**: 10,000,000
+   * - `sm.write_staging_buffers` <br>
+   *    If greater than 0, write queries copy each submitted batch into one of
+   *    this many internal staging buffers and return immediately, filtering
+   *    and writing the batch in the background. The query buffers can then
+   *    be refilled with the next batch right away. A submission waits only
+   *    when all staging buffers are in use. Such queries must be finalized
+   *    in every layout, which waits for all batches to be written. Errors
+   *    of background writes are returned by the next submissions or by
+   *    finalization. <br>
+   *    **Default**: 0
+   * - `sm.var_offsets.bitsize` <br>
+   *    The size in bits (`32` or `64`) of the offsets of the var-sized
+   *    attribute buffers of read and write queries. <br>
+   *    **Default**: 64
+   * - `sm.var_offsets.extra_element` <br>
+   *    If `true`, the offsets of the var-sized attribute buffers of read and
+   *    write queries end with an extra element holding the total size of
+   *    the values, i.e., `N` cells have `N+1` offsets (as in Apache Arrow).
+   *    <br>
+   *    **Default**: false
    * - `sm.array_schema_cache_size` <br>
    *    Array schema cache size in bytes. Any `uint64_t` value is acceptable.
    * <br>
@@ -254,6 +343,14 @@ class Config {
    *    The maximum number of parallel operations on objects with `file:///`
    *    URIs. <br>
    *    **Default**: `vfs.num_threads`
+   * - `vfs.file.max_open_files` <br>
+   *    The maximum number of file descriptors that each VFS instance keeps
+   *    open for reading and appending to `file:///` objects, evicting the
+   *    least recently used ones. `0` disables caching. The limit applies to
+   *    every VFS instance separately (each context has its own), so it
+   *    must be set well below the process limit on open files when many
+   *    contexts or VFS objects are in use. <br>
+   *    **Default**: 256
    * - `vfs.s3.region` <br>
    *    The S3 region, if S3 is enabled. <br>
    *    **Default**: us-east-1
@@ -412,6 +509,45 @@ class Config {
   /** Sets the tile cache size, properly parsing the input value. */
   Status set_sm_tile_cache_size(const std::string& value);
 
+  /** Sets the read in-flight tile size, properly parsing the input value. */
+  Status set_sm_read_inflight_size(const std::string& value);
+
+  /** Sets the read coalesce gap, properly parsing the input value. */
+  Status set_sm_read_coalesce_gap(const std::string& value);
+
+  /** Sets the read coalesce max size, properly parsing the input value. */
+  Status set_sm_read_coalesce_max_size(const std::string& value);
+
+  /**
+   * Sets the number of prefetched read partitions, properly parsing the
+   * input value.
+   */
+  Status set_sm_read_prefetch_partitions(const std::string& value);
+
+  /** Sets the read prefetch memory budget, properly parsing the input value. */
+  Status set_sm_read_prefetch_memory_budget(const std::string& value);
+
+  /** Sets the memory budget, properly parsing the input value. */
+  Status set_sm_memory_budget(const std::string& value);
+
+  /** Sets the var-sized memory budget, properly parsing the input value. */
+  Status set_sm_memory_budget_var(const std::string& value);
+
+  /** Sets the write batch size, properly parsing the input value. */
+  Status set_sm_write_batch_size(const std::string& value);
+
+  /** Sets the write staging buffers, properly parsing the input value. */
+  Status set_sm_write_staging_buffers(const std::string& value);
+
+  /** Sets the var-sized offsets bitsize, properly parsing the input value. */
+  Status set_sm_var_offsets_bitsize(const std::string& value);
+
+  /**
+   * Sets whether var-sized offsets have an extra element, properly parsing
+   * the input value.
+   */
+  Status set_sm_var_offsets_extra_element(const std::string& value);
+
   /** Sets the number of VFS threads. */
   Status set_vfs_num_threads(const std::string& value);
 
@@ -424,6 +560,9 @@ class Config {
   /** Sets the max number of allowed file:/// parallel operations. */
   Status set_vfs_file_max_parallel_ops(const std::string& value);
 
+  /** Sets the max number of cached open files, properly parsing the value. */
+  Status set_vfs_file_max_open_files(const std::string& value);
+
   /** Sets the S3 region. */
   Status set_vfs_s3_region(const std::string& value);
 
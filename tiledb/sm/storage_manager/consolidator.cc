@@ -299,6 +299,7 @@ Status Consolidator::create_queries(
     URI* new_fragment_uri) {
   // Create read query
   *query_r = new Query(storage_manager_, array_for_reads);
+  RETURN_NOT_OK((*query_r)->set_var_offsets_format(64, false));
   if (!(*query_r)->array_schema()->is_kv())
     RETURN_NOT_OK((*query_r)->set_layout(Layout::GLOBAL_ORDER));
   RETURN_NOT_OK(set_query_buffers(*query_r, buffers, buffer_sizes));
@@ -314,6 +315,7 @@ Status Consolidator::create_queries(
 
   // Create write query
   *query_w = new Query(storage_manager_, array_for_writes, *new_fragment_uri);
+  RETURN_NOT_OK((*query_w)->set_var_offsets_format(64, false));
   if (!(*query_w)->array_schema()->is_kv())
     RETURN_NOT_OK((*query_w)->set_layout(Layout::GLOBAL_ORDER));
   RETURN_NOT_OK((*query_w)->set_subarray(subarray));